@@ -168,10 +168,11 @@ void app_main()
 			vTaskDelay( 2000 / portTICK_PERIOD_MS );
 
 			//----------------------------------------------------------------------
-			//	... flip the display
+			//	... flip the display, the text stays on the display
 			//
 			oled_display_flip( &g_Display, true );
 
+			oled_display_set_cursor( &g_Display, 4, 0 );
 			oled_display_println( &g_Display, "The text now" );
 			oled_display_println( &g_Display, "is turned by" );
 			oled_display_println( &g_Display, "180 degree." );
@@ -183,6 +184,7 @@ void app_main()
 			vTaskDelay( 2000 / portTICK_PERIOD_MS );
 
 			oled_display_flip( &g_Display, false );
+			oled_display_clear( &g_Display );
 
 			oled_display_println( &g_Display, "The text is" );
 			oled_display_println( &g_Display, "back to normal" );
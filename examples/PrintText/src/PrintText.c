@@ -203,7 +203,7 @@ void app_main()
 			//	Then print the text.
 			printf( "Print lines\n" );
 
-			for( uint8_t idx = 0 ; idx < oled_display_max_text_lines() ; idx++ )
+			for( uint8_t idx = 0 ; idx < oled_display_max_text_lines( &g_Display ) ; idx++ )
 			{
 				oled_display_set_cursor( &g_Display, idx, 4 );
 
@@ -228,7 +228,7 @@ void app_main()
 			oled_display_print( &g_Display, "Column" );
 			oled_display_set_cursor( &g_Display, 3, 0 );
 			
-			for( uint8_t idx = 0 ; idx < oled_display_max_column_lines() ; idx++ )
+			for( uint8_t idx = 0 ; idx < oled_display_max_column_lines( &g_Display ) ; idx++ )
 			{
 				if( 9 < idx )
 				{
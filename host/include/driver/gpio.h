@@ -0,0 +1,71 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		driver/gpio.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Minimal replacement of the ESP-IDF GPIO driver header, so the SPI
+//#	transport of the library can be compiled on a Linux host.
+//#	The functions are implemented in spi_stub.c, the level of every
+//#	output pin is stored, so the SPI stand-in can read the D/C pin.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdint.h>
+#include <esp_err.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define GPIO_NUM_MAX			49
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef int		gpio_num_t;
+
+typedef enum gpio_mode
+{
+	GPIO_MODE_DISABLE	= 0,
+	GPIO_MODE_INPUT,
+	GPIO_MODE_OUTPUT
+
+} gpio_mode_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+esp_err_t gpio_reset_pin( gpio_num_t gpioNum );
+esp_err_t gpio_set_direction( gpio_num_t gpioNum, gpio_mode_t mode );
+esp_err_t gpio_set_level( gpio_num_t gpioNum, uint32_t level );
+int gpio_get_level( gpio_num_t gpioNum );
@@ -0,0 +1,92 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		driver/i2c.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Minimal replacement of the ESP-IDF legacy I²C driver header, so the
+//#	library can be compiled on a Linux host.
+//#	The functions are implemented in i2c_stub.c and send all bytes to
+//#	the emulated bus that is attached to the port.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_err.h>
+#include <freertos/FreeRTOS.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define I2C_NUM_0				0
+#define I2C_NUM_1				1
+#define I2C_NUM_MAX				2
+
+#define I2C_MASTER_WRITE		0
+#define I2C_MASTER_READ			1
+
+#define I2C_INTERNAL_STRUCT_SIZE	24
+#define I2C_LINK_RECOMMENDED_SIZE( TRANSACTIONS )	(2 * I2C_INTERNAL_STRUCT_SIZE + I2C_INTERNAL_STRUCT_SIZE * (5 * (TRANSACTIONS)))
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef int			i2c_port_t;
+typedef void	   *i2c_cmd_handle_t;
+
+struct oled_emu_bus;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+void host_i2c_attach_bus( i2c_port_t port, struct oled_emu_bus *pBus );
+uint32_t host_i2c_allocations( void );
+
+esp_err_t i2c_master_write_to_device(	i2c_port_t		 port,
+										uint8_t			 address,
+										const uint8_t	*pBuffer,
+										size_t			 length,
+										TickType_t		 ticksToWait	);
+
+i2c_cmd_handle_t i2c_cmd_link_create( void );
+i2c_cmd_handle_t i2c_cmd_link_create_static( uint8_t *pBuffer, uint32_t size );
+void i2c_cmd_link_delete( i2c_cmd_handle_t cmd );
+void i2c_cmd_link_delete_static( i2c_cmd_handle_t cmd );
+
+esp_err_t i2c_master_start( i2c_cmd_handle_t cmd );
+esp_err_t i2c_master_write_byte( i2c_cmd_handle_t cmd, uint8_t data, bool ackEnable );
+esp_err_t i2c_master_write( i2c_cmd_handle_t cmd, const uint8_t *pData, size_t length, bool ackEnable );
+esp_err_t i2c_master_stop( i2c_cmd_handle_t cmd );
+esp_err_t i2c_master_cmd_begin( i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t ticksToWait );
@@ -0,0 +1,133 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		driver/i2c_master.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Minimal replacement of the ESP-IDF I²C bus / device driver header
+//#	(ESP-IDF 5.2 and later), so the I²C master transport of the library
+//#	can be compiled on a Linux host.
+//#	The functions are implemented in i2c_master_stub.c and send all
+//#	bytes to the emulated bus that is attached to the port (see
+//#	host_i2c_attach_bus).
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_err.h>
+#include <freertos/FreeRTOS.h>
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef int		i2c_port_num_t;
+
+typedef enum i2c_addr_bit_len
+{
+	I2C_ADDR_BIT_LEN_7	= 0,
+	I2C_ADDR_BIT_LEN_10
+
+} i2c_addr_bit_len_t;
+
+
+typedef enum i2c_master_event
+{
+	I2C_EVENT_ALIVE	= 0,
+	I2C_EVENT_DONE,
+	I2C_EVENT_NACK,
+	I2C_EVENT_TIMEOUT
+
+} i2c_master_event_t;
+
+
+typedef struct i2c_master_bus_config
+{
+	i2c_port_num_t		i2c_port;
+	int					sda_io_num;
+	int					scl_io_num;
+	int					clk_source;
+	uint8_t				glitch_ignore_cnt;
+	int					intr_priority;
+	size_t				trans_queue_depth;
+	struct
+	{
+		uint32_t		enable_internal_pullup	: 1;
+	}					flags;
+
+} i2c_master_bus_config_t;
+
+
+typedef struct i2c_device_config
+{
+	i2c_addr_bit_len_t	dev_addr_length;
+	uint16_t			device_address;
+	uint32_t			scl_speed_hz;
+	uint32_t			scl_wait_us;
+	struct
+	{
+		uint32_t		disable_ack_check		: 1;
+	}					flags;
+
+} i2c_device_config_t;
+
+
+typedef struct i2c_master_event_data
+{
+	i2c_master_event_t	event;
+
+} i2c_master_event_data_t;
+
+
+typedef struct i2c_master_bus_t	*i2c_master_bus_handle_t;
+typedef struct i2c_master_dev_t	*i2c_master_dev_handle_t;
+
+typedef bool (*i2c_master_callback_t)( i2c_master_dev_handle_t device, const i2c_master_event_data_t *pEventData, void *pArg );
+
+typedef struct i2c_master_event_callbacks
+{
+	i2c_master_callback_t	on_trans_done;
+
+} i2c_master_event_callbacks_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+uint32_t host_i2c_master_max_queued( void );
+void host_i2c_master_fail_transmit( uint32_t transmit );
+
+esp_err_t i2c_new_master_bus( const i2c_master_bus_config_t *pConfig, i2c_master_bus_handle_t *pBus );
+esp_err_t i2c_del_master_bus( i2c_master_bus_handle_t bus );
+esp_err_t i2c_master_bus_add_device( i2c_master_bus_handle_t bus, const i2c_device_config_t *pConfig, i2c_master_dev_handle_t *pDevice );
+esp_err_t i2c_master_bus_rm_device( i2c_master_dev_handle_t device );
+esp_err_t i2c_master_bus_wait_all_done( i2c_master_bus_handle_t bus, int timeoutMs );
+esp_err_t i2c_master_register_event_callbacks( i2c_master_dev_handle_t device, const i2c_master_event_callbacks_t *pCallbacks, void *pArg );
+esp_err_t i2c_master_probe( i2c_master_bus_handle_t bus, uint16_t address, int timeoutMs );
+esp_err_t i2c_master_transmit( i2c_master_dev_handle_t device, const uint8_t *pBuffer, size_t length, int timeoutMs );
@@ -0,0 +1,121 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		driver/spi_master.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Minimal replacement of the ESP-IDF SPI master driver header, so the
+//#	SPI transport of the library can be compiled on a Linux host.
+//#	The functions are implemented in spi_stub.c and send all transfers
+//#	to the emulated display that is attached to the CS pin.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_err.h>
+#include <freertos/FreeRTOS.h>
+#include <driver/gpio.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define SPI_TRANS_USE_TXDATA		(1 << 3)
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef enum spi_host_device
+{
+	SPI1_HOST	= 0,
+	SPI2_HOST,
+	SPI3_HOST,
+	SPI_HOST_MAX
+
+} spi_host_device_t;
+
+
+typedef struct spi_transaction
+{
+	uint32_t	 flags;
+	uint16_t	 cmd;
+	uint64_t	 addr;
+	size_t		 length;			//	in bits
+	size_t		 rxlength;
+	void		*user;
+	union
+	{
+		const void	*tx_buffer;
+		uint8_t		 tx_data[ 4 ];
+	};
+	union
+	{
+		void		*rx_buffer;
+		uint8_t		 rx_data[ 4 ];
+	};
+
+} spi_transaction_t;
+
+
+typedef void (*transaction_cb_t)( spi_transaction_t *pTrans );
+
+typedef struct spi_device_interface_config
+{
+	uint8_t				command_bits;
+	uint8_t				address_bits;
+	uint8_t				dummy_bits;
+	uint8_t				mode;
+	int					clock_speed_hz;
+	int					spics_io_num;
+	uint32_t			flags;
+	int					queue_size;
+	transaction_cb_t	pre_cb;
+	transaction_cb_t	post_cb;
+
+} spi_device_interface_config_t;
+
+
+typedef struct spi_device_t	*spi_device_handle_t;
+
+struct oled_emu;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+void host_spi_attach_display( spi_host_device_t host, int csPin, gpio_num_t dcPin, struct oled_emu *pEmu );
+uint32_t host_spi_max_queued( void );
+
+esp_err_t spi_bus_add_device( spi_host_device_t host, const spi_device_interface_config_t *pConfig, spi_device_handle_t *pHandle );
+esp_err_t spi_bus_remove_device( spi_device_handle_t handle );
+esp_err_t spi_device_queue_trans( spi_device_handle_t handle, spi_transaction_t *pTrans, TickType_t ticksToWait );
+esp_err_t spi_device_get_trans_result( spi_device_handle_t handle, spi_transaction_t **ppTrans, TickType_t ticksToWait );
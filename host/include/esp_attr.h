@@ -0,0 +1,33 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		esp_attr.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Minimal replacement of the ESP-IDF section attributes. On the host
+//#	there is no difference between flash and RAM, so the attributes
+//#	are empty.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define DRAM_ATTR
+#define IRAM_ATTR
+#define WORD_ALIGNED_ATTR		__attribute__(( aligned( 4 ) ))
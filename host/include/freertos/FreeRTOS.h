@@ -0,0 +1,62 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		freertos/FreeRTOS.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Minimal replacement of the FreeRTOS base header, so the library can
+//#	be compiled on a Linux host.
+//#	The FreeRTOS functions used by the library are implemented with
+//#	POSIX threads in freertos_stub.c.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define portTICK_PERIOD_MS		1
+#define portMAX_DELAY			((TickType_t)0xFFFFFFFF)
+
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES	2
+
+#define pdFALSE					0
+#define pdTRUE					1
+#define pdFAIL					pdFALSE
+#define pdPASS					pdTRUE
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef uint32_t	TickType_t;
+typedef int			BaseType_t;
+typedef unsigned	UBaseType_t;
@@ -0,0 +1,68 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		freertos/queue.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	FreeRTOS queues, implemented with POSIX threads.
+//#	Like on the target the items are copied into the given storage.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <pthread.h>
+#include <freertos/FreeRTOS.h>
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct StaticQueue
+{
+	pthread_mutex_t		mutex;
+	pthread_cond_t		notEmpty;
+	pthread_cond_t		notFull;
+	uint8_t			   *pStorage;
+	UBaseType_t			length;
+	UBaseType_t			itemSize;
+	UBaseType_t			head;
+	UBaseType_t			count;
+
+} StaticQueue_t;
+
+typedef StaticQueue_t	*QueueHandle_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+QueueHandle_t xQueueCreateStatic(	UBaseType_t		 length,
+									UBaseType_t		 itemSize,
+									uint8_t			*pStorage,
+									StaticQueue_t	*pQueueBuffer	);
+BaseType_t xQueueSend( QueueHandle_t queue, const void *pItem, TickType_t ticksToWait );
+BaseType_t xQueueReceive( QueueHandle_t queue, void *pItem, TickType_t ticksToWait );
+UBaseType_t uxQueueMessagesWaiting( QueueHandle_t queue );
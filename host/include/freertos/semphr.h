@@ -0,0 +1,67 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		freertos/semphr.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Recursive mutexes and counting semaphores of FreeRTOS, implemented
+//#	with POSIX threads.
+//#	Like on the target the semaphore lives in the given static buffer.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <pthread.h>
+#include <freertos/FreeRTOS.h>
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct StaticSemaphore
+{
+	pthread_mutex_t		mutex;
+	pthread_cond_t		cond;			//	counting semaphore only
+	UBaseType_t			count;
+	UBaseType_t			maxCount;
+
+} StaticSemaphore_t;
+
+typedef StaticSemaphore_t	*SemaphoreHandle_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic( StaticSemaphore_t *pBuffer );
+BaseType_t xSemaphoreTakeRecursive( SemaphoreHandle_t semaphore, TickType_t ticksToWait );
+BaseType_t xSemaphoreGiveRecursive( SemaphoreHandle_t semaphore );
+void vSemaphoreDelete( SemaphoreHandle_t semaphore );
+
+SemaphoreHandle_t xSemaphoreCreateCountingStatic( UBaseType_t maxCount, UBaseType_t initialCount, StaticSemaphore_t *pBuffer );
+BaseType_t xSemaphoreTake( SemaphoreHandle_t semaphore, TickType_t ticksToWait );
+BaseType_t xSemaphoreGive( SemaphoreHandle_t semaphore );
+BaseType_t xSemaphoreGiveFromISR( SemaphoreHandle_t semaphore, BaseType_t *pHigherPriorityTaskWoken );
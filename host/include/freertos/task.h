@@ -0,0 +1,100 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		freertos/task.h	(host stand-in)
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	FreeRTOS tasks and direct to task notifications, implemented with
+//#	POSIX threads. Like on the target the task control block lives in
+//#	the given static buffer, the stack buffer is not used on the host.
+//#	Threads that were not created with xTaskCreateStatic() get their
+//#	task control block on the first call of xTaskGetCurrentTaskHandle().
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <pthread.h>
+#include <freertos/FreeRTOS.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define pdMS_TO_TICKS( ms )		((TickType_t)((ms) / portTICK_PERIOD_MS))
+
+#define xTaskNotifyGive( task )								xTaskNotifyGiveIndexed( (task), 0 )
+#define ulTaskNotifyTake( clearCountOnExit, ticksToWait )	ulTaskNotifyTakeIndexed( 0, (clearCountOnExit), (ticksToWait) )
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef uint8_t		StackType_t;
+typedef void		(*TaskFunction_t)( void *pParameter );
+
+typedef struct StaticTask
+{
+	pthread_t			thread;
+	pthread_mutex_t		mutex;
+	pthread_cond_t		cond;
+	uint32_t			notifyValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+	TaskFunction_t		pFunction;
+	void			   *pParameter;
+
+} StaticTask_t;
+
+typedef StaticTask_t	*TaskHandle_t;
+
+typedef struct TimeOut
+{
+	TickType_t			timeOnEntering;
+
+} TimeOut_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+TaskHandle_t xTaskCreateStatic(	TaskFunction_t	 pFunction,
+								const char		*strName,
+								uint32_t		 stackDepth,
+								void			*pParameter,
+								UBaseType_t		 priority,
+								StackType_t		*pStack,
+								StaticTask_t	*pTaskBuffer	);
+void vTaskDelete( TaskHandle_t task );
+void vTaskDelay( TickType_t ticks );
+TaskHandle_t xTaskGetCurrentTaskHandle( void );
+
+TickType_t xTaskGetTickCount( void );
+void vTaskSetTimeOutState( TimeOut_t *pTimeOut );
+BaseType_t xTaskCheckForTimeOut( TimeOut_t *pTimeOut, TickType_t *pTicksToWait );
+
+BaseType_t xTaskNotifyGiveIndexed( TaskHandle_t task, UBaseType_t indexToNotify );
+uint32_t ulTaskNotifyTakeIndexed( UBaseType_t indexToWaitOn, BaseType_t clearCountOnExit, TickType_t ticksToWait );
@@ -0,0 +1,211 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		oled_emulator.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Host side emulator of the sh1106, sh1107 and ssd1306 display
+//#	controllers.
+//#	The emulator decodes the I²C byte stream (prefix bytes, commands and
+//#	display data) like the real controller does and keeps the display
+//#	RAM, so the resulting pixels on the panel can be checked.
+//#	Every emulated bus counts the transactions and bytes send over it.
+//#	The scroll engine of the ssd1306 runs when the frames of the panel
+//#	are counted with oled_emu_run_frames().
+//#	A snapshot of the panel shows later which pixels have changed.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <pthread.h>
+#include <SimpleOledLib.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define OLED_EMU_RAM_PAGES			16
+#define OLED_EMU_RAM_COLUMNS		132
+#define OLED_EMU_PANEL_WIDTH		128
+#define OLED_EMU_PANEL_HEIGHT		64
+#define OLED_EMU_MAX_PARAMETERS		6
+#define OLED_EMU_BUS_DEVICES		4
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	one emulated display (controller + panel)
+//
+typedef struct oled_emu
+{
+	chip_type_t		chipType;
+	uint8_t			address;
+	uint8_t			ramColumns;			//	132 (sh1106) or 128 (ssd1306, sh1107)
+	uint8_t			ramPages;			//	16 (sh1107) or 8
+	uint8_t			panelWidth;
+	uint8_t			panelHeight;
+	uint8_t			panelSegmentOffset;	//	first SEG wired to the panel
+	uint8_t			panelComPins;		//	COM pins configuration of the wiring
+
+	uint8_t			ram[ OLED_EMU_RAM_PAGES ][ OLED_EMU_RAM_COLUMNS ];
+
+	//----	controller registers  --------------------------------------
+	uint8_t			page;
+	uint8_t			column;
+	uint8_t			startLine;
+	uint8_t			lineOffset;
+	uint8_t			multiplex;
+	uint8_t			comPins;
+	uint8_t			adrMode;
+	uint8_t			columnStart;
+	uint8_t			columnEnd;
+	uint8_t			pageStart;
+	uint8_t			pageEnd;
+	bool			segmentRemap;
+	bool			comScanReverse;
+	bool			inverse;
+	bool			entireDisplayOn;
+	bool			displayOn;
+
+	//----	scroll engine (ssd1306)  -----------------------------------
+	//	like the real controller a horizontal scroll moves the content
+	//	of the RAM, the vertical part only moves the rows on the panel
+	//
+	bool			scrollActive;
+	uint8_t			scrollOpCode;		//	0x26, 0x27, 0x29 or 0x2A
+	uint8_t			scrollStartPage;
+	uint8_t			scrollEndPage;
+	uint16_t		scrollInterval;		//	frames per step
+	uint16_t		scrollFrames;		//	frames since the last step
+	uint8_t			scrollVerticalOffset;
+	uint8_t			verticalFixedRows;
+	uint8_t			verticalScrollRows;
+	uint8_t			verticalScrollLine;
+	uint32_t		scrollSteps;
+	uint32_t		scrollSetupErrors;	//	setup while the scroll is active
+
+	//----	decoder state of the actual transaction  -------------------
+	bool			expectControl;
+	bool			singleByte;
+	bool			isData;
+	uint8_t			opCode;
+	uint8_t			parameterCount;
+	uint8_t			parametersExpected;
+	uint8_t			parameters[ OLED_EMU_MAX_PARAMETERS ];
+
+	//----	statistics  ------------------------------------------------
+	uint32_t		transactions;
+	uint32_t		controlBytes;
+	uint32_t		commandBytes;
+	uint32_t		dataBytes;
+
+} oled_emu_t;
+
+
+//----------------------------------------------------------------------
+//	all pixels of a panel at one point in time (see oled_emu_snapshot)
+//
+typedef struct oled_emu_snapshot
+{
+	uint8_t			width;
+	uint8_t			height;
+	bool			pixel[ OLED_EMU_RAM_PAGES * 8 ][ OLED_EMU_RAM_COLUMNS ];
+
+} oled_emu_snapshot_t;
+
+
+//----------------------------------------------------------------------
+//	an emulated I²C bus with the displays connected to it
+//	Like the bus driver on the target the bus can be used from different
+//	threads, one complete transaction is done under the lock.
+//
+typedef struct oled_emu_bus
+{
+	oled_emu_t		*pDevices[ OLED_EMU_BUS_DEVICES ];
+	oled_emu_t		*pActive;
+	uint8_t			 deviceCount;
+	pthread_mutex_t	 lock;
+
+	//----	statistics  ------------------------------------------------
+	uint32_t		 transactions;	//	including not acknowledged ones
+	uint32_t		 bytes;			//	bytes following the address byte
+	uint32_t		 nacks;
+
+} oled_emu_bus_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   V A R I A B L E S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	transport that sends directly to an emulated bus
+//	the context is a pointer to the oled_emu_bus_t
+//
+extern const oled_transport_t	g_oledEmuTransport;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+void oled_emu_init( oled_emu_t *pEmu, chip_type_t chipType, uint8_t address );
+void oled_emu_set_panel( oled_emu_t *pEmu, uint8_t width, uint8_t height, uint8_t segmentOffset, uint8_t comPins );
+void oled_emu_reset_stats( oled_emu_t *pEmu );
+void oled_emu_run_frames( oled_emu_t *pEmu, uint32_t frames );
+
+bool oled_emu_pixel( const oled_emu_t *pEmu, uint8_t x, uint8_t y );
+void oled_emu_snapshot( const oled_emu_t *pEmu, oled_emu_snapshot_t *pSnapshot );
+bool oled_emu_compare_outside(	const oled_emu_t			*pEmu,
+								const oled_emu_snapshot_t	*pSnapshot,
+								uint16_t					 x,
+								uint16_t					 y,
+								uint16_t					 width,
+								uint16_t					 height,
+								uint8_t						*pX,
+								uint8_t						*pY			);
+void oled_emu_dump( const oled_emu_t *pEmu, FILE *pFile );
+
+void oled_emu_bus_init( oled_emu_bus_t *pBus );
+void oled_emu_bus_attach( oled_emu_bus_t *pBus, oled_emu_t *pEmu );
+void oled_emu_bus_reset_stats( oled_emu_bus_t *pBus );
+void oled_emu_bus_lock( oled_emu_bus_t *pBus );
+void oled_emu_bus_unlock( oled_emu_bus_t *pBus );
+
+bool oled_emu_bus_start( oled_emu_bus_t *pBus, uint8_t address );
+void oled_emu_bus_byte( oled_emu_bus_t *pBus, uint8_t data );
+void oled_emu_bus_stop( oled_emu_bus_t *pBus );
+
+esp_err_t oled_emu_bus_write( oled_emu_bus_t *pBus, uint8_t address, const uint8_t *pBuffer, size_t length );
+
+void oled_emu_spi_write( oled_emu_t *pEmu, bool isData, const uint8_t *pData, size_t length );
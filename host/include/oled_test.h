@@ -0,0 +1,77 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		oled_test.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Helpers shared by the host tests.
+//#	The transport tests run the same steps on a reference display and
+//#	on a display under test and compare both emulated controllers
+//#	after every step (oled_test_run_steps).
+//#	The font tests build the expected columns of a text out of the
+//#	glyphs of the font (oled_test_glyph_column).
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	a display of a transport test with its own frame buffer and the
+//	emulated controller that receives its output
+//
+typedef struct oled_test_display
+{
+	oled_display_handle_t	 display;
+	oled_frame_buffer_t		 frameBuffer;
+	oled_emu_t				*pEmulator;
+
+} oled_test_display_t;
+
+//----------------------------------------------------------------------
+//	waits until the transport of the display under test has send
+//	everything, returns 'false' if this failed
+//
+typedef bool (*oled_test_wait_t)( void *pContext );
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+bool oled_test_run_steps(	const char			*strCase,
+							oled_test_display_t	*pRef,
+							oled_test_display_t	*pTest,
+							oled_test_wait_t	 pWait,
+							void				*pContext	);
+
+bool oled_test_compare( const char *strCase, const char *strStep, const oled_emu_t *pRef, const oled_emu_t *pTest );
+
+uint8_t oled_test_glyph_column( const oled_font_t *pFont, const oled_glyph_t *pGlyph, uint8_t column );
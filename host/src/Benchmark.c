@@ -0,0 +1,856 @@
+//##########################################################################
+//#
+//#		Benchmark
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program measures the cost of the public functions of the
+//#	library for both chip types.
+//#
+//#	For every scenario the bus traffic is taken from the emulated bus
+//#	(transactions, bytes incl. address bytes) and the wire time at
+//#	100 kHz, 400 kHz and 1 MHz is estimated from it (9 clocks per byte
+//#	plus START and STOP). The CPU time is measured separately against a
+//#	transport that sends nothing, so it is the time of the library only.
+//#
+//#	The CPU time of one character (print of a full text line, the text
+//#	shadow is defeated by changing the text every time) is given in ns
+//#	and, on x86, in TSC cycles. The same is shown for a line printed
+//#	with the proportional fonts. Built against a specialized library
+//#	(OLED_FIXED_CHIP_TYPE) only the fixed chip is measured.
+//#
+//#	With a baseline file every scenario that needs more transactions or
+//#	more bytes than stored in the baseline is a regression and the
+//#	program ends with exit code 1.
+//#
+//#	Usage:	Benchmark [--baseline <file>] [--write-baseline <file>]
+//#
+//#	Baseline file: one line per scenario
+//#		<scenario> <chip> <transactions> <bytes>
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define BENCH_CPU_LOOPS				200
+#define BENCH_MAX_BASELINE			128
+#define BENCH_GLYPH_LOOPS			2000
+
+//----	chip types to measure  -----------------------------------------
+#ifdef OLED_FIXED_CHIP_TYPE
+#define BENCH_FIRST_CHIP			OLED_FIXED_CHIP_TYPE
+#define BENCH_LAST_CHIP				OLED_FIXED_CHIP_TYPE
+#else
+#define BENCH_FIRST_CHIP			CHIP_TYPE_SH1106
+#define BENCH_LAST_CHIP				CHIP_TYPE_SSD1306
+#endif
+
+//----	clocks on the wire  --------------------------------------------
+#define WIRE_CLOCKS_PER_BYTE		9		//	8 data bits + ACK
+#define WIRE_CLOCKS_PER_TRANSACTION	2		//	START + STOP
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef void (*bench_function_t)( oled_display_handle_t *pHandle );
+
+//----------------------------------------------------------------------
+//	one scenario
+//	prepare is not measured, run is measured
+//
+typedef struct bench_scenario
+{
+	const char			*strName;
+	bench_function_t	 pPrepare;
+	bench_function_t	 pRun;
+
+} bench_scenario_t;
+
+
+//----------------------------------------------------------------------
+//	one line of the baseline file
+//
+typedef struct bench_baseline
+{
+	char		strName[ 40 ];
+	char		strChip[ 10 ];
+	uint32_t	transactions;
+	uint32_t	bytes;
+
+} bench_baseline_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const char g_strHello[]		= "Hello World !";
+const char g_strUtf8[]		= "Größe: 21.5°C";
+const char g_strLongText[]	= "This text is longer than one line of the display";
+
+const char *g_arstrGlyphLine[] =
+	{
+		"ABCDEFGHIJKLMNOP", "abcdefghijklmnop"
+	};
+
+const char *g_arstrUtf8Line[] =
+	{
+		"ÄÖÜäöüß°µ±²³Ω€ÄÖ", "Größe: 21.5°C äö"
+	};
+
+const char *g_arstrFontLine[] =
+	{
+		"Temp: 21.5 C Hum: 45 %", "Rain: 0.0 mm Batt: 3.91"
+	};
+
+const char *g_arstrStatus[] =
+	{
+		"Temp:   21.5 C", "Hum:    45 %", "Press:  1013 hPa", "Wind:   12 km/h",
+		"Rain:   0.0 mm", "Light:  840 lx", "Batt:   3.91 V", "Uptime: 00:12:45"
+	};
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+oled_async_t			g_Async;
+
+bench_baseline_t		g_arBaseline[ BENCH_MAX_BASELINE ];
+int						g_baselineCount		= 0;
+
+
+//==========================================================================
+//
+//		N U L L   T R A N S P O R T
+//
+//==========================================================================
+
+static esp_err_t null_probe( void *pContext, uint8_t address )
+{
+	(void)pContext;
+	(void)address;
+
+	return( ESP_OK );
+}
+
+static esp_err_t null_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	(void)pContext;
+	(void)address;
+	(void)pBuffer;
+	(void)length;
+
+	return( ESP_OK );
+}
+
+const oled_transport_t	g_NullTransport =
+	{
+		.probe		= null_probe,
+		.write		= null_write,
+		.write_data	= null_write
+	};
+
+
+//==========================================================================
+//
+//		S C E N A R I O S
+//
+//==========================================================================
+
+static void prepare_nothing( oled_display_handle_t *pHandle )
+{
+	(void)pHandle;
+}
+
+static void prepare_last_line_same( oled_display_handle_t *pHandle )
+{
+	oled_display_set_print_mode( pHandle, PM_OVERWRITE_SAME_LINE );
+	oled_display_set_cursor( pHandle, 7, 0 );
+}
+
+static void prepare_last_line_next( oled_display_handle_t *pHandle )
+{
+	oled_display_set_print_mode( pHandle, PM_OVERWRITE_NEXT_LINE );
+	oled_display_set_cursor( pHandle, 7, 0 );
+}
+
+static void prepare_last_line_scroll( oled_display_handle_t *pHandle )
+{
+	oled_display_set_print_mode( pHandle, PM_SCROLL_LINE );
+	oled_display_set_cursor( pHandle, 7, 0 );
+}
+
+static void prepare_frame_buffer( oled_display_handle_t *pHandle )
+{
+	oled_display_set_frame_buffer( pHandle, &g_FrameBuffer );
+}
+
+static void prepare_frame_buffer_fields( oled_display_handle_t *pHandle )
+{
+	oled_display_set_frame_buffer( pHandle, &g_FrameBuffer );
+	oled_display_set_cursor( pHandle, 1, 0 );
+	oled_display_print( pHandle, "Temp:  21.5 C" );
+	oled_display_flush( pHandle );
+}
+
+static void print_status( oled_display_handle_t *pHandle )
+{
+	for( uint8_t line = 0 ; 8 > line ; line++ )
+	{
+		oled_display_set_cursor( pHandle, line, 0 );
+		oled_display_print( pHandle, g_arstrStatus[ line ] );
+	}
+}
+
+static void prepare_status( oled_display_handle_t *pHandle )
+{
+	print_status( pHandle );
+}
+
+static void prepare_async( oled_display_handle_t *pHandle )
+{
+	oled_display_start_async( pHandle, &g_Async, 5, NULL, NULL );
+}
+
+static void run_init( oled_display_handle_t *pHandle )
+{
+	oled_display_init_transport( pHandle, pHandle->pTransport, pHandle->pTransportContext, pHandle->chipType, pHandle->address );
+}
+
+static void run_print( oled_display_handle_t *pHandle )
+{
+	oled_display_print( pHandle, g_strHello );
+}
+
+static void run_print_char( oled_display_handle_t *pHandle )
+{
+	oled_display_print_char( pHandle, 'A' );
+}
+
+static void run_print_utf8( oled_display_handle_t *pHandle )
+{
+	oled_display_print( pHandle, g_strUtf8 );
+}
+
+static void run_print_font_5x7( oled_display_handle_t *pHandle )
+{
+	oled_display_print_font( pHandle, &g_oledFont5x7, 0, 0, g_strHello );
+}
+
+static void run_print_font_3x5( oled_display_handle_t *pHandle )
+{
+	oled_display_print_font( pHandle, &g_oledFont3x5, 0, 0, g_strHello );
+}
+
+static void run_print_scaled_2x( oled_display_handle_t *pHandle )
+{
+	oled_display_print_scaled( pHandle, NULL, 2, 0, 0, "21.5" );
+}
+
+static void run_print_scaled_3x( oled_display_handle_t *pHandle )
+{
+	oled_display_print_scaled( pHandle, &g_oledFont5x7, 3, 0, 0, "21.5" );
+}
+
+static void run_print_inverse_font( oled_display_handle_t *pHandle )
+{
+	oled_display_set_inverse_font( pHandle, true );
+	oled_display_print( pHandle, g_strHello );
+	oled_display_set_inverse_font( pHandle, false );
+}
+
+static void run_println_long( oled_display_handle_t *pHandle )
+{
+	oled_display_println( pHandle, g_strLongText );
+}
+
+static void run_println_screen( oled_display_handle_t *pHandle )
+{
+	for( int idx = 0 ; 16 > idx ; idx++ )
+	{
+		oled_display_println( pHandle, g_strHello );
+	}
+}
+
+static void run_clear( oled_display_handle_t *pHandle )
+{
+	oled_display_clear( pHandle );
+}
+
+static void run_clear_line( oled_display_handle_t *pHandle )
+{
+	oled_display_clear_line( pHandle, 3 );
+}
+
+static void run_clear_actual_line( oled_display_handle_t *pHandle )
+{
+	oled_display_clear_actual_line( pHandle );
+}
+
+static void run_set_cursor( oled_display_handle_t *pHandle )
+{
+	oled_display_set_cursor( pHandle, 4, 5 );
+}
+
+static void run_home( oled_display_handle_t *pHandle )
+{
+	oled_display_home( pHandle );
+}
+
+static void run_set_inverse( oled_display_handle_t *pHandle )
+{
+	oled_display_set_inverse( pHandle, true );
+}
+
+static void run_flip( oled_display_handle_t *pHandle )
+{
+	oled_display_flip( pHandle, true );
+}
+
+static void run_set_column_offset( oled_display_handle_t *pHandle )
+{
+	oled_display_set_display_column_offset( pHandle, 1 );
+}
+
+static void run_locked_print( oled_display_handle_t *pHandle )
+{
+	oled_display_enable_lock( pHandle );
+	oled_display_lock( pHandle );
+	oled_display_set_cursor( pHandle, 2, 0 );
+	oled_display_print( pHandle, g_strHello );
+	oled_display_unlock( pHandle );
+}
+
+static void run_fb_full_flush( oled_display_handle_t *pHandle )
+{
+	oled_display_flush( pHandle );
+}
+
+static void run_fb_print_flush( oled_display_handle_t *pHandle )
+{
+	oled_display_set_cursor( pHandle, 3, 0 );
+	oled_display_print( pHandle, g_strHello );
+	oled_display_flush( pHandle );
+}
+
+static void run_fb_one_digit( oled_display_handle_t *pHandle )
+{
+	oled_display_set_cursor( pHandle, 1, 7 );
+	oled_display_print( pHandle, "21.6" );
+	oled_display_flush( pHandle );
+}
+
+static void run_fb_draw_gauge( oled_display_handle_t *pHandle )
+{
+	oled_display_draw_rect( pHandle, 0, 24, 100, 8, PIXEL_SET );
+	oled_display_fill_rect( pHandle, 2, 26, 61, 4, PIXEL_SET );
+	oled_display_flush( pHandle );
+}
+
+static void run_fb_remove( oled_display_handle_t *pHandle )
+{
+	oled_display_set_frame_buffer( pHandle, NULL );
+}
+
+static void run_status_reprint( oled_display_handle_t *pHandle )
+{
+	print_status( pHandle );
+}
+
+static void run_status_one_value( oled_display_handle_t *pHandle )
+{
+	g_arstrStatus[ 0 ] = "Temp:   21.6 C";
+	print_status( pHandle );
+	g_arstrStatus[ 0 ] = "Temp:   21.5 C";
+}
+
+static void run_async_print( oled_display_handle_t *pHandle )
+{
+	oled_display_print( pHandle, g_strHello );
+	oled_display_fence( pHandle );
+	oled_display_wait( pHandle, portMAX_DELAY );
+	oled_display_stop_async( pHandle );
+}
+
+const bench_scenario_t g_arScenario[] =
+	{
+		{ "init",					prepare_nothing,				run_init				},
+		{ "print",					prepare_nothing,				run_print				},
+		{ "print_char",				prepare_nothing,				run_print_char			},
+		{ "print_utf8",				prepare_nothing,				run_print_utf8			},
+		{ "print_inverse_font",		prepare_nothing,				run_print_inverse_font	},
+		{ "print_font_5x7",			prepare_nothing,				run_print_font_5x7		},
+		{ "print_font_3x5",			prepare_nothing,				run_print_font_3x5		},
+		{ "print_scaled_2x",		prepare_nothing,				run_print_scaled_2x		},
+		{ "print_scaled_3x",		prepare_nothing,				run_print_scaled_3x		},
+		{ "println_same_line",		prepare_last_line_same,			run_println_long		},
+		{ "println_next_line",		prepare_last_line_next,			run_println_long		},
+		{ "println_scroll_line",	prepare_last_line_scroll,		run_println_long		},
+		{ "println_screen_scroll",	prepare_last_line_scroll,		run_println_screen		},
+		{ "clear",					prepare_nothing,				run_clear				},
+		{ "clear_line",				prepare_nothing,				run_clear_line			},
+		{ "clear_actual_line",		prepare_nothing,				run_clear_actual_line	},
+		{ "set_cursor",				prepare_nothing,				run_set_cursor			},
+		{ "home",					prepare_nothing,				run_home				},
+		{ "set_inverse",			prepare_nothing,				run_set_inverse			},
+		{ "flip",					prepare_nothing,				run_flip				},
+		{ "set_column_offset",		prepare_nothing,				run_set_column_offset	},
+		{ "locked_print",			prepare_nothing,				run_locked_print		},
+		{ "fb_full_flush",			prepare_frame_buffer,			run_fb_full_flush		},
+		{ "fb_print_flush",			prepare_frame_buffer_fields,	run_fb_print_flush		},
+		{ "fb_one_digit",			prepare_frame_buffer_fields,	run_fb_one_digit		},
+		{ "fb_draw_gauge",			prepare_frame_buffer_fields,	run_fb_draw_gauge		},
+		{ "fb_remove",				prepare_frame_buffer_fields,	run_fb_remove			},
+		{ "status_reprint",			prepare_status,					run_status_reprint		},
+		{ "status_one_value",		prepare_status,					run_status_one_value	},
+		{ "async_print_wait",		prepare_async,					run_async_print			}
+	};
+
+#define BENCH_SCENARIOS		(sizeof( g_arScenario ) / sizeof( g_arScenario[ 0 ] ))
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	cpu_time_ns
+//--------------------------------------------------------------------------
+//
+static uint64_t cpu_time_ns( void )
+{
+	struct timespec	now;
+
+	clock_gettime( CLOCK_PROCESS_CPUTIME_ID, &now );
+
+	return( (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec );
+}
+
+
+//**************************************************************************
+//	cpu_cycles
+//--------------------------------------------------------------------------
+//	time stamp counter of the CPU (0 if there is none)
+//
+static uint64_t cpu_cycles( void )
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+	return( __builtin_ia32_rdtsc() );
+#else
+	return( 0 );
+#endif
+}
+
+
+//**************************************************************************
+//	wire_time_us
+//--------------------------------------------------------------------------
+//
+static double wire_time_us( uint32_t transactions, uint32_t bytes, uint32_t clockHz )
+{
+	uint64_t	clocks = (uint64_t)bytes * WIRE_CLOCKS_PER_BYTE + (uint64_t)transactions * WIRE_CLOCKS_PER_TRANSACTION;
+
+	return( (double)clocks * 1000000.0 / clockHz );
+}
+
+
+//**************************************************************************
+//	read_baseline
+//--------------------------------------------------------------------------
+//
+static bool read_baseline( const char *strFile )
+{
+	FILE	*pFile = fopen( strFile, "r" );
+	char	 strLine[ 128 ];
+
+	if( NULL == pFile )
+	{
+		printf( "baseline %s could not be opened\n", strFile );
+
+		return( false );
+	}
+
+	while( (BENCH_MAX_BASELINE > g_baselineCount) && (NULL != fgets( strLine, sizeof( strLine ), pFile )) )
+	{
+		bench_baseline_t	*pBase = &g_arBaseline[ g_baselineCount ];
+
+		if( '#' == strLine[ 0 ] )
+		{
+			continue;
+		}
+
+		if( 4 == sscanf( strLine, "%39s %9s %u %u", pBase->strName, pBase->strChip, &pBase->transactions, &pBase->bytes ) )
+		{
+			g_baselineCount++;
+		}
+	}
+
+	fclose( pFile );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	find_baseline
+//--------------------------------------------------------------------------
+//
+static const bench_baseline_t *find_baseline( const char *strName, const char *strChip )
+{
+	for( int idx = 0 ; g_baselineCount > idx ; idx++ )
+	{
+		if( (0 == strcmp( g_arBaseline[ idx ].strName, strName )) && (0 == strcmp( g_arBaseline[ idx ].strChip, strChip )) )
+		{
+			return( &g_arBaseline[ idx ] );
+		}
+	}
+
+	return( NULL );
+}
+
+
+//**************************************************************************
+//	bench_traffic
+//--------------------------------------------------------------------------
+//	bus traffic of one scenario on the emulated bus
+//
+static void bench_traffic( const bench_scenario_t *pScenario, chip_type_t chipType, uint32_t *pTransactions, uint32_t *pBytes )
+{
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	oled_display_init_transport( &g_Display, &g_oledEmuTransport, &g_Bus, chipType, DISPLAY_ADDRESS_ONE );
+	pScenario->pPrepare( &g_Display );
+
+	oled_emu_bus_reset_stats( &g_Bus );
+	pScenario->pRun( &g_Display );
+
+	*pTransactions	= g_Bus.transactions;
+	*pBytes			= g_Bus.bytes + g_Bus.transactions;		//	address bytes
+}
+
+
+//**************************************************************************
+//	bench_cpu
+//--------------------------------------------------------------------------
+//	CPU time of one scenario in ns (average), nothing is send
+//
+static uint64_t bench_cpu( const bench_scenario_t *pScenario, chip_type_t chipType )
+{
+	uint64_t	ullTotal = 0;
+
+	for( int loop = 0 ; BENCH_CPU_LOOPS > loop ; loop++ )
+	{
+		oled_display_init_transport( &g_Display, &g_NullTransport, NULL, chipType, DISPLAY_ADDRESS_ONE );
+		pScenario->pPrepare( &g_Display );
+
+		uint64_t	ullStart = cpu_time_ns();
+
+		pScenario->pRun( &g_Display );
+
+		ullTotal += cpu_time_ns() - ullStart;
+	}
+
+	return( ullTotal / BENCH_CPU_LOOPS );
+}
+
+
+//**************************************************************************
+//	bench_glyph
+//--------------------------------------------------------------------------
+//	CPU time of one character of the given lines (16 characters each)
+//	in ns and cycles (average), nothing is send
+//
+static void bench_glyph( chip_type_t chipType, const char **pLines, double *pNs, double *pCycles )
+{
+	uint64_t	ullStart;
+	uint64_t	ullStartCycles;
+	uint8_t		usLines;
+
+	oled_display_init_transport( &g_Display, &g_NullTransport, NULL, chipType, DISPLAY_ADDRESS_ONE );
+	oled_display_set_print_mode( &g_Display, PM_OVERWRITE_SAME_LINE );
+
+	usLines			= oled_display_max_text_lines( &g_Display );
+	ullStart		= cpu_time_ns();
+	ullStartCycles	= cpu_cycles();
+
+	for( int loop = 0 ; BENCH_GLYPH_LOOPS > loop ; loop++ )
+	{
+		oled_display_set_cursor( &g_Display, loop % usLines, 0 );
+		oled_display_print( &g_Display, pLines[ (loop / usLines) & 1 ] );
+	}
+
+	*pCycles	= (double)(cpu_cycles() - ullStartCycles) / (BENCH_GLYPH_LOOPS * 16.0);
+	*pNs		= (double)(cpu_time_ns() - ullStart) / (BENCH_GLYPH_LOOPS * 16.0);
+}
+
+
+//**************************************************************************
+//	draw_fill, draw_line, draw_circle
+//--------------------------------------------------------------------------
+//	shapes for bench_draw(), different positions with every loop
+//
+static void draw_fill( int loop )
+{
+	oled_display_fill_rect( &g_Display, loop & 31, 3 + (loop & 15), 64, 32, PIXEL_XOR );
+}
+
+static void draw_line( int loop )
+{
+	oled_display_draw_line( &g_Display, 0, loop & 15, 127, 63 - (loop & 15), PIXEL_XOR );
+}
+
+static void draw_circle( int loop )
+{
+	oled_display_draw_circle( &g_Display, 64 + (loop & 7), 32, 30, PIXEL_XOR );
+}
+
+
+//**************************************************************************
+//	bench_draw
+//--------------------------------------------------------------------------
+//	CPU time of one shape drawn into the frame buffer in ns and cycles
+//	(average), nothing is send
+//
+static void bench_draw( chip_type_t chipType, void (*pDraw)( int loop ), double *pNs, double *pCycles )
+{
+	uint64_t	ullStart;
+	uint64_t	ullStartCycles;
+
+	oled_display_init_transport( &g_Display, &g_NullTransport, NULL, chipType, DISPLAY_ADDRESS_ONE );
+	oled_display_set_frame_buffer( &g_Display, &g_FrameBuffer );
+
+	ullStart		= cpu_time_ns();
+	ullStartCycles	= cpu_cycles();
+
+	for( int loop = 0 ; BENCH_GLYPH_LOOPS > loop ; loop++ )
+	{
+		pDraw( loop );
+	}
+
+	*pCycles	= (double)(cpu_cycles() - ullStartCycles) / BENCH_GLYPH_LOOPS;
+	*pNs		= (double)(cpu_time_ns() - ullStart) / BENCH_GLYPH_LOOPS;
+
+	oled_display_set_frame_buffer( &g_Display, NULL );
+}
+
+
+//**************************************************************************
+//	bench_font
+//--------------------------------------------------------------------------
+//	CPU time of one line printed with a proportional font (NULL: 8x8
+//	font) in the given scale in ns and per character in ns and cycles
+//	(average), nothing is send
+//
+static void bench_font( chip_type_t chipType, const oled_font_t *pFont, uint8_t scale, double *pLineNs, double *pNs, double *pCycles )
+{
+	uint64_t	ullStart;
+	uint64_t	ullStartCycles;
+	uint32_t	ulChars = 0;
+
+	oled_display_init_transport( &g_Display, &g_NullTransport, NULL, chipType, DISPLAY_ADDRESS_ONE );
+
+	ullStart		= cpu_time_ns();
+	ullStartCycles	= cpu_cycles();
+
+	for( int loop = 0 ; BENCH_GLYPH_LOOPS > loop ; loop++ )
+	{
+		oled_display_print_scaled( &g_Display, pFont, scale, loop & 7, 0, g_arstrFontLine[ loop & 1 ] );
+
+		ulChars += strlen( g_arstrFontLine[ loop & 1 ] );
+	}
+
+	*pCycles	= (double)(cpu_cycles() - ullStartCycles) / ulChars;
+	*pNs		= (double)(cpu_time_ns() - ullStart) / ulChars;
+	*pLineNs	= *pNs * ulChars / BENCH_GLYPH_LOOPS;
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	const char	*arstrChip[]		= { "sh1106", "ssd1306" };
+	const char	*strWriteBaseline	= NULL;
+	FILE		*pWriteFile			= NULL;
+	int			 regressions		= 0;
+
+
+	for( int idx = 1 ; argc > idx ; idx++ )
+	{
+		if( (0 == strcmp( argv[ idx ], "--baseline" )) && (argc > (idx + 1)) )
+		{
+			if( !read_baseline( argv[ ++idx ] ) )
+			{
+				return( 1 );
+			}
+		}
+		else if( (0 == strcmp( argv[ idx ], "--write-baseline" )) && (argc > (idx + 1)) )
+		{
+			strWriteBaseline = argv[ ++idx ];
+		}
+	}
+
+	if( NULL != strWriteBaseline )
+	{
+		pWriteFile = fopen( strWriteBaseline, "w" );
+
+		if( NULL == pWriteFile )
+		{
+			printf( "baseline %s could not be written\n", strWriteBaseline );
+
+			return( 1 );
+		}
+
+		fprintf( pWriteFile, "# scenario chip transactions bytes\n" );
+	}
+
+	printf(	"%-22s %-8s %6s %7s %10s %10s %10s %9s\n",
+			"scenario", "chip", "trans", "bytes", "100kHz us", "400kHz us", "1MHz us", "cpu ns"	);
+
+	for( int chip = BENCH_FIRST_CHIP ; BENCH_LAST_CHIP >= chip ; chip++ )
+	{
+		for( size_t idx = 0 ; BENCH_SCENARIOS > idx ; idx++ )
+		{
+			const bench_scenario_t	*pScenario = &g_arScenario[ idx ];
+			const bench_baseline_t	*pBase;
+			uint32_t				 transactions;
+			uint32_t				 bytes;
+			uint64_t				 ullCpu;
+
+			bench_traffic( pScenario, (chip_type_t)chip, &transactions, &bytes );
+			ullCpu = bench_cpu( pScenario, (chip_type_t)chip );
+
+			printf(	"%-22s %-8s %6u %7u %10.0f %10.0f %10.0f %9u",
+					pScenario->strName,
+					arstrChip[ chip ],
+					(unsigned)transactions,
+					(unsigned)bytes,
+					wire_time_us( transactions, bytes, 100000 ),
+					wire_time_us( transactions, bytes, 400000 ),
+					wire_time_us( transactions, bytes, 1000000 ),
+					(unsigned)ullCpu												);
+
+			pBase = find_baseline( pScenario->strName, arstrChip[ chip ] );
+
+			if( (NULL != pBase) && ((pBase->transactions < transactions) || (pBase->bytes < bytes)) )
+			{
+				printf( "   REGRESSION (baseline: %u / %u)", (unsigned)pBase->transactions, (unsigned)pBase->bytes );
+
+				regressions++;
+			}
+
+			printf( "\n" );
+
+			if( NULL != pWriteFile )
+			{
+				fprintf( pWriteFile, "%s %s %u %u\n", pScenario->strName, arstrChip[ chip ], (unsigned)transactions, (unsigned)bytes );
+			}
+		}
+	}
+
+	printf( "\n%-22s %-8s %9s %9s\n", "glyph", "chip", "cpu ns", "cycles" );
+
+	for( int chip = BENCH_FIRST_CHIP ; BENCH_LAST_CHIP >= chip ; chip++ )
+	{
+		double	ns;
+		double	cycles;
+
+		bench_glyph( (chip_type_t)chip, g_arstrGlyphLine, &ns, &cycles );
+		printf( "%-22s %-8s %9.1f %9.0f\n", "print (per char)", arstrChip[ chip ], ns, cycles );
+
+		bench_glyph( (chip_type_t)chip, g_arstrUtf8Line, &ns, &cycles );
+		printf( "%-22s %-8s %9.1f %9.0f\n", "print utf8 (per char)", arstrChip[ chip ], ns, cycles );
+	}
+
+	printf( "\n%-22s %-8s %9s %9s %9s\n", "proportional font", "chip", "line ns", "char ns", "cycles" );
+
+	for( int chip = BENCH_FIRST_CHIP ; BENCH_LAST_CHIP >= chip ; chip++ )
+	{
+		double	lineNs;
+		double	ns;
+		double	cycles;
+
+		bench_font( (chip_type_t)chip, &g_oledFont5x7, 1, &lineNs, &ns, &cycles );
+		printf( "%-22s %-8s %9.0f %9.1f %9.0f\n", "print_font 5x7", arstrChip[ chip ], lineNs, ns, cycles );
+
+		bench_font( (chip_type_t)chip, &g_oledFont3x5, 1, &lineNs, &ns, &cycles );
+		printf( "%-22s %-8s %9.0f %9.1f %9.0f\n", "print_font 3x5", arstrChip[ chip ], lineNs, ns, cycles );
+
+		bench_font( (chip_type_t)chip, NULL, 2, &lineNs, &ns, &cycles );
+		printf( "%-22s %-8s %9.0f %9.1f %9.0f\n", "print_scaled 8x8 2x", arstrChip[ chip ], lineNs, ns, cycles );
+
+		bench_font( (chip_type_t)chip, &g_oledFont5x7, 4, &lineNs, &ns, &cycles );
+		printf( "%-22s %-8s %9.0f %9.1f %9.0f\n", "print_scaled 5x7 4x", arstrChip[ chip ], lineNs, ns, cycles );
+	}
+
+	printf( "\n%-22s %-8s %9s %9s\n", "frame buffer drawing", "chip", "cpu ns", "cycles" );
+
+	for( int chip = BENCH_FIRST_CHIP ; BENCH_LAST_CHIP >= chip ; chip++ )
+	{
+		double	ns;
+		double	cycles;
+
+		bench_draw( (chip_type_t)chip, draw_fill, &ns, &cycles );
+		printf( "%-22s %-8s %9.1f %9.0f\n", "fill_rect 64x32", arstrChip[ chip ], ns, cycles );
+
+		bench_draw( (chip_type_t)chip, draw_line, &ns, &cycles );
+		printf( "%-22s %-8s %9.1f %9.0f\n", "line 128 columns", arstrChip[ chip ], ns, cycles );
+
+		bench_draw( (chip_type_t)chip, draw_circle, &ns, &cycles );
+		printf( "%-22s %-8s %9.1f %9.0f\n", "circle radius 30", arstrChip[ chip ], ns, cycles );
+	}
+
+	if( NULL != pWriteFile )
+	{
+		fclose( pWriteFile );
+	}
+
+	if( 0 < regressions )
+	{
+		printf( "\n%d scenario(s) exceed the baseline\n", regressions );
+
+		return( 1 );
+	}
+
+	return( 0 );
+}
@@ -0,0 +1,368 @@
+//##########################################################################
+//#
+//#		FontTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the proportional fonts (oled_display_print_font).
+//#
+//#	Three lines are filled with characters of the 8x8 font, then a text
+//#	is printed with a proportional font into the middle line. Every
+//#	pixel of the panel is checked: the columns of the text must show
+//#	the glyphs (decoded here bit by bit from the font tables), all
+//#	other pixels must not be changed. Without frame buffer the text
+//#	must be send as one data transaction with one byte per column.
+//#	This is done for both fonts (raw and packed columns), with and
+//#	without frame buffer, with the inverse font, for a text that is cut
+//#	at the end of the line and with asynchronous output.
+//#	At the end the number of characters per line is shown.
+//#
+//#	Usage:	FontTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+#include "oled_test.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_WIDTH					128
+#define TEST_LINE					2
+#define TEST_MIN_CHARS				25			//	per line with the small font
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct font_case
+{
+	const char			*strName;
+	const oled_font_t	*pFont;
+	chip_type_t			 chipType;
+	uint8_t				 x;
+	const char			*strText;
+	bool				 bFrameBuffer;
+	bool				 bInverse;
+	bool				 bAsync;
+
+} font_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const char	g_strLabel[]	= "Temp: 21.5 C  Hum: 45 %";
+const char	g_strAll[]		= " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+const char	g_strSentence[]	= "the quick brown fox jumps over the lazy dog";
+
+const font_case_t	g_arCase[] =
+	{
+		{ "5x7 sh1106",				&g_oledFont5x7,	CHIP_TYPE_SH1106,	  5,	g_strLabel,			false,	false,	false	},
+		{ "5x7 ssd1306",			&g_oledFont5x7,	CHIP_TYPE_SSD1306,	  0,	g_strLabel,			false,	false,	false	},
+		{ "3x5 sh1106",				&g_oledFont3x5,	CHIP_TYPE_SH1106,	 11,	g_strLabel,			false,	false,	false	},
+		{ "3x5 ssd1306 inverse",	&g_oledFont3x5,	CHIP_TYPE_SSD1306,	  3,	g_strLabel,			false,	true,	false	},
+		{ "5x7 frame buffer",		&g_oledFont5x7,	CHIP_TYPE_SH1106,	 17,	g_strLabel,			true,	true,	false	},
+		{ "3x5 frame buffer",		&g_oledFont3x5,	CHIP_TYPE_SSD1306,	  1,	g_strLabel,			true,	false,	false	},
+		{ "5x7 all characters",		&g_oledFont5x7,	CHIP_TYPE_SH1106,	  0,	g_strAll,			false,	false,	false	},
+		{ "3x5 all characters",		&g_oledFont3x5,	CHIP_TYPE_SSD1306,	  0,	g_strAll,			false,	false,	false	},
+		{ "3x5 cut",				&g_oledFont3x5,	CHIP_TYPE_SH1106,	100,	g_strSentence,		false,	true,	false	},
+		{ "5x7 async",				&g_oledFont5x7,	CHIP_TYPE_SH1106,	  7,	g_strSentence,		false,	false,	true	},
+		{ "3x5 async",				&g_oledFont3x5,	CHIP_TYPE_SSD1306,	  2,	g_strSentence,		false,	true,	true	}
+	};
+
+#define FONT_CASES		(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+oled_async_t			g_Async;
+
+oled_emu_snapshot_t		g_Before;
+uint8_t					g_arusExpected[ TEST_WIDTH ];
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	expected_columns
+//--------------------------------------------------------------------------
+//	the columns of the text from x up to the end of the line
+//	Returns the column after the text.
+//
+static uint8_t expected_columns( const font_case_t *pCase )
+{
+	const oled_font_t	*pFont	= pCase->pFont;
+	uint16_t			 x		= pCase->x;
+
+	for( const char *pText = pCase->strText ; 0x00 != *pText ; pText++ )
+	{
+		const oled_glyph_t	*pGlyph = &pFont->pGlyphs[ *pText - pFont->firstChar ];
+
+		for( uint8_t column = 0 ; (pGlyph->advance > column) && (TEST_WIDTH > x) ; column++, x++ )
+		{
+			g_arusExpected[ x ] = (pGlyph->width > column) ? oled_test_glyph_column( pFont, pGlyph, column ) : 0x00;
+
+			if( pCase->bInverse )
+			{
+				g_arusExpected[ x ] = ~g_arusExpected[ x ];
+			}
+		}
+	}
+
+	return( (uint8_t)x );
+}
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	display with three lines of 8x8 characters around the test line
+//
+static bool setup( const font_case_t *pCase )
+{
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	if( 0 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, pCase->chipType, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x64 ) )
+	{
+		return( false );
+	}
+
+	oled_display_set_frame_buffer( &g_Display, pCase->bFrameBuffer ? &g_FrameBuffer : NULL );
+	oled_display_set_print_mode( &g_Display, PM_OVERWRITE_SAME_LINE );
+
+	for( uint8_t usLine = TEST_LINE - 1 ; TEST_LINE + 1 >= usLine ; usLine++ )
+	{
+		oled_display_set_cursor( &g_Display, usLine, 0 );
+		oled_display_print( &g_Display, "#8x8-Font-Line-#" );
+	}
+
+	if( pCase->bFrameBuffer )
+	{
+		oled_display_flush( &g_Display );
+	}
+
+	oled_emu_snapshot( &g_Emulator, &g_Before );
+	oled_display_set_inverse_font( &g_Display, pCase->bInverse );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	check_panel
+//--------------------------------------------------------------------------
+//	the text in the columns x ... end - 1 of the test line, everything
+//	else as before
+//
+static bool check_panel( const font_case_t *pCase, uint8_t end )
+{
+	uint8_t	x;
+	uint8_t	y;
+
+	if( !oled_emu_compare_outside( &g_Emulator, &g_Before, pCase->x, TEST_LINE * 8, end - pCase->x, 8, &x, &y ) )
+	{
+		printf( "%s: pixel %u / %u is wrong\n", pCase->strName, x, y );
+
+		return( false );
+	}
+
+	for( y = TEST_LINE * 8 ; (TEST_LINE * 8 + 8) > y ; y++ )
+	{
+		for( x = pCase->x ; end > x ; x++ )
+		{
+			if( oled_emu_pixel( &g_Emulator, x, y ) != (0 != (g_arusExpected[ x ] & (1 << (y - TEST_LINE * 8)))) )
+			{
+				printf( "%s: pixel %u / %u is wrong\n", pCase->strName, x, y );
+
+				return( false );
+			}
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//
+static bool run_case( const font_case_t *pCase )
+{
+	uint8_t	usEnd;
+	uint8_t	usReturned;
+
+	if( !setup( pCase ) )
+	{
+		printf( "%s: init failed\n", pCase->strName );
+
+		return( false );
+	}
+
+	usEnd = expected_columns( pCase );
+
+	if( pCase->bAsync && (0 != oled_display_start_async( &g_Display, &g_Async, 5, NULL, NULL )) )
+	{
+		printf( "%s: render task could not be started\n", pCase->strName );
+
+		return( false );
+	}
+
+	oled_emu_bus_reset_stats( &g_Bus );
+	oled_emu_reset_stats( &g_Emulator );
+
+	usReturned = oled_display_print_font( &g_Display, pCase->pFont, TEST_LINE, pCase->x, pCase->strText );
+
+	if( pCase->bAsync )
+	{
+		oled_display_wait( &g_Display, portMAX_DELAY );
+		oled_display_stop_async( &g_Display );
+	}
+
+	if( usReturned != usEnd )
+	{
+		printf( "%s: returned column %u instead of %u\n", pCase->strName, usReturned, usEnd );
+
+		return( false );
+	}
+
+	if( !pCase->bFrameBuffer && !pCase->bAsync && ((usEnd - pCase->x) != g_Emulator.dataBytes || 2 < g_Bus.transactions) )
+	{
+		printf(	"%s: %u transactions with %u bytes display data for %u columns\n",
+				pCase->strName, (unsigned)g_Bus.transactions, (unsigned)g_Emulator.dataBytes, usEnd - pCase->x	);
+
+		return( false );
+	}
+
+	if( pCase->bFrameBuffer )
+	{
+		oled_display_flush( &g_Display );
+	}
+
+	if( !check_panel( pCase, usEnd ) )
+	{
+		return( false );
+	}
+
+	//----------------------------------------------------------------------
+	//	the 8x8 characters under the text must be send again
+	//
+	oled_display_set_inverse_font( &g_Display, false );
+	oled_display_set_cursor( &g_Display, TEST_LINE, 0 );
+	oled_display_print( &g_Display, "#8x8-Font-Line-#" );
+
+	if( pCase->bFrameBuffer )
+	{
+		oled_display_flush( &g_Display );
+	}
+
+	if( !check_panel( pCase, pCase->x ) )
+	{
+		printf( "%s: 8x8 characters not restored\n", pCase->strName );
+
+		return( false );
+	}
+
+	oled_display_set_frame_buffer( &g_Display, NULL );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	chars_per_line
+//--------------------------------------------------------------------------
+//	characters of the sentence that fit into one line
+//
+static uint8_t chars_per_line( const oled_font_t *pFont )
+{
+	char		strText[ 2 ]	= { 0x00, 0x00 };
+	uint8_t		usChars			= 0;
+	uint16_t	uiWidth			= 0;
+
+	for( ;; usChars++ )
+	{
+		strText[ 0 ] = g_strSentence[ usChars % (sizeof( g_strSentence ) - 1) ];
+
+		if( TEST_WIDTH < uiWidth + oled_font_text_width( pFont, strText ) - 1 )
+		{
+			return( usChars );
+		}
+
+		uiWidth += oled_font_text_width( pFont, strText );
+	}
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int		failures = 0;
+	uint8_t	usChars5x7;
+	uint8_t	usChars3x5;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; FONT_CASES > idx ; idx++ )
+	{
+		failures += run_case( &g_arCase[ idx ] ) ? 0 : 1;
+	}
+
+	usChars5x7 = chars_per_line( &g_oledFont5x7 );
+	usChars3x5 = chars_per_line( &g_oledFont3x5 );
+
+	printf( "characters per line (128 pixels): 8x8 16, 5x7 %u, 3x5 %u\n", usChars5x7, usChars3x5 );
+
+	if( TEST_MIN_CHARS > usChars3x5 )
+	{
+		printf( "only %u characters per line with the small font\n", usChars3x5 );
+
+		failures++;
+	}
+
+	printf( "FontTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
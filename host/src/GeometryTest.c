@@ -0,0 +1,398 @@
+//##########################################################################
+//#
+//#		GeometryTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the library with the different panel geometries.
+//#
+//#	For every panel the same text is printed twice:
+//#	-	on the display under test with scrolling, with frame buffer
+//#		and flipped
+//#	-	on a reference display line by line without scrolling
+//#	and the pixels of both panels must be the same.
+//#	Clearing the display must not send anything to the pages that are
+//#	not shown on the panel.
+//#
+//#	Usage:	GeometryTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define GEOMETRY_EXTRA_LINES		3		//	lines printed more than shown
+#define RAM_POWER_ON_PATTERN		0x55
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	one panel: geometry for the library, wiring for the emulator
+//
+typedef struct geometry_case
+{
+	const char				*strName;
+	chip_type_t				 chipType;
+	const oled_geometry_t	*pGeometry;
+	uint8_t					 segmentOffset;
+	uint8_t					 comPins;
+
+} geometry_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const geometry_case_t	g_arCase[] =
+	{
+		{ "ssd1306 128x64",		CHIP_TYPE_SSD1306,	&g_oledGeometry128x64,		 0, 0x12 },
+		{ "ssd1306 128x32",		CHIP_TYPE_SSD1306,	&g_oledGeometry128x32,		 0, 0x02 },
+		{ "ssd1306 64x48",		CHIP_TYPE_SSD1306,	&g_oledGeometry64x48,		32, 0x12 },
+		{ "ssd1306 72x40",		CHIP_TYPE_SSD1306,	&g_oledGeometry72x40,		28, 0x12 },
+		{ "sh1106 128x64",		CHIP_TYPE_SH1106,	&g_oledGeometry128x64,		 2, 0x12 },
+		{ "sh1107 128x128",		CHIP_TYPE_SH1107,	&g_oledGeometry128x128,		 0, 0x12 }
+	};
+
+#define GEOMETRY_CASES		(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+
+oled_emu_bus_t			g_RefBus;
+oled_emu_t				g_RefEmulator;
+oled_display_handle_t	g_RefDisplay;
+
+oled_frame_buffer_t		g_FrameBuffer;
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	connect the panel of the case to an emulator and initialize the
+//	display with the geometry of the case
+//
+static uint8_t setup( const geometry_case_t *pCase, oled_emu_bus_t *pBus, oled_emu_t *pEmu, oled_display_handle_t *pDisplay )
+{
+	oled_emu_bus_init( pBus );
+	oled_emu_init( pEmu, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_set_panel( pEmu, pCase->pGeometry->width, pCase->pGeometry->height, pCase->segmentOffset, pCase->comPins );
+	oled_emu_bus_attach( pBus, pEmu );
+
+	return( oled_display_init_panel( pDisplay, &g_oledEmuTransport, pBus, pCase->chipType, DISPLAY_ADDRESS_ONE, pCase->pGeometry ) );
+}
+
+
+//**************************************************************************
+//	line_text
+//--------------------------------------------------------------------------
+//	the text of one printed line, it fills the complete line
+//
+static void line_text( char *strText, uint8_t columns, uint32_t line )
+{
+	snprintf( strText, columns + 1, "L%02u-ABCDEFGHIJKLMNOP", (unsigned)line );
+}
+
+
+//**************************************************************************
+//	print_reference
+//--------------------------------------------------------------------------
+//	print the last lines of the scrolled output line by line
+//
+static void print_reference( oled_display_handle_t *pDisplay, uint32_t lastLine )
+{
+	char	strText[ OLED_TEXT_COLUMNS + 1 ];
+	uint8_t	usLines		= oled_display_max_text_lines( pDisplay );
+	uint8_t	usColumns	= oled_display_max_column_lines( pDisplay );
+
+	oled_display_clear( pDisplay );
+
+	for( uint8_t idx = 0 ; usLines > idx ; idx++ )
+	{
+		line_text( strText, usColumns, lastLine + 1 + idx - usLines );
+		oled_display_set_cursor( pDisplay, idx, 0 );
+		oled_display_print( pDisplay, strText );
+	}
+}
+
+
+//**************************************************************************
+//	print_scrolled
+//--------------------------------------------------------------------------
+//	print more lines than the panel shows, so the display scrolls
+//	(the last line stays in the cursor line)
+//
+static uint32_t print_scrolled( oled_display_handle_t *pDisplay, uint32_t firstLine )
+{
+	char		strText[ OLED_TEXT_COLUMNS + 1 ];
+	uint8_t		usLines		= oled_display_max_text_lines( pDisplay );
+	uint8_t		usColumns	= oled_display_max_column_lines( pDisplay );
+	uint32_t	line		= firstLine;
+
+	for( ; (firstLine + usLines + GEOMETRY_EXTRA_LINES) > line ; line++ )
+	{
+		line_text( strText, usColumns, line );
+
+		if( (firstLine + usLines + GEOMETRY_EXTRA_LINES - 1) > line )
+		{
+			oled_display_println( pDisplay, strText );
+		}
+		else
+		{
+			oled_display_print( pDisplay, strText );
+		}
+	}
+
+	return( line - 1 );
+}
+
+
+//**************************************************************************
+//	compare_panel
+//--------------------------------------------------------------------------
+//	both panels must show the same pixels and something must be shown
+//
+static bool compare_panel( const char *strCase, const char *strStep )
+{
+	uint32_t	ulPixels = 0;
+
+	for( uint8_t y = 0 ; g_Emulator.panelHeight > y ; y++ )
+	{
+		for( uint8_t x = 0 ; g_Emulator.panelWidth > x ; x++ )
+		{
+			bool	bOn = oled_emu_pixel( &g_Emulator, x, y );
+
+			if( bOn != oled_emu_pixel( &g_RefEmulator, x, y ) )
+			{
+				printf( "%-16s %-24s FAILED (pixel %u / %u)\n", strCase, strStep, x, y );
+
+				oled_emu_dump( &g_Emulator, stdout );
+				printf( "\n" );
+				oled_emu_dump( &g_RefEmulator, stdout );
+
+				return( false );
+			}
+
+			ulPixels += bOn ? 1 : 0;
+		}
+	}
+
+	if( 0 == ulPixels )
+	{
+		printf( "%-16s %-24s FAILED (panel is blank)\n", strCase, strStep );
+
+		return( false );
+	}
+
+	printf( "%-16s %-24s ok\n", strCase, strStep );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	check_mapping
+//--------------------------------------------------------------------------
+//	the reference display is neither scrolled nor flipped, so every pixel
+//	of its panel must show the RAM bit at the same position (shifted by
+//	the first segment of the panel), otherwise the multiplex ratio, the
+//	COM pins or the column offset do not fit the panel
+//
+static bool check_mapping( const geometry_case_t *pCase )
+{
+	for( uint8_t y = 0 ; g_RefEmulator.panelHeight > y ; y++ )
+	{
+		for( uint8_t x = 0 ; g_RefEmulator.panelWidth > x ; x++ )
+		{
+			uint8_t	usByte	= g_RefEmulator.ram[ y >> 3 ][ x + pCase->segmentOffset ];
+			bool	bRam	= 0 != (usByte & (1 << (y & 0x07)));
+
+			if( bRam != oled_emu_pixel( &g_RefEmulator, x, y ) )
+			{
+				printf( "%-16s %-24s FAILED (pixel %u / %u)\n", pCase->strName, "panel mapping", x, y );
+
+				return( false );
+			}
+		}
+	}
+
+	printf( "%-16s %-24s ok\n", pCase->strName, "panel mapping" );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	check_invisible_pages
+//--------------------------------------------------------------------------
+//	after init and clear the pages below the panel still hold the power
+//	on pattern, i.e. nothing has been send to them
+//
+static bool check_invisible_pages( const geometry_case_t *pCase, uint32_t ulDataBytes )
+{
+	uint8_t		usPages		= pCase->pGeometry->height / 8;
+	uint32_t	ulExpected	= usPages * ((CHIP_TYPE_SSD1306 == pCase->chipType) ? pCase->pGeometry->width : g_Emulator.ramColumns);
+
+	for( uint8_t usPage = usPages ; g_Emulator.ramPages > usPage ; usPage++ )
+	{
+		for( uint8_t usColumn = 0 ; g_Emulator.ramColumns > usColumn ; usColumn++ )
+		{
+			if( RAM_POWER_ON_PATTERN != g_Emulator.ram[ usPage ][ usColumn ] )
+			{
+				printf( "%-16s %-24s FAILED (page %u written)\n", pCase->strName, "invisible pages", usPage );
+
+				return( false );
+			}
+		}
+	}
+
+	if( ulExpected != ulDataBytes )
+	{
+		printf(	"%-16s %-24s FAILED (%u data bytes, expected %u)\n",
+				pCase->strName, "clear", (unsigned)ulDataBytes, (unsigned)ulExpected	);
+
+		return( false );
+	}
+
+	printf( "%-16s %-24s ok     (%u data bytes)\n", pCase->strName, "clear", (unsigned)ulDataBytes );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//
+static bool run_case( const geometry_case_t *pCase )
+{
+	uint32_t	lastLine;
+	uint32_t	ulDataBytes;
+	bool		bOk;
+
+
+	if( (0 != setup( pCase, &g_Bus, &g_Emulator, &g_Display )) || (0 != setup( pCase, &g_RefBus, &g_RefEmulator, &g_RefDisplay )) )
+	{
+		printf( "%-16s %-24s FAILED\n", pCase->strName, "init" );
+
+		return( false );
+	}
+
+	//------------------------------------------------------------------
+	//	clear only the visible pages
+	//
+	oled_emu_bus_reset_stats( &g_Bus );
+	oled_display_clear( &g_Display );
+	ulDataBytes = g_Emulator.dataBytes;
+
+	bOk = check_invisible_pages( pCase, ulDataBytes );
+
+	//------------------------------------------------------------------
+	//	direct output with scrolling
+	//
+	oled_display_set_print_mode( &g_Display, PM_SCROLL_LINE );
+
+	lastLine = print_scrolled( &g_Display, 0 );
+	print_reference( &g_RefDisplay, lastLine );
+
+	bOk = check_mapping( pCase ) && bOk;
+	bOk = compare_panel( pCase->strName, "scroll" ) && bOk;
+
+	//------------------------------------------------------------------
+	//	the same with frame buffer
+	//
+	oled_display_set_frame_buffer( &g_Display, &g_FrameBuffer );
+
+	oled_emu_bus_reset_stats( &g_Bus );
+	lastLine = print_scrolled( &g_Display, 50 );
+	oled_display_flush( &g_Display );
+	print_reference( &g_RefDisplay, lastLine );
+
+	bOk = compare_panel( pCase->strName, "frame buffer scroll" ) && bOk;
+
+	//------------------------------------------------------------------
+	//	flipped, the content must stay on the panel
+	//
+	oled_display_flip( &g_Display, true );
+	oled_display_set_frame_buffer( &g_Display, NULL );
+	oled_display_flip( &g_RefDisplay, true );
+	print_reference( &g_RefDisplay, lastLine );
+
+	bOk = compare_panel( pCase->strName, "flip" ) && bOk;
+
+	return( bOk );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	oled_geometry_t	tooWide		= { 136, 64, 0, 0x12 };
+	bool			bOk			= true;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; GEOMETRY_CASES > idx ; idx++ )
+	{
+		bOk = run_case( &g_arCase[ idx ] ) && bOk;
+	}
+
+	//------------------------------------------------------------------
+	//	geometries the chip can not drive
+	//
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, CHIP_TYPE_SSD1306, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	if(		(3 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, CHIP_TYPE_SSD1306, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x128 ))
+		||	(3 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, CHIP_TYPE_SH1106, DISPLAY_ADDRESS_ONE, &tooWide ))
+		||	(0 != g_Bus.transactions) )
+	{
+		printf( "%-16s %-24s FAILED\n", "unsupported", "init" );
+
+		bOk = false;
+	}
+	else
+	{
+		printf( "%-16s %-24s ok\n", "unsupported", "init" );
+	}
+
+	return( bOk ? 0 : 1 );
+}
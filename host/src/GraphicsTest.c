@@ -0,0 +1,541 @@
+//##########################################################################
+//#
+//#		GraphicsTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the drawing functions of the frame buffer.
+//#
+//#	The display is filled with text, then a list of shapes (pixels,
+//#	spans, lines, rectangles, filled rectangles and circles) is drawn
+//#	with all pixel operations, many of them partly outside of the panel.
+//#	The same shapes are drawn pixel by pixel into a reference image.
+//#	After the flush every pixel of the panel must show the reference.
+//#	This is done on different panels, after the display was scrolled
+//#	and with asynchronous output.
+//#	A drawing must only mark the pages it changed, so the flush sends
+//#	only these columns, and without frame buffer nothing may be send.
+//#
+//#	Usage:	GraphicsTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_MAX_WIDTH				128
+#define TEST_MAX_HEIGHT				64
+#define TEST_SCROLLED_LINES			3
+
+//----	shapes of the list  --------------------------------------------
+#define SHAPE_PIXEL					1		//	x, y
+#define SHAPE_HLINE					2		//	x, y, width
+#define SHAPE_VLINE					3		//	x, y, height
+#define SHAPE_LINE					4		//	x0, y0, x1, y1
+#define SHAPE_RECT					5		//	x, y, width, height
+#define SHAPE_FILL					6		//	x, y, width, height
+#define SHAPE_CIRCLE				7		//	x, y, radius
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct shape
+{
+	uint8_t		type;
+	int16_t		arCoord[ 4 ];
+	pixel_op_t	op;
+
+} shape_t;
+
+//----------------------------------------------------------------------
+//	one panel: geometry for the library, wiring for the emulator
+//
+typedef struct graphics_case
+{
+	const char				*strName;
+	chip_type_t				 chipType;
+	const oled_geometry_t	*pGeometry;
+	uint8_t					 segmentOffset;
+	uint8_t					 comPins;
+	bool					 bScrolled;
+	bool					 bAsync;
+
+} graphics_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const shape_t	g_arShape[] =
+	{
+		{ SHAPE_FILL,	{  10,   3,  40,  20 },	PIXEL_SET	},
+		{ SHAPE_FILL,	{  20,   8,   8,   8 },	PIXEL_XOR	},
+		{ SHAPE_FILL,	{  -5,  -5,  10,  10 },	PIXEL_SET	},
+		{ SHAPE_FILL,	{  30,  12,  60,  40 },	PIXEL_CLEAR	},
+		{ SHAPE_FILL,	{ 100,  20,   0,  10 },	PIXEL_SET	},
+		{ SHAPE_RECT,	{   0,   0, 128,  64 },	PIXEL_XOR	},
+		{ SHAPE_RECT,	{  60,  10,  30,  25 },	PIXEL_SET	},
+		{ SHAPE_RECT,	{  70,  40,   1,   1 },	PIXEL_XOR	},
+		{ SHAPE_RECT,	{ 100,  20,   1,  15 },	PIXEL_XOR	},
+		{ SHAPE_RECT,	{  90,  50,  20,   2 },	PIXEL_XOR	},
+		{ SHAPE_HLINE,	{   0,  33, 128,   0 },	PIXEL_XOR	},
+		{ SHAPE_HLINE,	{ 120,  17,  50,   0 },	PIXEL_SET	},
+		{ SHAPE_VLINE,	{   5,   2,  60,   0 },	PIXEL_XOR	},
+		{ SHAPE_VLINE,	{  44, -20,  30,   0 },	PIXEL_CLEAR	},
+		{ SHAPE_LINE,	{   0,  63, 127,   0 },	PIXEL_XOR	},
+		{ SHAPE_LINE,	{ -20, -10, 150,  70 },	PIXEL_SET	},
+		{ SHAPE_LINE,	{  30,  50,  33,  10 },	PIXEL_XOR	},
+		{ SHAPE_LINE,	{ 126,   2, 100,   9 },	PIXEL_XOR	},
+		{ SHAPE_LINE,	{  90,  45,  90,  45 },	PIXEL_CLEAR	},
+		{ SHAPE_LINE,	{ 110,  30, 110,   5 },	PIXEL_XOR	},
+		{ SHAPE_LINE,	{  80,  27,  50,  27 },	PIXEL_XOR	},
+		{ SHAPE_CIRCLE,	{  64,  32,  20,   0 },	PIXEL_XOR	},
+		{ SHAPE_CIRCLE,	{ 120,  60,  15,   0 },	PIXEL_SET	},
+		{ SHAPE_CIRCLE,	{  40,  30,   0,   0 },	PIXEL_XOR	},
+		{ SHAPE_CIRCLE,	{  10,  50,   7,   0 },	PIXEL_CLEAR	},
+		{ SHAPE_CIRCLE,	{  25,  20,   5,   0 },	PIXEL_XOR	},
+		{ SHAPE_PIXEL,	{ 127,  63,   0,   0 },	PIXEL_XOR	},
+		{ SHAPE_PIXEL,	{ 128,   0,   0,   0 },	PIXEL_SET	},
+		{ SHAPE_PIXEL,	{   3,   3,   0,   0 },	PIXEL_CLEAR	},
+		{ SHAPE_PIXEL,	{  64,  31,   0,   0 },	PIXEL_XOR	}
+	};
+
+#define SHAPES			(sizeof( g_arShape ) / sizeof( g_arShape[ 0 ] ))
+
+const graphics_case_t	g_arCase[] =
+	{
+		{ "sh1106 128x64",			CHIP_TYPE_SH1106,	&g_oledGeometry128x64,	 2, 0x12,	false,	false	},
+		{ "ssd1306 128x64",			CHIP_TYPE_SSD1306,	&g_oledGeometry128x64,	 0, 0x12,	false,	false	},
+		{ "ssd1306 128x32",			CHIP_TYPE_SSD1306,	&g_oledGeometry128x32,	 0, 0x02,	false,	false	},
+		{ "ssd1306 64x48",			CHIP_TYPE_SSD1306,	&g_oledGeometry64x48,	32, 0x12,	false,	false	},
+		{ "sh1106 scrolled",		CHIP_TYPE_SH1106,	&g_oledGeometry128x64,	 2, 0x12,	true,	false	},
+		{ "ssd1306 scrolled",		CHIP_TYPE_SSD1306,	&g_oledGeometry128x64,	 0, 0x12,	true,	false	},
+		{ "sh1106 async",			CHIP_TYPE_SH1106,	&g_oledGeometry128x64,	 2, 0x12,	false,	true	}
+	};
+
+#define GRAPHICS_CASES	(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+oled_async_t			g_Async;
+
+const graphics_case_t	*g_pCase;
+bool					 g_arbExpected[ TEST_MAX_HEIGHT ][ TEST_MAX_WIDTH ];
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	ref_pixel
+//--------------------------------------------------------------------------
+//	one pixel of the reference image, pixels outside of the panel are
+//	skipped
+//
+static void ref_pixel( int32_t x, int32_t y, pixel_op_t op )
+{
+	if(		(0 > x) || (g_pCase->pGeometry->width <= x)
+		||	(0 > y) || (g_pCase->pGeometry->height <= y) )
+	{
+		return;
+	}
+
+	switch( op )
+	{
+		case PIXEL_SET:		g_arbExpected[ y ][ x ] = true;						break;
+		case PIXEL_CLEAR:	g_arbExpected[ y ][ x ] = false;					break;
+		case PIXEL_XOR:		g_arbExpected[ y ][ x ] = !g_arbExpected[ y ][ x ];	break;
+	}
+}
+
+
+//**************************************************************************
+//	ref_shape
+//--------------------------------------------------------------------------
+//	Draw the shape pixel by pixel into the reference image. Every pixel
+//	of a rectangle is checked if it is on the border, the pixels of a
+//	circle are collected in a hit map first, so every pixel is changed
+//	once.
+//
+static void ref_shape( const shape_t *pShape )
+{
+	static bool	arbHit[ TEST_MAX_HEIGHT + 64 ][ TEST_MAX_WIDTH + 64 ];
+	int32_t		x0	= pShape->arCoord[ 0 ];
+	int32_t		y0	= pShape->arCoord[ 1 ];
+	int32_t		c	= pShape->arCoord[ 2 ];
+	int32_t		d	= pShape->arCoord[ 3 ];
+	int32_t		dx;
+	int32_t		dy;
+	int32_t		error;
+	int32_t		error2;
+
+	switch( pShape->type )
+	{
+		case SHAPE_PIXEL:
+			ref_pixel( x0, y0, pShape->op );
+			break;
+
+		case SHAPE_HLINE:
+		case SHAPE_VLINE:
+		case SHAPE_FILL:
+		case SHAPE_RECT:
+			if( SHAPE_HLINE == pShape->type )
+			{
+				d = 1;
+			}
+			else if( SHAPE_VLINE == pShape->type )
+			{
+				d = c;
+				c = 1;
+			}
+
+			for( int32_t y = y0 ; (y0 + d) > y ; y++ )
+			{
+				for( int32_t x = x0 ; (x0 + c) > x ; x++ )
+				{
+					if(		(SHAPE_RECT != pShape->type)
+						||	(x0 == x) || ((x0 + c - 1) == x) || (y0 == y) || ((y0 + d - 1) == y) )
+					{
+						ref_pixel( x, y, pShape->op );
+					}
+				}
+			}
+			break;
+
+		case SHAPE_LINE:
+			dx		= (x0 < c) ? (c - x0) : (x0 - c);
+			dy		= (y0 < d) ? (y0 - d) : (d - y0);
+			error	= dx + dy;
+
+			for( ;; )
+			{
+				ref_pixel( x0, y0, pShape->op );
+
+				if( (x0 == c) && (y0 == d) )
+				{
+					break;
+				}
+
+				error2 = 2 * error;
+
+				if( error2 >= dy )
+				{
+					error	+= dy;
+					x0		+= (x0 < c) ? 1 : -1;
+				}
+
+				if( error2 <= dx )
+				{
+					error	+= dx;
+					y0		+= (y0 < d) ? 1 : -1;
+				}
+			}
+			break;
+
+		case SHAPE_CIRCLE:
+			//--------------------------------------------------------------
+			//	one octant, mirrored into a hit map around the center
+			//
+			memset( arbHit, 0, sizeof( arbHit ) );
+
+			dx		= c;
+			dy		= 0;
+			error	= 1 - c;
+
+			while( dx >= dy )
+			{
+				for( int32_t mirror = 0 ; 8 > mirror ; mirror++ )
+				{
+					int32_t	px = (mirror & 4) ? dy : dx;
+					int32_t	py = (mirror & 4) ? dx : dy;
+
+					px = (mirror & 1) ? -px : px;
+					py = (mirror & 2) ? -py : py;
+
+					arbHit[ 32 + py + c ][ 32 + px + c ] = true;
+				}
+
+				dy++;
+
+				if( 0 > error )
+				{
+					error += 2 * dy + 1;
+				}
+				else
+				{
+					dx--;
+					error += 2 * (dy - dx) + 1;
+				}
+			}
+
+			for( int32_t y = 0 ; (2 * c + 1) > y ; y++ )
+			{
+				for( int32_t x = 0 ; (2 * c + 1) > x ; x++ )
+				{
+					if( arbHit[ 32 + y ][ 32 + x ] )
+					{
+						ref_pixel( x0 - c + x, y0 - c + y, pShape->op );
+					}
+				}
+			}
+			break;
+	}
+}
+
+
+//**************************************************************************
+//	draw_shape
+//--------------------------------------------------------------------------
+//	the shape with the drawing functions of the library
+//
+static void draw_shape( const shape_t *pShape )
+{
+	const int16_t	*pCoord = pShape->arCoord;
+
+	switch( pShape->type )
+	{
+		case SHAPE_PIXEL:	oled_display_draw_pixel( &g_Display, pCoord[ 0 ], pCoord[ 1 ], pShape->op );							break;
+		case SHAPE_HLINE:	oled_display_draw_hline( &g_Display, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pShape->op );				break;
+		case SHAPE_VLINE:	oled_display_draw_vline( &g_Display, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pShape->op );				break;
+		case SHAPE_LINE:	oled_display_draw_line( &g_Display, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pCoord[ 3 ], pShape->op );	break;
+		case SHAPE_RECT:	oled_display_draw_rect( &g_Display, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pCoord[ 3 ], pShape->op );	break;
+		case SHAPE_FILL:	oled_display_fill_rect( &g_Display, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pCoord[ 3 ], pShape->op );	break;
+		case SHAPE_CIRCLE:	oled_display_draw_circle( &g_Display, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pShape->op );				break;
+	}
+}
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	display with frame buffer and text on all lines
+//
+static bool setup( const graphics_case_t *pCase )
+{
+	char	strText[ OLED_TEXT_COLUMNS + 1 ];
+	uint8_t	usLines;
+
+	g_pCase = pCase;
+
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_set_panel( &g_Emulator, pCase->pGeometry->width, pCase->pGeometry->height, pCase->segmentOffset, pCase->comPins );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	if( 0 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, pCase->chipType, DISPLAY_ADDRESS_ONE, pCase->pGeometry ) )
+	{
+		return( false );
+	}
+
+	oled_display_set_frame_buffer( &g_Display, &g_FrameBuffer );
+	oled_display_set_print_mode( &g_Display, PM_SCROLL_LINE );
+
+	usLines = oled_display_max_text_lines( &g_Display ) + (pCase->bScrolled ? TEST_SCROLLED_LINES : 0);
+
+	for( uint8_t usLine = 0 ; usLines > usLine ; usLine++ )
+	{
+		snprintf( strText, sizeof( strText ), "%u-Graphics-%c%c", usLine, 'A' + usLine, 'a' + usLine );
+		oled_display_print( &g_Display, strText );
+
+		if( (usLines - 1) > usLine )
+		{
+			oled_display_print( &g_Display, "\n" );
+		}
+	}
+
+	oled_display_flush( &g_Display );
+
+	for( uint8_t y = 0 ; pCase->pGeometry->height > y ; y++ )
+	{
+		for( uint8_t x = 0 ; pCase->pGeometry->width > x ; x++ )
+		{
+			g_arbExpected[ y ][ x ] = oled_emu_pixel( &g_Emulator, x, y );
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//
+static bool run_case( const graphics_case_t *pCase )
+{
+	if( !setup( pCase ) )
+	{
+		printf( "%s: init failed\n", pCase->strName );
+
+		return( false );
+	}
+
+	if( pCase->bAsync && (0 != oled_display_start_async( &g_Display, &g_Async, 5, NULL, NULL )) )
+	{
+		printf( "%s: render task could not be started\n", pCase->strName );
+
+		return( false );
+	}
+
+	for( size_t idx = 0 ; SHAPES > idx ; idx++ )
+	{
+		draw_shape( &g_arShape[ idx ] );
+		ref_shape( &g_arShape[ idx ] );
+	}
+
+	oled_display_flush( &g_Display );
+
+	if( pCase->bAsync )
+	{
+		oled_display_wait( &g_Display, portMAX_DELAY );
+		oled_display_stop_async( &g_Display );
+	}
+
+	for( uint8_t y = 0 ; pCase->pGeometry->height > y ; y++ )
+	{
+		for( uint8_t x = 0 ; pCase->pGeometry->width > x ; x++ )
+		{
+			if( oled_emu_pixel( &g_Emulator, x, y ) != g_arbExpected[ y ][ x ] )
+			{
+				printf( "%s: pixel %u / %u is wrong\n", pCase->strName, x, y );
+
+				return( false );
+			}
+		}
+	}
+
+	oled_display_set_frame_buffer( &g_Display, NULL );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_dirty_pages
+//--------------------------------------------------------------------------
+//	a drawing marks only its pages, the flush sends only the changed
+//	columns, without frame buffer nothing is drawn
+//
+static bool run_dirty_pages( void )
+{
+	if( !setup( &g_arCase[ 0 ] ) )
+	{
+		return( false );
+	}
+
+	oled_display_draw_pixel( &g_Display, 7, 20, PIXEL_XOR );
+
+	if( (1 << 2) != g_FrameBuffer.dirtyPages )
+	{
+		printf( "pixel: dirty pages 0x%04X\n", g_FrameBuffer.dirtyPages );
+
+		return( false );
+	}
+
+	oled_emu_reset_stats( &g_Emulator );
+	oled_display_flush( &g_Display );
+
+	if( 1 != g_Emulator.dataBytes )
+	{
+		printf( "pixel: %u bytes display data\n", (unsigned)g_Emulator.dataBytes );
+
+		return( false );
+	}
+
+	oled_display_draw_vline( &g_Display, 50, 5, 26, PIXEL_XOR );
+
+	if( 0x000F != g_FrameBuffer.dirtyPages )
+	{
+		printf( "vline: dirty pages 0x%04X\n", g_FrameBuffer.dirtyPages );
+
+		return( false );
+	}
+
+	oled_display_flush( &g_Display );
+	oled_display_draw_line( &g_Display, 10, 41, 30, 46, PIXEL_XOR );
+
+	if( (1 << 5) != g_FrameBuffer.dirtyPages )
+	{
+		printf( "line: dirty pages 0x%04X\n", g_FrameBuffer.dirtyPages );
+
+		return( false );
+	}
+
+	oled_display_flush( &g_Display );
+	oled_display_set_frame_buffer( &g_Display, NULL );
+
+	oled_emu_bus_reset_stats( &g_Bus );
+	oled_display_fill_rect( &g_Display, 0, 0, 128, 64, PIXEL_SET );
+	oled_display_draw_circle( &g_Display, 64, 32, 10, PIXEL_SET );
+
+	if( 0 != g_Bus.transactions )
+	{
+		printf( "drawing without frame buffer was send\n" );
+
+		return( false );
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; GRAPHICS_CASES > idx ; idx++ )
+	{
+		failures += run_case( &g_arCase[ idx ] ) ? 0 : 1;
+	}
+
+	failures += run_dirty_pages() ? 0 : 1;
+
+	printf( "GraphicsTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
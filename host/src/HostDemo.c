@@ -0,0 +1,193 @@
+//##########################################################################
+//#
+//#		HostDemo
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program runs the library on a Linux host against the emulated
+//#	display controllers and prints the bus traffic of the different
+//#	functions together with the resulting content of the panel.
+//#
+//#	Usage:	HostDemo [ssd1306|sh1106] [dump]
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const char g_strHello[]		= "Hello World !";
+const char g_strLongText[]	= "This text is longer than one line of the display";
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+
+const char *g_arstrStatsEntry[ OLED_STATS_ENTRIES ] =
+	{
+		"print", "clear", "clear_line", "set_cursor", "scroll", "flush", "other"
+	};
+
+
+//**************************************************************************
+//	print_stats
+//--------------------------------------------------------------------------
+//	print the bus traffic since the last call and reset the counters
+//
+static void print_stats( const char *strStep )
+{
+	printf(	"%-24s transactions: %5u  bytes: %6u  (commands: %5u  data: %6u)\n",
+			strStep,
+			(unsigned)g_Bus.transactions,
+			(unsigned)g_Bus.bytes,
+			(unsigned)g_Emulator.commandBytes,
+			(unsigned)g_Emulator.dataBytes									);
+
+	oled_emu_bus_reset_stats( &g_Bus );
+}
+
+
+//**************************************************************************
+//	print_display_stats
+//--------------------------------------------------------------------------
+//	print the bus statistics of the display itself
+//
+static void print_display_stats( void )
+{
+	oled_display_stats_t	stats;
+
+	oled_display_get_stats( &g_Display, &stats, true );
+
+	printf( "\n%-12s %6s %6s %7s %6s %8s %8s\n", "entry", "calls", "trans", "bytes", "fails", "cursor", "time us" );
+
+	for( int idx = 0 ; OLED_STATS_ENTRIES > idx ; idx++ )
+	{
+		printf(	"%-12s %6u %6u %7u %6u %8u %8u\n",
+				g_arstrStatsEntry[ idx ],
+				(unsigned)stats.entry[ idx ].calls,
+				(unsigned)stats.entry[ idx ].transactions,
+				(unsigned)stats.entry[ idx ].bytes,
+				(unsigned)(stats.entry[ idx ].failures + stats.entry[ idx ].timeouts),
+				(unsigned)stats.entry[ idx ].cursorWrites,
+				(unsigned)stats.entry[ idx ].timeUs							);
+	}
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	chip_type_t	chipType	= CHIP_TYPE_SSD1306;
+	bool		bDump		= false;
+
+
+	for( int idx = 1 ; argc > idx ; idx++ )
+	{
+		if( 0 == strcmp( argv[ idx ], "sh1106" ) )
+		{
+			chipType = CHIP_TYPE_SH1106;
+		}
+		else if( 0 == strcmp( argv[ idx ], "dump" ) )
+		{
+			bDump = true;
+		}
+	}
+
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, chipType, DISPLAY_ADDRESS_TWO );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+	host_i2c_attach_bus( I2C_NUM_0, &g_Bus );
+
+	printf( "SimpleOled Host Demo: chip type %s\n", (CHIP_TYPE_SSD1306 == chipType) ? "ssd1306" : "sh1106" );
+
+	if( 0 != oled_display_init( &g_Display, I2C_NUM_0, chipType, DISPLAY_ADDRESS_DEFAULT ) )
+	{
+		printf( "    ERROR: display not found !!\n" );
+
+		return( 1 );
+	}
+
+	print_stats( "init" );
+
+	oled_display_print( &g_Display, g_strHello );
+	print_stats( "print (13 chars)" );
+
+	oled_display_set_cursor( &g_Display, 2, 0 );
+	print_stats( "set_cursor" );
+
+	uint32_t ulAllocations = host_i2c_allocations();
+
+	oled_display_println( &g_Display, g_strLongText );
+	print_stats( "println (48 chars)" );
+
+	printf( "heap allocations during println: %u\n", (unsigned)(host_i2c_allocations() - ulAllocations) );
+
+	oled_display_clear_line( &g_Display, 7 );
+	print_stats( "clear_line" );
+
+	oled_display_clear( &g_Display );
+	print_stats( "clear" );
+
+	oled_display_print( &g_Display, g_strHello );
+	oled_display_set_cursor( &g_Display, 7, 0 );
+	oled_display_print( &g_Display, g_strLongText );
+	print_stats( "scroll" );
+
+	//------------------------------------------------------------------
+	//	the same screen updates with a frame buffer
+	//
+	oled_display_set_frame_buffer( &g_Display, &g_FrameBuffer );
+	oled_display_flush( &g_Display );
+	print_stats( "fb: first flush" );
+
+	oled_display_set_cursor( &g_Display, 1, 0 );
+	oled_display_print( &g_Display, "Temp:  21.5 C" );
+	oled_display_set_cursor( &g_Display, 3, 0 );
+	oled_display_print( &g_Display, "Hum:   45 %" );
+	oled_display_set_cursor( &g_Display, 5, 0 );
+	oled_display_print( &g_Display, "Press: 1013 hPa" );
+	oled_display_flush( &g_Display );
+	print_stats( "fb: 3 fields + flush" );
+
+	oled_display_set_cursor( &g_Display, 1, 7 );
+	oled_display_print( &g_Display, "21.6" );
+	printf( "fb: flush reports %u bytes\n", (unsigned)oled_display_flush( &g_Display ) );
+	print_stats( "fb: 1 digit changed" );
+
+	print_display_stats();
+
+	if( bDump )
+	{
+		oled_emu_dump( &g_Emulator, stdout );
+	}
+
+	return( 0 );
+}
@@ -0,0 +1,292 @@
+//##########################################################################
+//#
+//#		I2cMasterTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the transport for the I²C bus / device driver.
+//#
+//#	For every chip type the same steps are done on two displays, one
+//#	sends directly to its emulated bus (reference), the other one uses
+//#	the I²C master transport on a bus with and without a transaction
+//#	queue. After every step the RAM of both controllers must be the same
+//#	and the same commands and display data must have been received.
+//#	The stand-in of the driver sends queued transactions in the
+//#	background as slow as on the wire, so a buffer that was used again
+//#	by the library too early would show up as a difference.
+//#	A transmit that the driver does not accept must not disturb the
+//#	transactions that are still queued: the frames after it must arrive
+//#	intact.
+//#	At the end the time of a full frame flush is shown: the flush
+//#	returns before the frame is on the wire.
+//#
+//#	Usage:	I2cMasterTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include <SimpleOledI2cMaster.h>
+#include <esp_timer.h>
+#include "oled_emulator.h"
+#include "oled_test.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_PORT					I2C_NUM_1
+#define TEST_CLOCK					1000000
+#define TEST_FRAME_CLOCK			400000
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+oled_emu_bus_t			g_RefBus;
+oled_emu_t				g_RefEmulator;
+oled_test_display_t		g_RefDisplay		= { .pEmulator = &g_RefEmulator };
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+i2c_master_bus_handle_t	g_MasterBus;
+oled_i2c_master_t		g_I2c;
+oled_test_display_t		g_Display			= { .pEmulator = &g_Emulator };
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	wait_i2c
+//--------------------------------------------------------------------------
+//	all queued transactions are done
+//
+static bool wait_i2c( void *pContext )
+{
+	return( ESP_OK == oled_i2c_master_wait( (oled_i2c_master_t *)pContext ) );
+}
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	both emulators, the bus of the driver and the displays
+//
+static bool setup( chip_type_t chipType, size_t queueDepth, uint32_t clockHz )
+{
+	i2c_master_bus_config_t	config;
+
+	oled_emu_bus_init( &g_RefBus );
+	oled_emu_init( &g_RefEmulator, chipType, DISPLAY_ADDRESS_TWO );
+	oled_emu_bus_attach( &g_RefBus, &g_RefEmulator );
+
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, chipType, DISPLAY_ADDRESS_TWO );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+	host_i2c_attach_bus( TEST_PORT, &g_Bus );
+
+	memset( &config, 0, sizeof( config ) );
+
+	config.i2c_port				= TEST_PORT;
+	config.sda_io_num			= 21;
+	config.scl_io_num			= 22;
+	config.trans_queue_depth	= queueDepth;
+
+	return(		(ESP_OK == i2c_new_master_bus( &config, &g_MasterBus ))
+			&&	(ESP_OK == oled_i2c_master_init( &g_I2c, g_MasterBus, clockHz ))
+			&&	(0 == oled_display_init_panel( &g_RefDisplay.display, &g_oledEmuTransport, &g_RefBus, chipType, DISPLAY_ADDRESS_DEFAULT, NULL ))
+			&&	(0 == oled_display_init_i2c_master( &g_Display.display, &g_I2c, chipType, DISPLAY_ADDRESS_DEFAULT, NULL )) );
+}
+
+
+//**************************************************************************
+//	teardown
+//--------------------------------------------------------------------------
+//
+static void teardown( void )
+{
+	oled_i2c_master_wait( &g_I2c );
+	i2c_master_bus_rm_device( g_I2c.device );
+	i2c_del_master_bus( g_MasterBus );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//
+static bool run_case( chip_type_t chipType, const char *strChip, size_t queueDepth )
+{
+	char	strCase[ 40 ];
+	bool	bOk;
+
+	snprintf( strCase, sizeof( strCase ), "%s queue %u", strChip, (unsigned)queueDepth );
+
+	if( !setup( chipType, queueDepth, TEST_CLOCK ) )
+	{
+		printf( "%s: init failed\n", strCase );
+
+		return( false );
+	}
+
+	bOk = oled_test_run_steps( strCase, &g_RefDisplay, &g_Display, wait_i2c, &g_I2c );
+
+	teardown();
+
+	return( bOk );
+}
+
+
+//**************************************************************************
+//	run_failed_transmit
+//--------------------------------------------------------------------------
+//	Every print of a line sends the position and the text, so the
+//	fourth transmit is the text of line 1. It fails while the three
+//	before it are still on the wire, the text of line 1 is lost.
+//	All other lines must arrive intact: the reference prints them
+//	without line 1.
+//
+static bool run_failed_transmit( void )
+{
+	char	strText[ OLED_TEXT_COLUMNS + 1 ];
+	bool	bOk = true;
+
+	if( !setup( CHIP_TYPE_SSD1306, OLED_I2C_QUEUE_DEPTH, TEST_FRAME_CLOCK ) )
+	{
+		printf( "failed transmit: init failed\n" );
+
+		return( false );
+	}
+
+	oled_display_clear( &g_RefDisplay.display );
+	oled_display_clear( &g_Display.display );
+	oled_i2c_master_wait( &g_I2c );
+
+	host_i2c_master_fail_transmit( OLED_I2C_QUEUE_DEPTH );
+
+	for( uint8_t usLine = 0 ; 8 > usLine ; usLine++ )
+	{
+		snprintf( strText, sizeof( strText ), "Line %u", usLine );
+
+		if( 1 != usLine )
+		{
+			oled_display_set_cursor( &g_RefDisplay.display, usLine, 0 );
+			oled_display_print( &g_RefDisplay.display, strText );
+		}
+
+		oled_display_set_cursor( &g_Display.display, usLine, 0 );
+		oled_display_print( &g_Display.display, strText );
+	}
+
+	oled_i2c_master_wait( &g_I2c );
+	host_i2c_master_fail_transmit( 0 );
+
+	if( 0 != memcmp( g_RefEmulator.ram, g_Emulator.ram, sizeof( g_Emulator.ram ) ) )
+	{
+		printf( "failed transmit: RAM differs\n" );
+
+		bOk = false;
+	}
+
+	teardown();
+
+	return( bOk );
+}
+
+
+//**************************************************************************
+//	measure_frame
+//--------------------------------------------------------------------------
+//	time of a full frame flush until it returns and until it is on the
+//	wire
+//
+static void measure_frame( size_t queueDepth )
+{
+	int64_t	llStart;
+	int64_t	llReturned;
+	int64_t	llDone;
+
+	if( !setup( CHIP_TYPE_SSD1306, queueDepth, TEST_FRAME_CLOCK ) )
+	{
+		return;
+	}
+
+	oled_display_set_frame_buffer( &g_Display.display, &g_Display.frameBuffer );
+	oled_i2c_master_wait( &g_I2c );
+
+	llStart		= esp_timer_get_time();
+	oled_display_flush( &g_Display.display );
+	llReturned	= esp_timer_get_time();
+	oled_i2c_master_wait( &g_I2c );
+	llDone		= esp_timer_get_time();
+
+	printf(	"full frame at 400 kHz, queue %u: flush returns after %6.2f ms, on the wire after %6.2f ms\n",
+			(unsigned)queueDepth,
+			(llReturned - llStart) / 1000.0,
+			(llDone - llStart) / 1000.0											);
+
+	oled_display_set_frame_buffer( &g_Display.display, NULL );
+	teardown();
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	failures += run_case( CHIP_TYPE_SH1106, "sh1106", OLED_I2C_QUEUE_DEPTH ) ? 0 : 1;
+	failures += run_case( CHIP_TYPE_SSD1306, "ssd1306", OLED_I2C_QUEUE_DEPTH ) ? 0 : 1;
+	failures += run_case( CHIP_TYPE_SH1107, "sh1107", OLED_I2C_QUEUE_DEPTH ) ? 0 : 1;
+	failures += run_case( CHIP_TYPE_SSD1306, "ssd1306", 0 ) ? 0 : 1;
+
+	failures += run_failed_transmit() ? 0 : 1;
+
+	if( 2 > host_i2c_master_max_queued() )
+	{
+		printf( "transactions were not queued (most queued: %u)\n", (unsigned)host_i2c_master_max_queued() );
+
+		failures++;
+	}
+
+	measure_frame( 0 );
+	measure_frame( OLED_I2C_QUEUE_DEPTH );
+
+	printf( "I2cMasterTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
@@ -0,0 +1,393 @@
+//##########################################################################
+//#
+//#		MarqueeTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the marquee (hardware scroll of the ssd1306).
+//#
+//#	A text is printed on all lines and the pixels of the panel are kept.
+//#	Then a marquee is started and the emulator runs some frames: the
+//#	lines of the marquee must be moved by one column per step, all
+//#	other lines must not be changed and nothing may be send over the
+//#	bus while the marquee runs.
+//#	After the marquee is stopped a display with frame buffer must show
+//#	the text at its places again.
+//#	On the narrow panels the controller scrolls the columns beside the
+//#	panel through it as well: they must be dark, not show what the RAM
+//#	holds since power on.
+//#	The other chips have no scroll engine, there nothing may be send.
+//#
+//#	Usage:	MarqueeTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_RAM_COLUMNS		128		//	columns scrolled by the ssd1306
+#define TEST_STEPS				10
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	one marquee
+//
+typedef struct marquee_case
+{
+	const char				*strName;
+	const oled_geometry_t	*pGeometry;
+	uint8_t					 firstLine;
+	uint8_t					 lastLine;
+	marquee_direction_t		 direction;
+	scroll_interval_t		 interval;
+	uint8_t					 frames;		//	frames per step of the interval
+	bool					 bFlipped;
+	bool					 bFrameBuffer;
+
+} marquee_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const marquee_case_t	g_arCase[] =
+	{
+		{ "left",					&g_oledGeometry128x64,	2, 3, MARQUEE_LEFT,		SCROLL_INTERVAL_2_FRAMES,	 2, false, false	},
+		{ "right",					&g_oledGeometry128x64,	0, 0, MARQUEE_RIGHT,	SCROLL_INTERVAL_5_FRAMES,	 5, false, false	},
+		{ "right flipped",			&g_oledGeometry128x64,	5, 7, MARQUEE_RIGHT,	SCROLL_INTERVAL_3_FRAMES,	 3, true,  false	},
+		{ "left frame buffer",		&g_oledGeometry128x64,	1, 6, MARQUEE_LEFT,		SCROLL_INTERVAL_25_FRAMES,	25, false, true		},
+		{ "up left",				&g_oledGeometry128x64,	4, 4, MARQUEE_UP_LEFT,	SCROLL_INTERVAL_4_FRAMES,	 4, false, true		},
+		{ "up right",				&g_oledGeometry128x64,	0, 7, MARQUEE_UP_RIGHT,	SCROLL_INTERVAL_2_FRAMES,	 2, false, false	},
+		{ "64x48 left",				&g_oledGeometry64x48,	1, 3, MARQUEE_LEFT,		SCROLL_INTERVAL_2_FRAMES,	 2, false, false	},
+		{ "64x48 up right",			&g_oledGeometry64x48,	0, 5, MARQUEE_UP_RIGHT,	SCROLL_INTERVAL_3_FRAMES,	 3, false, true		},
+		{ "72x40 right",			&g_oledGeometry72x40,	0, 4, MARQUEE_RIGHT,	SCROLL_INTERVAL_2_FRAMES,	 2, false, false	},
+		{ "72x40 left flipped",		&g_oledGeometry72x40,	2, 3, MARQUEE_LEFT,		SCROLL_INTERVAL_5_FRAMES,	 5, true,  true		}
+	};
+
+#define MARQUEE_CASES		(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+
+oled_emu_snapshot_t		g_Before;
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	panel of the given geometry (in the middle of the RAM) with a
+//	different text on every line
+//
+static bool setup( chip_type_t chipType, const oled_geometry_t *pGeometry, bool bFlipped, bool bFrameBuffer )
+{
+	char	strText[ OLED_TEXT_COLUMNS + 1 ];
+
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_set_panel( &g_Emulator, pGeometry->width, pGeometry->height, (TEST_RAM_COLUMNS - pGeometry->width) / 2, pGeometry->comPins );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	if( 0 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, chipType, DISPLAY_ADDRESS_ONE, pGeometry ) )
+	{
+		return( false );
+	}
+
+	oled_display_flip( &g_Display, bFlipped );
+	oled_display_set_frame_buffer( &g_Display, bFrameBuffer ? &g_FrameBuffer : NULL );
+	oled_display_set_print_mode( &g_Display, PM_OVERWRITE_SAME_LINE );
+
+	for( uint8_t usLine = 0 ; oled_display_max_text_lines( &g_Display ) > usLine ; usLine++ )
+	{
+		snprintf( strText, sizeof( strText ), "%u:Marquee-%c%c%c%c", usLine, 'A' + usLine, 'a' + usLine, '0' + usLine, '#' );
+
+		oled_display_set_cursor( &g_Display, usLine, 0 );
+		oled_display_print( &g_Display, strText );
+	}
+
+	if( bFrameBuffer )
+	{
+		oled_display_flush( &g_Display );
+	}
+
+	oled_emu_snapshot( &g_Emulator, &g_Before );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	check_panel
+//--------------------------------------------------------------------------
+//	The pixels of the panel after the given number of steps: the pixel
+//	at x / y shows the pixel that was at its source position before.
+//	The rows of the marquee lines moved horizontally (on the panel, not
+//	in the RAM), a diagonal marquee moved the whole panel up. The other
+//	rows of a horizontal marquee are as before.
+//	The controller moves all columns of the RAM, on a narrow panel the
+//	columns beside it come in dark.
+//
+static bool check_panel( const marquee_case_t *pCase, uint8_t steps )
+{
+	uint8_t	usWidth		= pCase->pGeometry->width;
+	uint8_t	usHeight	= pCase->pGeometry->height;
+	uint8_t	usRows		= ((MARQUEE_UP_LEFT <= pCase->direction) ? steps : 0);
+	uint8_t	usFirstRow	= pCase->firstLine * 8;
+	uint8_t	usEndRow	= (pCase->lastLine + 1) * 8;
+	bool	bLeft		= (MARQUEE_LEFT == pCase->direction) || (MARQUEE_UP_LEFT == pCase->direction);
+	bool	bExpected;
+	uint8_t	usSourceX;
+	uint8_t	usSourceY;
+	uint8_t	x;
+	uint8_t	y;
+
+	//----------------------------------------------------------------------
+	//	on a flipped display the text lines are counted from the bottom
+	//	of the panel
+	//
+	if( pCase->bFlipped )
+	{
+		usSourceY	= usFirstRow;
+		usFirstRow	= usHeight - usEndRow;
+		usEndRow	= usHeight - usSourceY;
+	}
+
+	if(		(0 == usRows)
+		&&	!oled_emu_compare_outside( &g_Emulator, &g_Before, 0, usFirstRow, usWidth, usEndRow - usFirstRow, &x, &y ) )
+	{
+		printf( "%s: pixel %u / %u after %u steps is wrong\n", pCase->strName, x, y, steps );
+
+		return( false );
+	}
+
+	for( y = 0 ; usHeight > y ; y++ )
+	{
+		usSourceY = (y + usRows) % usHeight;
+
+		if( (0 == usRows) && ((usFirstRow > y) || (usEndRow <= y)) )
+		{
+			continue;
+		}
+
+		for( x = 0 ; usWidth > x ; x++ )
+		{
+			usSourceX = x;
+
+			if( (usFirstRow <= usSourceY) && (usEndRow > usSourceY) )
+			{
+				usSourceX = bLeft ? ((x + steps) % TEST_RAM_COLUMNS) : ((x + TEST_RAM_COLUMNS - steps) % TEST_RAM_COLUMNS);
+			}
+
+			bExpected = (usWidth > usSourceX) && g_Before.pixel[ usSourceY ][ usSourceX ];
+
+			if( oled_emu_pixel( &g_Emulator, x, y ) != bExpected )
+			{
+				printf( "%s: pixel %u / %u after %u steps is wrong\n", pCase->strName, x, y, steps );
+
+				return( false );
+			}
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//
+static bool run_case( const marquee_case_t *pCase )
+{
+	if( !setup( CHIP_TYPE_SSD1306, pCase->pGeometry, pCase->bFlipped, pCase->bFrameBuffer ) )
+	{
+		printf( "%s: init failed\n", pCase->strName );
+
+		return( false );
+	}
+
+	oled_display_start_marquee( &g_Display, pCase->firstLine, pCase->lastLine, pCase->direction, pCase->interval );
+
+	if( !g_Emulator.scrollActive || (0 != g_Emulator.scrollSetupErrors) )
+	{
+		printf( "%s: marquee not started\n", pCase->strName );
+
+		return( false );
+	}
+
+	//----------------------------------------------------------------------
+	//	one frame less than a step must not move anything
+	//
+	oled_emu_bus_reset_stats( &g_Bus );
+	oled_emu_run_frames( &g_Emulator, pCase->frames - 1 );
+
+	if( !check_panel( pCase, 0 ) )
+	{
+		return( false );
+	}
+
+	oled_emu_run_frames( &g_Emulator, 1 + pCase->frames * (TEST_STEPS - 1) );
+
+	if( !check_panel( pCase, TEST_STEPS ) )
+	{
+		return( false );
+	}
+
+	if( 0 != g_Bus.transactions )
+	{
+		printf( "%s: %u transactions while the marquee runs\n", pCase->strName, (unsigned)g_Bus.transactions );
+
+		return( false );
+	}
+
+	//----------------------------------------------------------------------
+	//	after the stop the frame buffer restores the text
+	//
+	oled_display_stop_marquee( &g_Display );
+	oled_emu_run_frames( &g_Emulator, pCase->frames * TEST_STEPS );
+
+	if( g_Emulator.scrollActive )
+	{
+		printf( "%s: marquee not stopped\n", pCase->strName );
+
+		return( false );
+	}
+
+	if( pCase->bFrameBuffer && !check_panel( pCase, 0 ) )
+	{
+		printf( "%s: text not restored\n", pCase->strName );
+
+		return( false );
+	}
+
+	oled_display_set_frame_buffer( &g_Display, NULL );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_no_marquee
+//--------------------------------------------------------------------------
+//	chips without scroll engine and lines that are not in one piece of
+//	the RAM: nothing is send
+//
+static bool run_no_marquee( void )
+{
+	const chip_type_t	arChip[] = { CHIP_TYPE_SH1106, CHIP_TYPE_SH1107 };
+
+	for( size_t idx = 0 ; (sizeof( arChip ) / sizeof( arChip[ 0 ] )) > idx ; idx++ )
+	{
+		oled_emu_bus_init( &g_Bus );
+		oled_emu_init( &g_Emulator, arChip[ idx ], DISPLAY_ADDRESS_ONE );
+		oled_emu_bus_attach( &g_Bus, &g_Emulator );
+		oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, arChip[ idx ], DISPLAY_ADDRESS_ONE, NULL );
+
+		oled_emu_bus_reset_stats( &g_Bus );
+		oled_display_start_marquee( &g_Display, 0, 1, MARQUEE_LEFT, SCROLL_INTERVAL_2_FRAMES );
+		oled_display_stop_marquee( &g_Display );
+
+		if( 0 != g_Bus.transactions )
+		{
+			printf( "chip %u: marquee was send\n", (unsigned)arChip[ idx ] );
+
+			return( false );
+		}
+	}
+
+	//----------------------------------------------------------------------
+	//	after scrolling 3 lines the text lines 4 and 5 are in the RAM
+	//	pages 7 and 0
+	//
+	setup( CHIP_TYPE_SSD1306, &g_oledGeometry128x64, false, false );
+	oled_display_set_print_mode( &g_Display, PM_SCROLL_LINE );
+	oled_display_set_cursor( &g_Display, 7, 0 );
+	oled_display_print( &g_Display, "\n\n\n" );
+
+	oled_emu_bus_reset_stats( &g_Bus );
+	oled_display_start_marquee( &g_Display, 4, 5, MARQUEE_LEFT, SCROLL_INTERVAL_2_FRAMES );
+
+	if( 0 != g_Bus.transactions )
+	{
+		printf( "marquee over the end of the RAM was send\n" );
+
+		return( false );
+	}
+
+	oled_display_start_marquee( &g_Display, 3, 4, MARQUEE_LEFT, SCROLL_INTERVAL_2_FRAMES );
+
+	if( !g_Emulator.scrollActive || (6 != g_Emulator.scrollStartPage) || (7 != g_Emulator.scrollEndPage) )
+	{
+		printf( "marquee after scrolling has the wrong pages\n" );
+
+		return( false );
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; MARQUEE_CASES > idx ; idx++ )
+	{
+		failures += run_case( &g_arCase[ idx ] ) ? 0 : 1;
+	}
+
+	failures += run_no_marquee() ? 0 : 1;
+
+	printf( "MarqueeTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
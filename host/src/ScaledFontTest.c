@@ -0,0 +1,364 @@
+//##########################################################################
+//#
+//#		ScaledFontTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the scaled text (oled_display_print_scaled).
+//#
+//#	The display is filled with characters of the 8x8 font, then a text
+//#	is printed scaled. A reference display shows the same text in its
+//#	normal size (8x8 font with oled_display_print(), the proportional
+//#	fonts with oled_display_print_font()). Every pixel of the panel is
+//#	checked: in the area of the text it must show the pixel of the
+//#	reference that is enlarged to it, all other pixels must not be
+//#	changed. Without frame buffer every page of the text must be send
+//#	as one data transaction with one byte per column.
+//#	This is done for the scales 1 ... OLED_MAX_SCALE, with the 8x8 font
+//#	and the proportional fonts, with and without frame buffer, with the
+//#	inverse font, for texts that are cut at the right and at the bottom
+//#	of the panel and with asynchronous output. An invalid scale must
+//#	not draw anything.
+//#
+//#	Usage:	ScaledFontTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_WIDTH					128
+#define TEST_HEIGHT					64
+#define TEST_LINES					8
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct scaled_case
+{
+	const char			*strName;
+	const oled_font_t	*pFont;			//	NULL: 8x8 font
+	uint8_t				 scale;
+	chip_type_t			 chipType;
+	uint8_t				 textLine;
+	uint8_t				 x;
+	const char			*strText;
+	bool				 bFrameBuffer;
+	bool				 bInverse;
+	bool				 bAsync;
+
+} scaled_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const scaled_case_t	g_arCase[] =
+	{
+		{ "1x 8x8",						NULL,			1,	CHIP_TYPE_SH1106,	6,	 4,	"scale 1",		false,	false,	false	},
+		{ "2x 8x8 sh1106",				NULL,			2,	CHIP_TYPE_SH1106,	1,	 0,	"12:34",		false,	false,	false	},
+		{ "3x 8x8 ssd1306 inverse",		NULL,			3,	CHIP_TYPE_SSD1306,	2,	10,	"-7°C",	false,	true,	false	},
+		{ "4x 8x8 cut",					NULL,			4,	CHIP_TYPE_SSD1306,	5,	40,	"ABC",			false,	false,	false	},
+		{ "4x 8x8 frame buffer",		NULL,			4,	CHIP_TYPE_SH1106,	0,	 1,	"Äß",	true,	true,	false	},
+		{ "2x 5x7 frame buffer",		&g_oledFont5x7,	2,	CHIP_TYPE_SH1106,	0,	 3,	"Größe 21.5",	true,	false,	false	},
+		{ "3x 5x7 frame buffer cut",	&g_oledFont5x7,	3,	CHIP_TYPE_SSD1306,	3,	100,	"Hello",		true,	false,	false	},
+		{ "3x 3x5 ssd1306",				&g_oledFont3x5,	3,	CHIP_TYPE_SSD1306,	4,	 1,	"Temp 23°",	false,	false,	false	},
+		{ "4x 5x7 cut",					&g_oledFont5x7,	4,	CHIP_TYPE_SH1106,	6,	20,	"wxyz",			false,	true,	false	},
+		{ "2x 5x7 async",				&g_oledFont5x7,	2,	CHIP_TYPE_SH1106,	3,	 5,	"the quick brown fox",	false,	true,	true	},
+		{ "3x 8x8 async",				NULL,			3,	CHIP_TYPE_SSD1306,	0,	 0,	"Hi!ä",	false,	false,	true	}
+	};
+
+#define SCALED_CASES		(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+oled_async_t			g_Async;
+
+oled_emu_bus_t			g_RefBus;
+oled_emu_t				g_RefEmulator;
+oled_display_handle_t	g_RefDisplay;
+
+oled_emu_snapshot_t		g_Before;
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	display with 8x8 characters on all lines, empty reference display
+//
+static bool setup( const scaled_case_t *pCase )
+{
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	oled_emu_bus_init( &g_RefBus );
+	oled_emu_init( &g_RefEmulator, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_RefBus, &g_RefEmulator );
+
+	if(		(0 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, pCase->chipType, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x64 ))
+		||	(0 != oled_display_init_panel( &g_RefDisplay, &g_oledEmuTransport, &g_RefBus, pCase->chipType, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x64 )) )
+	{
+		return( false );
+	}
+
+	oled_display_set_frame_buffer( &g_Display, pCase->bFrameBuffer ? &g_FrameBuffer : NULL );
+	oled_display_set_print_mode( &g_Display, PM_OVERWRITE_SAME_LINE );
+	oled_display_set_print_mode( &g_RefDisplay, PM_OVERWRITE_SAME_LINE );
+
+	for( uint8_t usLine = 0 ; TEST_LINES > usLine ; usLine++ )
+	{
+		oled_display_set_cursor( &g_Display, usLine, 0 );
+		oled_display_print( &g_Display, (usLine & 1) ? "#Scaled-8x8-Ln-#" : "@abcdefghijklmn@" );
+	}
+
+	if( pCase->bFrameBuffer )
+	{
+		oled_display_flush( &g_Display );
+	}
+
+	oled_emu_snapshot( &g_Emulator, &g_Before );
+
+	oled_display_set_inverse_font( &g_Display, pCase->bInverse );
+	oled_display_set_inverse_font( &g_RefDisplay, pCase->bInverse );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	print_reference
+//--------------------------------------------------------------------------
+//	the text in its normal size at the top left of the reference display
+//	Returns the width of the text in pixel columns.
+//
+static uint16_t print_reference( const scaled_case_t *pCase )
+{
+	uint16_t	uiWidth = 0;
+
+	if( NULL != pCase->pFont )
+	{
+		return( oled_display_print_font( &g_RefDisplay, pCase->pFont, 0, 0, pCase->strText ) );
+	}
+
+	oled_display_set_cursor( &g_RefDisplay, 0, 0 );
+	oled_display_print( &g_RefDisplay, pCase->strText );
+
+	//----------------------------------------------------------------------
+	//	one glyph per character, UTF-8 continuation bytes do not count
+	//
+	for( const char *pText = pCase->strText ; 0x00 != *pText ; pText++ )
+	{
+		if( 0x80 != (*pText & 0xC0) )
+		{
+			uiWidth += 8;
+		}
+	}
+
+	return( uiWidth );
+}
+
+
+//**************************************************************************
+//	check_panel
+//--------------------------------------------------------------------------
+//	the enlarged reference in the columns x ... end - 1 of the text
+//	lines, everything else as before
+//
+static bool check_panel( const scaled_case_t *pCase, uint8_t end )
+{
+	uint8_t	usTop		= pCase->textLine * 8;
+	uint8_t	usBottom	= ((usTop + 8 * pCase->scale) < TEST_HEIGHT) ? (usTop + 8 * pCase->scale) : TEST_HEIGHT;
+	uint8_t	x;
+	uint8_t	y;
+
+	if( !oled_emu_compare_outside( &g_Emulator, &g_Before, pCase->x, usTop, end - pCase->x, usBottom - usTop, &x, &y ) )
+	{
+		printf( "%s: pixel %u / %u is wrong\n", pCase->strName, x, y );
+
+		return( false );
+	}
+
+	for( y = usTop ; usBottom > y ; y++ )
+	{
+		for( x = pCase->x ; end > x ; x++ )
+		{
+			if( oled_emu_pixel( &g_Emulator, x, y ) != oled_emu_pixel( &g_RefEmulator, (x - pCase->x) / pCase->scale, (y - usTop) / pCase->scale ) )
+			{
+				printf( "%s: pixel %u / %u is wrong\n", pCase->strName, x, y );
+
+				return( false );
+			}
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//
+static bool run_case( const scaled_case_t *pCase )
+{
+	uint16_t	uiEnd;
+	uint8_t		usReturned;
+	uint8_t		usPages;
+
+	if( !setup( pCase ) )
+	{
+		printf( "%s: init failed\n", pCase->strName );
+
+		return( false );
+	}
+
+	uiEnd	= pCase->x + pCase->scale * print_reference( pCase );
+	uiEnd	= (TEST_WIDTH < uiEnd) ? TEST_WIDTH : uiEnd;
+	usPages	= (TEST_LINES - pCase->textLine < pCase->scale) ? (TEST_LINES - pCase->textLine) : pCase->scale;
+
+	if( pCase->bAsync && (0 != oled_display_start_async( &g_Display, &g_Async, 5, NULL, NULL )) )
+	{
+		printf( "%s: render task could not be started\n", pCase->strName );
+
+		return( false );
+	}
+
+	oled_emu_bus_reset_stats( &g_Bus );
+	oled_emu_reset_stats( &g_Emulator );
+
+	usReturned = oled_display_print_scaled( &g_Display, pCase->pFont, pCase->scale, pCase->textLine, pCase->x, pCase->strText );
+
+	if( pCase->bAsync )
+	{
+		oled_display_wait( &g_Display, portMAX_DELAY );
+		oled_display_stop_async( &g_Display );
+	}
+
+	if( usReturned != uiEnd )
+	{
+		printf( "%s: returned column %u instead of %u\n", pCase->strName, usReturned, (unsigned)uiEnd );
+
+		return( false );
+	}
+
+	if(		!pCase->bFrameBuffer && !pCase->bAsync
+		&&	(((uiEnd - pCase->x) * usPages != g_Emulator.dataBytes) || ((2u * usPages) < g_Bus.transactions)) )
+	{
+		printf(	"%s: %u transactions with %u bytes display data for %u pages of %u columns\n",
+				pCase->strName, (unsigned)g_Bus.transactions, (unsigned)g_Emulator.dataBytes, usPages, (unsigned)(uiEnd - pCase->x)	);
+
+		return( false );
+	}
+
+	if( pCase->bFrameBuffer )
+	{
+		oled_display_flush( &g_Display );
+	}
+
+	if( !check_panel( pCase, (uint8_t)uiEnd ) )
+	{
+		return( false );
+	}
+
+	oled_display_set_frame_buffer( &g_Display, NULL );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_invalid_scale
+//--------------------------------------------------------------------------
+//	scale 0 and scales above OLED_MAX_SCALE draw nothing
+//
+static bool run_invalid_scale( void )
+{
+	const scaled_case_t	invalidCase = { "invalid scale", NULL, 0, CHIP_TYPE_SH1106, 2, 8, "X", false, false, false };
+	const uint8_t		arusScale[] = { 0, OLED_MAX_SCALE + 1 };
+
+	for( size_t idx = 0 ; (sizeof( arusScale ) / sizeof( arusScale[ 0 ] )) > idx ; idx++ )
+	{
+		if( !setup( &invalidCase ) )
+		{
+			return( false );
+		}
+
+		oled_emu_bus_reset_stats( &g_Bus );
+
+		if(		(invalidCase.x != oled_display_print_scaled( &g_Display, NULL, arusScale[ idx ], invalidCase.textLine, invalidCase.x, invalidCase.strText ))
+			||	(0 != g_Bus.transactions) )
+		{
+			printf( "scale %u: text was printed\n", arusScale[ idx ] );
+
+			return( false );
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; SCALED_CASES > idx ; idx++ )
+	{
+		failures += run_case( &g_arCase[ idx ] ) ? 0 : 1;
+	}
+
+	failures += run_invalid_scale() ? 0 : 1;
+
+	printf( "ScaledFontTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
@@ -0,0 +1,324 @@
+//##########################################################################
+//#
+//#		ScrollRegionTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the scroll region of the print mode
+//#	PM_SCROLL_LINE.
+//#
+//#	A header is printed in the first line and a footer in the last line,
+//#	the lines between are the scroll region. Then many lines are printed
+//#	into the region. After every line the panel must show the same as a
+//#	reference display, where header, footer and the last lines are
+//#	printed at their places without scrolling.
+//#	This is done with the text shadow and with a frame buffer, with
+//#	inverse characters and with a glyph variant the text shadow does
+//#	not know (then the region is cleared, header and footer stay).
+//#	A scrolled line must cost less display data than a redraw of the
+//#	region, the average is shown.
+//#
+//#	Usage:	ScrollRegionTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_WIDTH					128
+#define TEST_HEIGHT					64
+#define TEST_LINES					30			//	lines printed per case
+#define TEST_FIRST_LINE				1			//	scroll region
+#define TEST_LAST_LINE				6
+#define TEST_FOOTER_LINE			7
+#define TEST_VARIANT_LINE			10			//	printed mirrored
+
+#define REGION_LINES				(TEST_LAST_LINE - TEST_FIRST_LINE + 1)
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct region_case
+{
+	const char	*strName;
+	chip_type_t	 chipType;
+	bool		 bFrameBuffer;
+	bool		 bInverse;			//	some characters inverse
+	bool		 bVariant;			//	one line mirrored
+
+} region_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const region_case_t	g_arCase[] =
+	{
+		{ "sh1106 shadow",				CHIP_TYPE_SH1106,	false,	false,	false	},
+		{ "ssd1306 shadow",				CHIP_TYPE_SSD1306,	false,	false,	false	},
+		{ "ssd1306 shadow inverse",		CHIP_TYPE_SSD1306,	false,	true,	false	},
+		{ "sh1106 frame buffer",		CHIP_TYPE_SH1106,	true,	true,	false	},
+		{ "ssd1306 frame buffer",		CHIP_TYPE_SSD1306,	true,	false,	true	},
+		{ "sh1106 glyph variant",		CHIP_TYPE_SH1106,	false,	true,	true	}
+	};
+
+#define REGION_CASES		(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+const char g_strLog[]	= "Log-entry-abcdefghijk";
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+
+oled_emu_bus_t			g_RefBus;
+oled_emu_t				g_RefEmulator;
+oled_display_handle_t	g_RefDisplay;
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	print_log_line
+//--------------------------------------------------------------------------
+//	the text of the given log line (different lengths, some characters
+//	inverse, one line mirrored)
+//
+static void print_log_line( oled_display_handle_t *pHandle, const region_case_t *pCase, int32_t line )
+{
+	char	strText[ OLED_TEXT_COLUMNS + 1 ];
+
+	snprintf( strText, sizeof( strText ), "%02d%.*s", (int)line, (int)((line * 5) % 15), g_strLog );
+
+	if( pCase->bVariant && (TEST_VARIANT_LINE == line) )
+	{
+		oled_display_set_glyph_variant( pHandle, GLYPH_MIRRORED );
+		oled_display_print( pHandle, strText );
+		oled_display_set_glyph_variant( pHandle, GLYPH_NORMAL );
+	}
+	else if( pCase->bInverse && (0 == (line % 3)) && (6 < strlen( strText )) )
+	{
+		oled_display_print( pHandle, "  " );
+		oled_display_set_inverse_font( pHandle, true );
+		oled_display_print( pHandle, &strText[ 2 ] );
+		oled_display_set_inverse_font( pHandle, false );
+	}
+	else
+	{
+		oled_display_print( pHandle, strText );
+	}
+}
+
+
+//**************************************************************************
+//	print_fixed_lines
+//--------------------------------------------------------------------------
+//
+static void print_fixed_lines( oled_display_handle_t *pHandle )
+{
+	oled_display_set_cursor( pHandle, 0, 0 );
+	oled_display_print( pHandle, "== Header ==" );
+	oled_display_set_cursor( pHandle, TEST_FOOTER_LINE, 0 );
+	oled_display_set_inverse_font( pHandle, true );
+	oled_display_print( pHandle, "Footer 12:00" );
+	oled_display_set_inverse_font( pHandle, false );
+}
+
+
+//**************************************************************************
+//	check_panel
+//--------------------------------------------------------------------------
+//	The reference shows header, footer and the log lines of the region
+//	(-1: empty line) at their places, both panels must be the same.
+//
+static bool check_panel( const region_case_t *pCase, const int32_t *pShown, int32_t line )
+{
+	oled_display_clear( &g_RefDisplay );
+	print_fixed_lines( &g_RefDisplay );
+
+	for( uint8_t idx = 0 ; REGION_LINES > idx ; idx++ )
+	{
+		if( 0 <= pShown[ idx ] )
+		{
+			oled_display_set_cursor( &g_RefDisplay, TEST_FIRST_LINE + idx, 0 );
+			print_log_line( &g_RefDisplay, pCase, pShown[ idx ] );
+		}
+	}
+
+	for( uint8_t y = 0 ; TEST_HEIGHT > y ; y++ )
+	{
+		for( uint8_t x = 0 ; TEST_WIDTH > x ; x++ )
+		{
+			if( oled_emu_pixel( &g_Emulator, x, y ) != oled_emu_pixel( &g_RefEmulator, x, y ) )
+			{
+				printf( "%s: pixel %u / %u after line %d is wrong\n", pCase->strName, x, y, (int)line );
+
+				return( false );
+			}
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//	The lines of the region are followed in arShown: a scroll moves them
+//	up one line, if the text shadow does not know a character the region
+//	is cleared.
+//
+static bool run_case( const region_case_t *pCase )
+{
+	int32_t		arShown[ REGION_LINES ];
+	uint8_t		usCursor	= 0;
+	uint32_t	ulBytes		= 0;
+	uint32_t	ulScrolls	= 0;
+	bool		bClear;
+
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	oled_emu_bus_init( &g_RefBus );
+	oled_emu_init( &g_RefEmulator, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_RefBus, &g_RefEmulator );
+
+	if(		(0 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, pCase->chipType, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x64 ))
+		||	(0 != oled_display_init_panel( &g_RefDisplay, &g_oledEmuTransport, &g_RefBus, pCase->chipType, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x64 )) )
+	{
+		printf( "%s: init failed\n", pCase->strName );
+
+		return( false );
+	}
+
+	for( uint8_t idx = 0 ; REGION_LINES > idx ; idx++ )
+	{
+		arShown[ idx ] = -1;
+	}
+
+	oled_display_set_print_mode( &g_RefDisplay, PM_OVERWRITE_SAME_LINE );
+	oled_display_set_frame_buffer( &g_Display, pCase->bFrameBuffer ? &g_FrameBuffer : NULL );
+
+	print_fixed_lines( &g_Display );
+
+	oled_display_set_print_mode( &g_Display, PM_SCROLL_LINE );
+	oled_display_set_scroll_region( &g_Display, TEST_FIRST_LINE, TEST_LAST_LINE );
+	oled_display_set_cursor( &g_Display, TEST_FIRST_LINE, 0 );
+
+	for( int32_t line = 0 ; TEST_LINES > line ; line++ )
+	{
+		print_log_line( &g_Display, pCase, line );
+
+		arShown[ usCursor ] = line;
+
+		oled_emu_reset_stats( &g_Emulator );
+		oled_display_print( &g_Display, "\n" );
+
+		if( pCase->bFrameBuffer )
+		{
+			oled_display_flush( &g_Display );
+		}
+
+		if( (REGION_LINES - 1) > usCursor )
+		{
+			usCursor++;
+		}
+		else
+		{
+			ulBytes += g_Emulator.dataBytes;
+			ulScrolls++;
+
+			bClear = false;
+
+			for( uint8_t idx = 1 ; REGION_LINES > idx ; idx++ )
+			{
+				bClear |= !pCase->bFrameBuffer && pCase->bVariant && (TEST_VARIANT_LINE == arShown[ idx ]);
+			}
+
+			for( uint8_t idx = 0 ; REGION_LINES > idx ; idx++ )
+			{
+				arShown[ idx ] = (bClear || ((REGION_LINES - 1) == idx)) ? -1 : arShown[ idx + 1 ];
+			}
+		}
+
+		if( !check_panel( pCase, arShown, line ) )
+		{
+			return( false );
+		}
+	}
+
+	if( ulBytes >= (ulScrolls * REGION_LINES * TEST_WIDTH) )
+	{
+		printf( "%s: %u bytes for %u scrolled lines\n", pCase->strName, (unsigned)ulBytes, (unsigned)ulScrolls );
+
+		return( false );
+	}
+
+	printf(	"%-24s %3u bytes display data per scrolled line (redraw of the region: %u)\n",
+			pCase->strName, (unsigned)(ulBytes / ulScrolls), REGION_LINES * TEST_WIDTH		);
+
+	oled_display_set_frame_buffer( &g_Display, NULL );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; REGION_CASES > idx ; idx++ )
+	{
+		failures += run_case( &g_arCase[ idx ] ) ? 0 : 1;
+	}
+
+	printf( "ScrollRegionTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
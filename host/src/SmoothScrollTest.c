@@ -0,0 +1,353 @@
+//##########################################################################
+//#
+//#		SmoothScrollTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the smooth scroll of the print mode
+//#	PM_SCROLL_LINE on the different panels.
+//#
+//#	The display is filled with text, then one line after the other is
+//#	scrolled in. The transport checks the panel after every transaction:
+//#	-	the image must move up one pixel row with every step, until the
+//#		line is scrolled completely
+//#	-	the rows that come in at the bottom must be blank, i.e. the new
+//#		line is cleared before it is shown
+//#	-	on a panel with less rows than the RAM the first line must be
+//#		shown until it is scrolled out
+//#	Only one page of display data may be send for every scrolled line.
+//#
+//#	Usage:	SmoothScrollTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_LINES					12		//	lines scrolled per panel
+#define TEST_STEP_MS				1
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	one panel: geometry for the library, wiring for the emulator
+//
+typedef struct scroll_case
+{
+	const char				*strName;
+	chip_type_t				 chipType;
+	const oled_geometry_t	*pGeometry;
+	uint8_t					 segmentOffset;
+	uint8_t					 comPins;
+
+} scroll_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const scroll_case_t	g_arCase[] =
+	{
+		{ "ssd1306 128x64",		CHIP_TYPE_SSD1306,	&g_oledGeometry128x64,		 0, 0x12 },
+		{ "ssd1306 128x32",		CHIP_TYPE_SSD1306,	&g_oledGeometry128x32,		 0, 0x02 },
+		{ "ssd1306 64x48",		CHIP_TYPE_SSD1306,	&g_oledGeometry64x48,		32, 0x12 },
+		{ "sh1106 128x64",		CHIP_TYPE_SH1106,	&g_oledGeometry128x64,		 2, 0x12 },
+		{ "sh1107 128x128",		CHIP_TYPE_SH1107,	&g_oledGeometry128x128,		 0, 0x12 }
+	};
+
+#define SCROLL_CASES		(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+
+//----	state of the check  --------------------------------------------
+const scroll_case_t		*g_pCase;
+bool					 g_bChecking;
+bool					 g_bFailed;
+uint8_t					 g_usBaseRow;		//	RAM row shown in the first row before the scroll
+uint8_t					 g_usLastStep;
+uint32_t				 g_ulTransactions;
+oled_emu_snapshot_t		 g_Before;
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	ram_rows
+//--------------------------------------------------------------------------
+//
+static uint8_t ram_rows( void )
+{
+	return( g_Emulator.ramPages * 8 );
+}
+
+
+//**************************************************************************
+//	shown_row
+//--------------------------------------------------------------------------
+//	the RAM row that is shown in the first row of the panel
+//
+static uint8_t shown_row( void )
+{
+	return( (g_Emulator.lineOffset + g_Emulator.startLine) % ram_rows() );
+}
+
+
+//**************************************************************************
+//	check_panel
+//--------------------------------------------------------------------------
+//	The panel after the given number of steps: every row shows the row
+//	that was 'step' rows below it before the scroll. Rows from below the
+//	panel must be blank, the first line too if the panel shows the
+//	complete RAM (it was cleared for the new line).
+//
+static void check_panel( uint8_t step )
+{
+	uint8_t	usHeight	= g_pCase->pGeometry->height;
+	bool	bSpareRows	= usHeight < ram_rows();
+	bool	bExpected;
+	uint8_t	usSource;
+
+	for( uint8_t y = 0 ; usHeight > y ; y++ )
+	{
+		usSource = y + step;
+
+		for( uint8_t x = 0 ; g_pCase->pGeometry->width > x ; x++ )
+		{
+			if( (usHeight <= usSource) || ((0 < step) && !bSpareRows && (8 > usSource)) )
+			{
+				bExpected = false;
+			}
+			else if( (0 == step) && !bSpareRows && (8 > usSource) )
+			{
+				continue;
+			}
+			else
+			{
+				bExpected = g_Before.pixel[ usSource ][ x ];
+			}
+
+			if( oled_emu_pixel( &g_Emulator, x, y ) != bExpected )
+			{
+				printf( "%s: pixel %u / %u after %u steps is wrong\n", g_pCase->strName, x, y, step );
+
+				g_bFailed	= true;
+				g_bChecking	= false;
+
+				return;
+			}
+		}
+	}
+}
+
+
+//**************************************************************************
+//	check_transaction
+//--------------------------------------------------------------------------
+//	called after every transaction while a line is scrolled
+//
+static void check_transaction( void )
+{
+	uint8_t	usStep;
+
+	if( !g_bChecking )
+	{
+		return;
+	}
+
+	g_ulTransactions++;
+
+	usStep = (shown_row() + ram_rows() - g_usBaseRow) % ram_rows();
+
+	if( (usStep != g_usLastStep) && (usStep != (g_usLastStep + 1)) )
+	{
+		printf( "%s: step %u follows step %u\n", g_pCase->strName, usStep, g_usLastStep );
+
+		g_bFailed	= true;
+		g_bChecking	= false;
+
+		return;
+	}
+
+	g_usLastStep = usStep;
+
+	check_panel( usStep );
+}
+
+
+//**************************************************************************
+//	_test_probe, _test_write, _test_write_data
+//--------------------------------------------------------------------------
+//	transport to the emulated bus that checks the panel after every
+//	transaction
+//
+static esp_err_t _test_probe( void *pContext, uint8_t address )
+{
+	return( g_oledEmuTransport.probe( pContext, address ) );
+}
+
+static esp_err_t _test_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	esp_err_t result = g_oledEmuTransport.write( pContext, address, pBuffer, length );
+
+	check_transaction();
+
+	return( result );
+}
+
+static esp_err_t _test_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length )
+{
+	esp_err_t result = g_oledEmuTransport.write_data( pContext, address, pData, length );
+
+	check_transaction();
+
+	return( result );
+}
+
+const oled_transport_t	g_TestTransport =
+	{
+		.probe		= _test_probe,
+		.write		= _test_write,
+		.write_data	= _test_write_data
+	};
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//
+static bool run_case( const scroll_case_t *pCase )
+{
+	char	strText[ OLED_TEXT_COLUMNS + 1 ];
+	uint8_t	usLines;
+
+	g_pCase		= pCase;
+	g_bFailed	= false;
+	g_bChecking	= false;
+
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, pCase->chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_set_panel( &g_Emulator, pCase->pGeometry->width, pCase->pGeometry->height, pCase->segmentOffset, pCase->comPins );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	if( 0 != oled_display_init_panel( &g_Display, &g_TestTransport, &g_Bus, pCase->chipType, DISPLAY_ADDRESS_ONE, pCase->pGeometry ) )
+	{
+		printf( "%s: init failed\n", pCase->strName );
+
+		return( false );
+	}
+
+	oled_display_set_smooth_scroll( &g_Display, TEST_STEP_MS );
+
+	usLines = oled_display_max_text_lines( &g_Display );
+
+	for( uint32_t ulLine = 0 ; (usLines + TEST_LINES) > ulLine ; ulLine++ )
+	{
+		snprintf( strText, sizeof( strText ), "%02u-Scroll-%c%c%c%c", (unsigned)ulLine, 'A' + (ulLine % 26), 'a' + (ulLine % 26), '#', '0' + (ulLine % 10) );
+		oled_display_print( &g_Display, strText );
+
+		if( (usLines - 1) > ulLine )
+		{
+			oled_display_print( &g_Display, "\n" );
+
+			continue;
+		}
+
+		//------------------------------------------------------------------
+		//	the display is full, the new line scrolls it up
+		//
+		oled_emu_snapshot( &g_Emulator, &g_Before );
+		oled_emu_reset_stats( &g_Emulator );
+
+		g_usBaseRow			= shown_row();
+		g_usLastStep		= 0;
+		g_ulTransactions	= 0;
+		g_bChecking			= true;
+
+		oled_display_print( &g_Display, "\n" );
+
+		g_bChecking = false;
+
+		if( g_bFailed )
+		{
+			return( false );
+		}
+
+		if( 8 != g_usLastStep )
+		{
+			printf( "%s: scroll stopped after %u steps\n", pCase->strName, g_usLastStep );
+
+			return( false );
+		}
+
+		if( g_Emulator.ramColumns < g_Emulator.dataBytes )
+		{
+			printf( "%s: %u bytes display data for one line\n", pCase->strName, (unsigned)g_Emulator.dataBytes );
+
+			return( false );
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; SCROLL_CASES > idx ; idx++ )
+	{
+		failures += run_case( &g_arCase[ idx ] ) ? 0 : 1;
+	}
+
+	printf( "SmoothScrollTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
@@ -0,0 +1,188 @@
+//##########################################################################
+//#
+//#		SpiTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the SPI transport against the I²C transport.
+//#
+//#	For every chip type the same steps are done on two displays, one
+//#	on the emulated I²C bus and one on the SPI stand-in. After every
+//#	step the RAM of both controllers must be the same and the same
+//#	commands and display data must have been received.
+//#	The SPI stand-in does a queued transfer only when its result is
+//#	fetched, so a transfer whose buffer was used again by the library
+//#	would show up as a difference.
+//#
+//#	Usage:	SpiTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include <SimpleOledSpi.h>
+#include "oled_emulator.h"
+#include "oled_test.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define SPI_TEST_CS_PIN				5
+#define SPI_TEST_DC_PIN				16
+#define SPI_TEST_CLOCK				(10 * 1000 * 1000)
+
+//----	clocks on the wire  --------------------------------------------
+#define I2C_CLOCKS_PER_BYTE			9		//	8 data bits + ACK
+#define I2C_CLOCKS_PER_TRANSACTION	2		//	START + STOP
+#define I2C_TEST_CLOCK				400000
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_I2cEmulator;
+oled_test_display_t		g_I2cDisplay		= { .pEmulator = &g_I2cEmulator };
+
+oled_emu_t				g_SpiEmulator;
+oled_spi_t				g_Spi;
+oled_test_display_t		g_SpiDisplay		= { .pEmulator = &g_SpiEmulator };
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	wait_spi
+//--------------------------------------------------------------------------
+//	all queued transfers are done
+//
+static bool wait_spi( void *pContext )
+{
+	return( ESP_OK == oled_spi_wait( (oled_spi_t *)pContext ) );
+}
+
+
+//**************************************************************************
+//	run_chip
+//--------------------------------------------------------------------------
+//
+static bool run_chip( chip_type_t chipType, const char *strChip )
+{
+	uint32_t	ulI2cClocks;
+	uint32_t	ulSpiClocks;
+
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_I2cEmulator, chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_Bus, &g_I2cEmulator );
+
+	oled_emu_init( &g_SpiEmulator, chipType, DISPLAY_ADDRESS_ONE );
+
+	if( ESP_OK != oled_spi_init( &g_Spi, SPI2_HOST, SPI_TEST_CS_PIN, SPI_TEST_DC_PIN, SPI_TEST_CLOCK ) )
+	{
+		printf( "%s: SPI device could not be added\n", strChip );
+
+		return( false );
+	}
+
+	if(		(0 != oled_display_init_panel( &g_I2cDisplay.display, &g_oledEmuTransport, &g_Bus, chipType, DISPLAY_ADDRESS_ONE, NULL ))
+		||	(0 != oled_display_init_spi( &g_SpiDisplay.display, &g_Spi, chipType, NULL )) )
+	{
+		printf( "%s: init failed\n", strChip );
+
+		return( false );
+	}
+
+	if( !oled_test_run_steps( strChip, &g_I2cDisplay, &g_SpiDisplay, wait_spi, &g_Spi ) )
+	{
+		return( false );
+	}
+
+	//----------------------------------------------------------------------
+	//	a full frame on both buses
+	//
+	oled_display_set_frame_buffer( &g_I2cDisplay.display, &g_I2cDisplay.frameBuffer );
+	oled_display_set_frame_buffer( &g_SpiDisplay.display, &g_SpiDisplay.frameBuffer );
+	oled_emu_bus_reset_stats( &g_Bus );
+	oled_emu_reset_stats( &g_SpiEmulator );
+
+	oled_display_flush( &g_I2cDisplay.display );
+	oled_display_flush( &g_SpiDisplay.display );
+	oled_spi_wait( &g_Spi );
+
+	ulI2cClocks = (g_Bus.bytes + g_Bus.transactions) * I2C_CLOCKS_PER_BYTE + g_Bus.transactions * I2C_CLOCKS_PER_TRANSACTION;
+	ulSpiClocks = (g_SpiEmulator.commandBytes + g_SpiEmulator.dataBytes) * 8;
+
+	printf(	"%-8s full frame: I2C %5u bytes %6.0f us at 400 kHz, SPI %5u bytes %5.0f us at 10 MHz\n",
+			strChip,
+			(unsigned)(g_Bus.bytes + g_Bus.transactions),
+			ulI2cClocks * 1000000.0 / I2C_TEST_CLOCK,
+			(unsigned)(g_SpiEmulator.commandBytes + g_SpiEmulator.dataBytes),
+			ulSpiClocks * 1000000.0 / SPI_TEST_CLOCK									);
+
+	oled_display_set_frame_buffer( &g_I2cDisplay.display, NULL );
+	oled_display_set_frame_buffer( &g_SpiDisplay.display, NULL );
+	oled_spi_wait( &g_Spi );
+
+	spi_bus_remove_device( g_Spi.device );
+
+	return( oled_test_compare( strChip, "full frame", &g_I2cEmulator, &g_SpiEmulator ) );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	host_spi_attach_display( SPI2_HOST, SPI_TEST_CS_PIN, SPI_TEST_DC_PIN, &g_SpiEmulator );
+
+	failures += run_chip( CHIP_TYPE_SH1106, "sh1106" ) ? 0 : 1;
+	failures += run_chip( CHIP_TYPE_SSD1306, "ssd1306" ) ? 0 : 1;
+	failures += run_chip( CHIP_TYPE_SH1107, "sh1107" ) ? 0 : 1;
+
+	if( (OLED_SPI_QUEUE_DEPTH < host_spi_max_queued()) || (2 > host_spi_max_queued()) )
+	{
+		printf( "queued transfers: %u (depth %u)\n", (unsigned)host_spi_max_queued(), (unsigned)OLED_SPI_QUEUE_DEPTH );
+
+		failures++;
+	}
+
+	printf( "SpiTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
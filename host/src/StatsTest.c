@@ -0,0 +1,386 @@
+//##########################################################################
+//#
+//#		StatsTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the bus statistics of a display
+//#	(oled_display_get_stats).
+//#
+//#	-	the position commands of set_cursor are counted for set_cursor,
+//#		even though they are send with the following print
+//#	-	the transactions and bytes of a print and of a clear are the
+//#		same as counted by the emulated bus
+//#	-	a transaction that runs into the timeout or fails is counted
+//#		as timeout or failure
+//#	-	the counters are zero after a get with reset
+//#
+//#	The display is connected through a transport that sends to the
+//#	emulated bus, but can return an error for the next transaction.
+//#
+//#	Usage:	StatsTest
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	context of the transport: the emulated bus and the error of the
+//	next transaction (ESP_OK: send it)
+//
+typedef struct fault_transport
+{
+	oled_emu_bus_t	*pBus;
+	esp_err_t		 nextError;
+
+} fault_transport_t;
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+esp_err_t _fault_probe( void *pContext, uint8_t address );
+esp_err_t _fault_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length );
+esp_err_t _fault_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length );
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const char g_strHello[]		= "Hello World !";
+
+const oled_transport_t	g_FaultTransport =
+	{
+		.probe		= _fault_probe,
+		.write		= _fault_write,
+		.write_data	= _fault_write_data
+	};
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+fault_transport_t		g_Fault		= { &g_Bus, ESP_OK };
+oled_display_handle_t	g_Display;
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	_fault_take (local)
+//--------------------------------------------------------------------------
+//	error of this transaction, the following ones are send again
+//
+static esp_err_t _fault_take( fault_transport_t *pFault )
+{
+	esp_err_t	result = pFault->nextError;
+
+	pFault->nextError = ESP_OK;
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	_fault_probe (local)
+//--------------------------------------------------------------------------
+//
+esp_err_t _fault_probe( void *pContext, uint8_t address )
+{
+	return( g_oledEmuTransport.probe( ((fault_transport_t *)pContext)->pBus, address ) );
+}
+
+
+//**************************************************************************
+//	_fault_write (local)
+//--------------------------------------------------------------------------
+//
+esp_err_t _fault_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	fault_transport_t	*pFault	= (fault_transport_t *)pContext;
+	esp_err_t			 result	= _fault_take( pFault );
+
+	return( (ESP_OK != result) ? result : g_oledEmuTransport.write( pFault->pBus, address, pBuffer, length ) );
+}
+
+
+//**************************************************************************
+//	_fault_write_data (local)
+//--------------------------------------------------------------------------
+//
+esp_err_t _fault_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length )
+{
+	fault_transport_t	*pFault	= (fault_transport_t *)pContext;
+	esp_err_t			 result	= _fault_take( pFault );
+
+	return( (ESP_OK != result) ? result : g_oledEmuTransport.write_data( pFault->pBus, address, pData, length ) );
+}
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	emulator and display, the statistics of both start at zero
+//
+static bool setup( chip_type_t chipType )
+{
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, chipType, DISPLAY_ADDRESS_TWO );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	g_Fault.nextError = ESP_OK;
+
+	if( 0 != oled_display_init_panel( &g_Display, &g_FaultTransport, &g_Fault, chipType, DISPLAY_ADDRESS_DEFAULT, NULL ) )
+	{
+		return( false );
+	}
+
+	oled_display_reset_stats( &g_Display );
+	oled_emu_bus_reset_stats( &g_Bus );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	check_entry
+//--------------------------------------------------------------------------
+//	The traffic on the bus since the last reset must be counted for the
+//	given entry only. The statistics count the address byte of every
+//	transaction, the bus does not.
+//
+static bool check_entry( const char *strTest, oled_stats_entry_t entry )
+{
+	oled_display_stats_t	stats;
+	oled_stats_counter_t	*pEntry = &stats.entry[ entry ];
+	uint32_t				 transactions	= 0;
+	uint32_t				 bytes			= 0;
+
+	oled_display_get_stats( &g_Display, &stats, true );
+
+	for( int idx = 0 ; OLED_STATS_ENTRIES > idx ; idx++ )
+	{
+		transactions	+= stats.entry[ idx ].transactions;
+		bytes			+= stats.entry[ idx ].bytes;
+	}
+
+	if(		(1 != pEntry->calls)
+		||	(g_Bus.transactions != pEntry->transactions)
+		||	((g_Bus.bytes + g_Bus.transactions) != pEntry->bytes)
+		||	(transactions != pEntry->transactions)
+		||	(bytes != pEntry->bytes) )
+	{
+		printf(	"%s: statistics %u / %u (all entries: %u / %u), bus %u / %u\n",
+				strTest,
+				(unsigned)pEntry->transactions, (unsigned)pEntry->bytes,
+				(unsigned)transactions, (unsigned)bytes,
+				(unsigned)g_Bus.transactions, (unsigned)(g_Bus.bytes + g_Bus.transactions)	);
+
+		return( false );
+	}
+
+	oled_emu_bus_reset_stats( &g_Bus );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	check_cursor
+//--------------------------------------------------------------------------
+//	The position commands are send with the print after set_cursor,
+//	but they are counted for set_cursor.
+//
+static bool check_cursor( void )
+{
+	oled_display_stats_t	stats;
+	oled_stats_counter_t	*pCursor	= &stats.entry[ OLED_STATS_SET_CURSOR ];
+	oled_stats_counter_t	*pPrint		= &stats.entry[ OLED_STATS_PRINT ];
+
+	oled_display_set_cursor( &g_Display, 2, 3 );
+	oled_display_print( &g_Display, g_strHello );
+	oled_display_get_stats( &g_Display, &stats, true );
+
+	if(		(1 != pCursor->calls) || (1 != pCursor->cursorWrites) || (1 != pCursor->transactions)
+		||	(0 != pPrint->cursorWrites)
+		||	(g_Bus.transactions != (pCursor->transactions + pPrint->transactions)) )
+	{
+		printf(	"set_cursor: %u cursor writes / %u transactions (print: %u / %u), bus %u\n",
+				(unsigned)pCursor->cursorWrites, (unsigned)pCursor->transactions,
+				(unsigned)pPrint->cursorWrites, (unsigned)pPrint->transactions,
+				(unsigned)g_Bus.transactions											);
+
+		return( false );
+	}
+
+	oled_emu_bus_reset_stats( &g_Bus );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_traffic
+//--------------------------------------------------------------------------
+//	set_cursor, print and clear
+//
+static bool run_traffic( chip_type_t chipType, const char *strChip )
+{
+	bool	bOk;
+
+	if( !setup( chipType ) )
+	{
+		printf( "%s: init failed\n", strChip );
+
+		return( false );
+	}
+
+	bOk =		check_cursor()
+			&&	(oled_display_print( &g_Display, g_strHello ), check_entry( "print", OLED_STATS_PRINT ))
+			&&	(oled_display_clear( &g_Display ), check_entry( "clear", OLED_STATS_CLEAR ));
+
+	printf( "%-40s %s\n", strChip, bOk ? "ok" : "FAILED" );
+
+	return( bOk );
+}
+
+
+//**************************************************************************
+//	run_error
+//--------------------------------------------------------------------------
+//	The first transaction of the second print returns the given error
+//	(the first one sends the position commands of the cursor).
+//
+static bool run_error( esp_err_t error, const char *strTest )
+{
+	oled_display_stats_t	stats;
+	oled_stats_counter_t	*pPrint = &stats.entry[ OLED_STATS_PRINT ];
+	bool					 bTimeout = (ESP_ERR_TIMEOUT == error);
+
+	if( !setup( CHIP_TYPE_SSD1306 ) )
+	{
+		printf( "%s: init failed\n", strTest );
+
+		return( false );
+	}
+
+	oled_display_print( &g_Display, g_strHello );
+	oled_display_reset_stats( &g_Display );
+
+	g_Fault.nextError = error;
+
+	oled_display_print( &g_Display, g_strHello );
+	oled_display_get_stats( &g_Display, &stats, false );
+
+	if(		(0 == pPrint->transactions)
+		||	((bTimeout ? 1 : 0) != pPrint->timeouts)
+		||	((bTimeout ? 0 : 1) != pPrint->failures) )
+	{
+		printf(	"%-40s FAILED (timeouts: %u, failures: %u)\n",
+				strTest, (unsigned)pPrint->timeouts, (unsigned)pPrint->failures	);
+
+		return( false );
+	}
+
+	printf( "%-40s ok\n", strTest );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_reset
+//--------------------------------------------------------------------------
+//	After a get with reset all counters are zero.
+//
+static bool run_reset( void )
+{
+	static const oled_display_stats_t	zero;
+	oled_display_stats_t				stats;
+	oled_display_stats_t				statsBefore;
+
+	if( !setup( CHIP_TYPE_SH1106 ) )
+	{
+		printf( "reset: init failed\n" );
+
+		return( false );
+	}
+
+	oled_display_print( &g_Display, g_strHello );
+	oled_display_clear_line( &g_Display, 0 );
+	g_Fault.nextError = ESP_FAIL;
+	oled_display_print( &g_Display, g_strHello );
+
+	oled_display_get_stats( &g_Display, &statsBefore, true );
+	oled_display_get_stats( &g_Display, &stats, false );
+
+	if( (0 == memcmp( &statsBefore, &zero, sizeof( zero ) )) || (0 != memcmp( &stats, &zero, sizeof( zero ) )) )
+	{
+		printf( "%-40s FAILED\n", "get with reset" );
+
+		return( false );
+	}
+
+	printf( "%-40s ok\n", "get with reset" );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	failures += run_traffic( CHIP_TYPE_SH1106, "sh1106" ) ? 0 : 1;
+	failures += run_traffic( CHIP_TYPE_SSD1306, "ssd1306" ) ? 0 : 1;
+	failures += run_traffic( CHIP_TYPE_SH1107, "sh1107" ) ? 0 : 1;
+	failures += run_error( ESP_ERR_TIMEOUT, "timeout" ) ? 0 : 1;
+	failures += run_error( ESP_FAIL, "failure" ) ? 0 : 1;
+	failures += run_reset() ? 0 : 1;
+
+	printf( "StatsTest: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
@@ -0,0 +1,440 @@
+//##########################################################################
+//#
+//#		StressTest
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks that the library can be used from different
+//#	threads at the same time.
+//#
+//#	1.	two displays on one shared I²C bus, every display is driven by
+//#		its own thread (no lock needed)
+//#	2.	one display with enabled lock and frame buffer, driven by two
+//#		threads that print into different lines and flush
+//#	3.	the same with asynchronous output (render task) and without
+//#		frame buffer, the main thread waits for the queue to drain.
+//#		A wait that runs out of time must return after its time, even
+//#		if the waiting thread is notified again and again.
+//#	4.	print, println with wrap, clear, clear_line and flush on the
+//#		I²C driver (legacy transport) without heap allocations
+//#
+//#	After the threads have finished the display RAM of every emulated
+//#	controller must be the same as after running the same output
+//#	sequence in one thread.
+//#
+//#	Usage:	StressTest [loops]
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <esp_timer.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define STRESS_LOOPS_DEFAULT		2000
+
+#define WAIT_TIMEOUT_TICKS			50
+#define WAIT_NOTIFICATIONS			20		//	one every 10 ticks
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	the work of one thread
+//
+typedef struct stress_worker
+{
+	oled_display_handle_t	*pDisplay;
+	uint8_t					 firstLine;		//	lines used by this thread
+	uint8_t					 lineStep;
+	bool					 bShared;		//	display used by another thread too
+	uint32_t				 loops;
+
+} stress_worker_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_arEmulator[ 2 ];
+oled_display_handle_t	g_arDisplay[ 2 ];
+
+oled_emu_bus_t			g_RefBus;
+oled_emu_t				g_arRefEmulator[ 2 ];
+oled_display_handle_t	g_arRefDisplay[ 2 ];
+
+oled_frame_buffer_t		g_FrameBuffer;
+oled_frame_buffer_t		g_RefFrameBuffer;
+
+oled_async_t			g_Async;
+uint32_t				g_ulFencesDone		= 0;
+uint32_t				g_ulLastFence		= 0;
+
+
+//**************************************************************************
+//	stress_print_line
+//--------------------------------------------------------------------------
+//	Print one line of the given thread.
+//	On a shared display the lock is held for the complete line,
+//	so the cursor can not be moved by the other thread.
+//
+static void stress_print_line( stress_worker_t *pWorker, uint8_t textLine, uint32_t loop )
+{
+	char	strText[ 24 ];
+
+	snprintf( strText, sizeof( strText ), "L%u #%06u", (unsigned)textLine, (unsigned)loop );
+
+	oled_display_lock( pWorker->pDisplay );
+
+	oled_display_set_inverse_font( pWorker->pDisplay, 0 != (loop & 0x01) );
+	oled_display_set_cursor( pWorker->pDisplay, textLine, (uint8_t)(loop % 5) );
+	oled_display_print( pWorker->pDisplay, strText );
+	oled_display_set_inverse_font( pWorker->pDisplay, false );
+
+	oled_display_unlock( pWorker->pDisplay );
+}
+
+
+//**************************************************************************
+//	stress_worker
+//--------------------------------------------------------------------------
+//	Output sequence of one thread. The last loop leaves a known content.
+//
+static void *stress_worker( void *pArg )
+{
+	stress_worker_t	*pWorker = (stress_worker_t *)pArg;
+
+
+	for( uint32_t loop = 0 ; pWorker->loops > loop ; loop++ )
+	{
+		for( uint8_t line = pWorker->firstLine ; oled_display_max_text_lines( pWorker->pDisplay ) > line ; line += pWorker->lineStep )
+		{
+			if( 0 == (loop % 7) )
+			{
+				oled_display_clear_line( pWorker->pDisplay, line );
+			}
+
+			stress_print_line( pWorker, line, loop );
+		}
+
+		if( !pWorker->bShared && (0 == (loop % 97)) )
+		{
+			oled_display_clear( pWorker->pDisplay );
+		}
+
+		oled_display_flush( pWorker->pDisplay );
+	}
+
+	return( NULL );
+}
+
+
+//**************************************************************************
+//	fence_done
+//--------------------------------------------------------------------------
+//	done callback of the asynchronous output (render task context)
+//
+static void fence_done( oled_display_handle_t *pHandle, uint32_t fence, void *pUser )
+{
+	(void)pHandle;
+	(void)pUser;
+
+	g_ulFencesDone++;
+	g_ulLastFence = fence;
+}
+
+
+//**************************************************************************
+//	wait_notifier
+//--------------------------------------------------------------------------
+//	Wake the given task up again and again, like notifications of
+//	earlier fences would do.
+//
+static void *wait_notifier( void *pArg )
+{
+	TaskHandle_t	task = (TaskHandle_t)pArg;
+
+	for( int idx = 0 ; WAIT_NOTIFICATIONS > idx ; idx++ )
+	{
+		vTaskDelay( 10 );
+		xTaskNotifyGiveIndexed( task, OLED_NOTIFY_INDEX );
+	}
+
+	return( NULL );
+}
+
+
+//**************************************************************************
+//	check_wait_timeout
+//--------------------------------------------------------------------------
+//	The render task is blocked by the taken bus, so the wait runs out of
+//	time. It must return after its time, not after the last
+//	notification.
+//	The text is the one printed after the render task is stopped, so
+//	the content stays the same as on the reference display.
+//
+static bool check_wait_timeout( oled_display_handle_t *pHandle, oled_emu_bus_t *pBus )
+{
+	pthread_t	notifier;
+	int64_t		startTime;
+	int64_t		waitTime;
+	bool		bWaited;
+	bool		bOk;
+
+	oled_emu_bus_lock( pBus );
+
+	oled_display_set_cursor( pHandle, 3, 3 );
+	oled_display_print( pHandle, "stopped" );
+
+	pthread_create( &notifier, NULL, wait_notifier, xTaskGetCurrentTaskHandle() );
+
+	startTime	= esp_timer_get_time();
+	bWaited		= oled_display_wait( pHandle, WAIT_TIMEOUT_TICKS );
+	waitTime	= esp_timer_get_time() - startTime;
+
+	oled_emu_bus_unlock( pBus );
+	pthread_join( notifier, NULL );
+
+	bOk = !bWaited && ((3 * WAIT_TIMEOUT_TICKS * 1000) > waitTime) && oled_display_wait( pHandle, portMAX_DELAY );
+
+	printf( "%-40s %s (%u ms)\n", "wait with time out", bOk ? "ok    " : "FAILED", (unsigned)(waitTime / 1000) );
+
+	return( bOk );
+}
+
+
+//**************************************************************************
+//	setup_bus
+//--------------------------------------------------------------------------
+//	one ssd1306 and one sh1106 on the same bus
+//
+static void setup_bus( oled_emu_bus_t *pBus, oled_emu_t *pEmulators, i2c_port_t port )
+{
+	oled_emu_bus_init( pBus );
+	oled_emu_init( &pEmulators[ 0 ], CHIP_TYPE_SSD1306, DISPLAY_ADDRESS_ONE );
+	oled_emu_init( &pEmulators[ 1 ], CHIP_TYPE_SH1106, DISPLAY_ADDRESS_TWO );
+	oled_emu_bus_attach( pBus, &pEmulators[ 0 ] );
+	oled_emu_bus_attach( pBus, &pEmulators[ 1 ] );
+	host_i2c_attach_bus( port, pBus );
+}
+
+
+//**************************************************************************
+//	compare_ram
+//--------------------------------------------------------------------------
+//
+static bool compare_ram( const char *strTest, const oled_emu_t *pEmu, const oled_emu_t *pRefEmu )
+{
+	if( 0 != memcmp( pEmu->ram, pRefEmu->ram, sizeof( pEmu->ram ) ) )
+	{
+		printf( "%-40s FAILED (display 0x%02X)\n", strTest, pEmu->address );
+
+		return( false );
+	}
+
+	printf( "%-40s ok     (display 0x%02X)\n", strTest, pEmu->address );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	stress_worker_t	arWorker[ 2 ];
+	pthread_t		arThread[ 2 ];
+	uint32_t		loops	= STRESS_LOOPS_DEFAULT;
+	bool			bOk		= true;
+
+
+	if( 1 < argc )
+	{
+		loops = (uint32_t)strtoul( argv[ 1 ], NULL, 0 );
+	}
+
+	setup_bus( &g_Bus, g_arEmulator, I2C_NUM_0 );
+	setup_bus( &g_RefBus, g_arRefEmulator, I2C_NUM_1 );
+
+	//------------------------------------------------------------------
+	//	1.	two displays, two threads
+	//
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		oled_display_init( &g_arDisplay[ idx ], I2C_NUM_0, g_arEmulator[ idx ].chipType, g_arEmulator[ idx ].address );
+		oled_display_init( &g_arRefDisplay[ idx ], I2C_NUM_1, g_arRefEmulator[ idx ].chipType, g_arRefEmulator[ idx ].address );
+		oled_display_set_print_mode( &g_arDisplay[ idx ], PM_SCROLL_LINE );
+		oled_display_set_print_mode( &g_arRefDisplay[ idx ], PM_SCROLL_LINE );
+
+		arWorker[ idx ] = (stress_worker_t){ &g_arDisplay[ idx ], 0, 1, false, loops };
+	}
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		pthread_create( &arThread[ idx ], NULL, stress_worker, &arWorker[ idx ] );
+	}
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		pthread_join( arThread[ idx ], NULL );
+
+		arWorker[ idx ].pDisplay = &g_arRefDisplay[ idx ];
+		stress_worker( &arWorker[ idx ] );
+
+		bOk = compare_ram( "two displays, shared bus", &g_arEmulator[ idx ], &g_arRefEmulator[ idx ] ) && bOk;
+	}
+
+	//------------------------------------------------------------------
+	//	2.	one display with lock and frame buffer, two threads
+	//
+	oled_display_enable_lock( &g_arDisplay[ 0 ] );
+	oled_display_clear( &g_arDisplay[ 0 ] );
+	oled_display_set_frame_buffer( &g_arDisplay[ 0 ], &g_FrameBuffer );
+	oled_display_clear( &g_arRefDisplay[ 0 ] );
+	oled_display_set_frame_buffer( &g_arRefDisplay[ 0 ], &g_RefFrameBuffer );
+
+	arWorker[ 0 ] = (stress_worker_t){ &g_arDisplay[ 0 ], 0, 2, true, loops };
+	arWorker[ 1 ] = (stress_worker_t){ &g_arDisplay[ 0 ], 1, 2, true, loops };
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		pthread_create( &arThread[ idx ], NULL, stress_worker, &arWorker[ idx ] );
+	}
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		pthread_join( arThread[ idx ], NULL );
+	}
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		arWorker[ idx ].pDisplay = &g_arRefDisplay[ 0 ];
+		stress_worker( &arWorker[ idx ] );
+	}
+
+	bOk = compare_ram( "one display with lock, two threads", &g_arEmulator[ 0 ], &g_arRefEmulator[ 0 ] ) && bOk;
+
+	//------------------------------------------------------------------
+	//	3.	one display with lock and render task, two threads
+	//
+	oled_display_enable_lock( &g_arDisplay[ 1 ] );
+	oled_display_clear( &g_arDisplay[ 1 ] );
+	oled_display_clear( &g_arRefDisplay[ 1 ] );
+
+	if( 0 != oled_display_start_async( &g_arDisplay[ 1 ], &g_Async, 5, fence_done, NULL ) )
+	{
+		printf( "render task could not be started\n" );
+
+		return( 1 );
+	}
+
+	arWorker[ 0 ] = (stress_worker_t){ &g_arDisplay[ 1 ], 0, 2, true, loops };
+	arWorker[ 1 ] = (stress_worker_t){ &g_arDisplay[ 1 ], 1, 2, true, loops };
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		pthread_create( &arThread[ idx ], NULL, stress_worker, &arWorker[ idx ] );
+	}
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		pthread_join( arThread[ idx ], NULL );
+	}
+
+	//------------------------------------------------------------------
+	//	one fence with callback only, then flush and wait
+	//	(the wait sets a fence too)
+	//
+	uint32_t fence = oled_display_fence( &g_arDisplay[ 1 ] );
+
+	if( !oled_display_wait( &g_arDisplay[ 1 ], 5000 ) || (2 != g_ulFencesDone) || ((fence + 1) != g_ulLastFence) )
+	{
+		printf( "wait for the render task FAILED (fences done: %u)\n", (unsigned)g_ulFencesDone );
+
+		bOk = false;
+	}
+
+	for( int idx = 0 ; 2 > idx ; idx++ )
+	{
+		arWorker[ idx ].pDisplay = &g_arRefDisplay[ 1 ];
+		stress_worker( &arWorker[ idx ] );
+	}
+
+	bOk = compare_ram( "render task, two threads", &g_arEmulator[ 1 ], &g_arRefEmulator[ 1 ] ) && bOk;
+
+	bOk = check_wait_timeout( &g_arDisplay[ 1 ], &g_Bus ) && bOk;
+
+	//------------------------------------------------------------------
+	//	after the render task is stopped the output is direct again
+	//
+	oled_display_set_cursor( &g_arDisplay[ 1 ], 3, 3 );
+	oled_display_stop_async( &g_arDisplay[ 1 ] );
+	oled_display_print( &g_arDisplay[ 1 ], "stopped" );
+	oled_display_set_cursor( &g_arRefDisplay[ 1 ], 3, 3 );
+	oled_display_print( &g_arRefDisplay[ 1 ], "stopped" );
+
+	bOk = compare_ram( "render task stopped", &g_arEmulator[ 1 ], &g_arRefEmulator[ 1 ] ) && bOk;
+
+	//------------------------------------------------------------------
+	//	4.	no heap allocations by the I²C driver (legacy transport),
+	//		with and without frame buffer
+	//
+	uint32_t ulAllocations = host_i2c_allocations();
+
+	oled_display_set_cursor( &g_arRefDisplay[ 0 ], 0, 0 );
+	oled_display_print( &g_arRefDisplay[ 0 ], "Hello World !" );
+	oled_display_println( &g_arRefDisplay[ 0 ], "This text is longer than one line of the display" );
+	oled_display_clear_line( &g_arRefDisplay[ 0 ], 2 );
+	oled_display_flush( &g_arRefDisplay[ 0 ] );
+	oled_display_clear( &g_arRefDisplay[ 0 ] );
+	oled_display_flush( &g_arRefDisplay[ 0 ] );
+	oled_display_set_frame_buffer( &g_arRefDisplay[ 0 ], NULL );
+	oled_display_print( &g_arRefDisplay[ 0 ], "Hello World !" );
+	oled_display_println( &g_arRefDisplay[ 0 ], "This text is longer than one line of the display" );
+	oled_display_clear_line( &g_arRefDisplay[ 0 ], 2 );
+	oled_display_clear( &g_arRefDisplay[ 0 ] );
+
+	ulAllocations = host_i2c_allocations() - ulAllocations;
+
+	printf( "%-40s %s (%u)\n", "heap allocations, legacy transport", (0 == ulAllocations) ? "ok    " : "FAILED", (unsigned)ulAllocations );
+
+	bOk = (0 == ulAllocations) && bOk;
+
+	return( bOk ? 0 : 1 );
+}
@@ -0,0 +1,549 @@
+//##########################################################################
+//#
+//#		Utf8Test
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	This program checks the characters beyond ASCII (UTF-8 text).
+//#
+//#	-	Text with umlauts and symbols is printed as UTF-8 with
+//#		oled_display_print and on a reference display character by
+//#		character as Latin-1 with oled_display_print_char, both panels
+//#		must be the same. Broken sequences and characters without glyph
+//#		are skipped. This is done with the text shadow, with a frame
+//#		buffer and with asynchronous output (a sequence at the end of a
+//#		render command must not be split).
+//#	-	Every extended character has its own glyph, the degree sign and
+//#		the a umlaut are checked column by column.
+//#	-	A scroll region with umlauts is scrolled by the text shadow.
+//#	-	Both proportional fonts print the extended characters, every
+//#		pixel is checked against the glyphs of the font.
+//#
+//#	Usage:	Utf8Test
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <SimpleOledLib.h>
+#include "oled_emulator.h"
+#include "oled_test.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define TEST_WIDTH					128
+#define TEST_HEIGHT					64
+#define TEST_SCROLL_LINES			12			//	lines printed into the region
+#define TEST_FIRST_LINE				1			//	scroll region
+#define TEST_LAST_LINE				6
+#define TEST_FONT_LINE				3
+#define TEST_EXTENDED_CHARS			15			//	in g_strExtended
+
+#define REGION_LINES				(TEST_LAST_LINE - TEST_FIRST_LINE + 1)
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct utf8_case
+{
+	const char	*strName;
+	chip_type_t	 chipType;
+	bool		 bFrameBuffer;
+	bool		 bAsync;
+
+} utf8_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const utf8_case_t	g_arCase[] =
+	{
+		{ "sh1106 shadow",			CHIP_TYPE_SH1106,	false,	false	},
+		{ "ssd1306 shadow",			CHIP_TYPE_SSD1306,	false,	false	},
+		{ "ssd1306 frame buffer",	CHIP_TYPE_SSD1306,	true,	false	},
+		{ "sh1106 async",			CHIP_TYPE_SH1106,	false,	true	}
+	};
+
+#define UTF8_CASES		(sizeof( g_arCase ) / sizeof( g_arCase[ 0 ] ))
+
+//----------------------------------------------------------------------
+//	the same lines as UTF-8 and as Latin-1, the second line has a
+//	sequence at the end of the first render command (16 bytes)
+//
+const char *g_arstrUtf8[] =
+	{
+		"Temp 21.5\xC2\xB0" "C\n",
+		"x\xC3\xA4\xC3\xB6\xC3\xBC\xC3\x84\xC3\x96\xC3\x9C\xC3\xA4\xC3\xB6\xC3\xBC\xC3\x84\xC3\x96\xC3\x9C\n",
+		"\xC2\xB1" "0.5 \xC2\xB5g/m\xC2\xB3 \xC2\xB2\n",
+		"Stra\xC3\x9F" "e Gr\xC3\xB6\xC3\x9F" "e\n",
+		"A\xC3" "B\x80" "C\xF0\x9F\x98\x80" "D\xE2\x82" "E\n",
+		"\xE2\x98\x83" "F\xCE" "G\xE2\x82"
+	};
+
+const char *g_arstrLatin1[] =
+	{
+		"Temp 21.5\xB0" "C\n",
+		"x\xE4\xF6\xFC\xC4\xD6\xDC\xE4\xF6\xFC\xC4\xD6\xDC\n",
+		"\xB1" "0.5 \xB5g/m\xB3 \xB2\n",
+		"Stra\xDF" "e Gr\xF6\xDF" "e\n",
+		"ABCDE\n",
+		"FG"
+	};
+
+#define TEXT_LINES		(sizeof( g_arstrUtf8 ) / sizeof( g_arstrUtf8[ 0 ] ))
+
+//----------------------------------------------------------------------
+//	all extended characters of the fonts and the known glyphs
+//
+const char	g_strExtended[]		= "\xC2\xB0\xC2\xB1\xC2\xB2\xC2\xB3\xC2\xB5\xC3\x84\xC3\x96\xC3\x9C"
+								  "\xC3\x9F\xC3\xA4\xC3\xB6\xC3\xBC\xCE\xA9\xE2\x82\xAC?";
+
+const uint8_t	g_arusDegree[ 8 ]	= { 0x02, 0x07, 0x05, 0x07, 0x02, 0x00, 0x00, 0x00 };
+const uint8_t	g_arusUmlautA[ 8 ]	= { 0x21, 0x75, 0x54, 0x54, 0x3D, 0x79, 0x40, 0x00 };
+
+//----	text for the proportional fonts and for the scroll region  --------
+const char	g_strFontText[]		= "21.5\xC2\xB0" "C Gr\xC3\xB6\xC3\x9F" "e \xCE\xA9 \xE2\x82\xAC \xC3\x84\xC3\x96\xC3\x9C";
+const char	g_strRegionText[]	= "\xC3\x84rger \xC3\xBC" "ber %02d\xC2\xB0";
+
+oled_emu_bus_t			g_Bus;
+oled_emu_t				g_Emulator;
+oled_display_handle_t	g_Display;
+oled_frame_buffer_t		g_FrameBuffer;
+oled_async_t			g_Async;
+
+oled_emu_bus_t			g_RefBus;
+oled_emu_t				g_RefEmulator;
+oled_display_handle_t	g_RefDisplay;
+
+uint8_t					g_arusExpected[ TEST_WIDTH ];
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	setup
+//--------------------------------------------------------------------------
+//	the display under test and the reference display, both cleared
+//
+static bool setup( chip_type_t chipType )
+{
+	oled_emu_bus_init( &g_Bus );
+	oled_emu_init( &g_Emulator, chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_Bus, &g_Emulator );
+
+	oled_emu_bus_init( &g_RefBus );
+	oled_emu_init( &g_RefEmulator, chipType, DISPLAY_ADDRESS_ONE );
+	oled_emu_bus_attach( &g_RefBus, &g_RefEmulator );
+
+	if(		(0 != oled_display_init_panel( &g_Display, &g_oledEmuTransport, &g_Bus, chipType, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x64 ))
+		||	(0 != oled_display_init_panel( &g_RefDisplay, &g_oledEmuTransport, &g_RefBus, chipType, DISPLAY_ADDRESS_ONE, &g_oledGeometry128x64 )) )
+	{
+		return( false );
+	}
+
+	oled_display_set_print_mode( &g_Display, PM_OVERWRITE_SAME_LINE );
+	oled_display_set_print_mode( &g_RefDisplay, PM_OVERWRITE_SAME_LINE );
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	same_panels
+//--------------------------------------------------------------------------
+//
+static bool same_panels( const char *strName )
+{
+	for( uint8_t y = 0 ; TEST_HEIGHT > y ; y++ )
+	{
+		for( uint8_t x = 0 ; TEST_WIDTH > x ; x++ )
+		{
+			if( oled_emu_pixel( &g_Emulator, x, y ) != oled_emu_pixel( &g_RefEmulator, x, y ) )
+			{
+				printf( "%s: pixel %u / %u is wrong\n", strName, x, y );
+
+				return( false );
+			}
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	panel_column
+//--------------------------------------------------------------------------
+//	the pixels of one column of a text line as byte
+//
+static uint8_t panel_column( uint8_t textLine, uint8_t x )
+{
+	uint8_t	usColumn = 0;
+
+	for( uint8_t row = 0 ; 8 > row ; row++ )
+	{
+		if( oled_emu_pixel( &g_Emulator, x, textLine * 8 + row ) )
+		{
+			usColumn |= 1 << row;
+		}
+	}
+
+	return( usColumn );
+}
+
+
+//**************************************************************************
+//	next_codepoint
+//--------------------------------------------------------------------------
+//	the codepoint of the next character of a valid UTF-8 text
+//
+static uint32_t next_codepoint( const char **ppText )
+{
+	const uint8_t	*pText	= (const uint8_t *)*ppText;
+	uint32_t		 ulCodepoint;
+
+	if( 0x80 > pText[ 0 ] )
+	{
+		ulCodepoint = pText[ 0 ];
+		*ppText += 1;
+	}
+	else if( 0xE0 > pText[ 0 ] )
+	{
+		ulCodepoint = ((pText[ 0 ] & 0x1F) << 6) | (pText[ 1 ] & 0x3F);
+		*ppText += 2;
+	}
+	else
+	{
+		ulCodepoint = ((pText[ 0 ] & 0x0F) << 12) | ((pText[ 1 ] & 0x3F) << 6) | (pText[ 2 ] & 0x3F);
+		*ppText += 3;
+	}
+
+	return( ulCodepoint );
+}
+
+
+//**************************************************************************
+//	glyph_of_codepoint
+//--------------------------------------------------------------------------
+//	the glyph of the proportional font (linear search, NULL: none)
+//
+static const oled_glyph_t *glyph_of_codepoint( const oled_font_t *pFont, uint32_t codepoint )
+{
+	if( (pFont->firstChar <= codepoint) && (pFont->lastChar >= codepoint) )
+	{
+		return( &pFont->pGlyphs[ codepoint - pFont->firstChar ] );
+	}
+
+	for( uint16_t idx = 0 ; pFont->extendedChars > idx ; idx++ )
+	{
+		if( pFont->pCodepoints[ idx ] == codepoint )
+		{
+			return( &pFont->pGlyphs[ pFont->lastChar - pFont->firstChar + 1 + idx ] );
+		}
+	}
+
+	return( NULL );
+}
+
+
+//**************************************************************************
+//	run_case
+//--------------------------------------------------------------------------
+//	the UTF-8 lines against the Latin-1 lines on the reference display
+//
+static bool run_case( const utf8_case_t *pCase )
+{
+	if( !setup( pCase->chipType ) )
+	{
+		printf( "%s: init failed\n", pCase->strName );
+
+		return( false );
+	}
+
+	oled_display_set_frame_buffer( &g_Display, pCase->bFrameBuffer ? &g_FrameBuffer : NULL );
+
+	if( pCase->bAsync && (0 != oled_display_start_async( &g_Display, &g_Async, 5, NULL, NULL )) )
+	{
+		printf( "%s: render task could not be started\n", pCase->strName );
+
+		return( false );
+	}
+
+	for( size_t idx = 0 ; TEXT_LINES > idx ; idx++ )
+	{
+		oled_display_print( &g_Display, g_arstrUtf8[ idx ] );
+
+		for( const char *pText = g_arstrLatin1[ idx ] ; 0x00 != *pText ; pText++ )
+		{
+			oled_display_print_char( &g_RefDisplay, (uint8_t)*pText );
+		}
+	}
+
+	if( pCase->bAsync )
+	{
+		oled_display_wait( &g_Display, portMAX_DELAY );
+		oled_display_stop_async( &g_Display );
+	}
+
+	if( pCase->bFrameBuffer )
+	{
+		oled_display_flush( &g_Display );
+		oled_display_set_frame_buffer( &g_Display, NULL );
+	}
+
+	if( (g_Display.textLine != g_RefDisplay.textLine) || (g_Display.textColumn != g_RefDisplay.textColumn) )
+	{
+		printf( "%s: cursor %u / %u instead of %u / %u\n", pCase->strName,
+				g_Display.textLine, g_Display.textColumn, g_RefDisplay.textLine, g_RefDisplay.textColumn );
+
+		return( false );
+	}
+
+	return( same_panels( pCase->strName ) );
+}
+
+
+//**************************************************************************
+//	run_glyphs
+//--------------------------------------------------------------------------
+//	every extended character has its own glyph (not blank, not the same
+//	as another one or the question mark)
+//
+static bool run_glyphs( void )
+{
+	uint8_t	arusGlyph[ OLED_TEXT_COLUMNS ][ 8 ];
+	uint8_t	usChars;
+
+	setup( CHIP_TYPE_SH1106 );
+
+	oled_display_print( &g_Display, g_strExtended );
+	usChars = g_Display.textColumn;
+
+	if( TEST_EXTENDED_CHARS != usChars )
+	{
+		printf( "glyphs: %u characters printed\n", usChars );
+
+		return( false );
+	}
+
+	for( uint8_t idx = 0 ; usChars > idx ; idx++ )
+	{
+		for( uint8_t column = 0 ; 8 > column ; column++ )
+		{
+			arusGlyph[ idx ][ column ] = panel_column( 0, idx * 8 + column );
+		}
+
+		if( 0 == (arusGlyph[ idx ][ 0 ] | arusGlyph[ idx ][ 1 ] | arusGlyph[ idx ][ 2 ] | arusGlyph[ idx ][ 3 ]) )
+		{
+			printf( "glyphs: character %u is blank\n", idx );
+
+			return( false );
+		}
+
+		for( uint8_t other = 0 ; idx > other ; other++ )
+		{
+			if( 0 == memcmp( arusGlyph[ idx ], arusGlyph[ other ], 8 ) )
+			{
+				printf( "glyphs: characters %u and %u are the same\n", other, idx );
+
+				return( false );
+			}
+		}
+	}
+
+	if( (0 != memcmp( arusGlyph[ 0 ], g_arusDegree, 8 )) || (0 != memcmp( arusGlyph[ 9 ], g_arusUmlautA, 8 )) )
+	{
+		printf( "glyphs: degree sign or a umlaut is wrong\n" );
+
+		return( false );
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_scroll_region
+//--------------------------------------------------------------------------
+//	The lines with umlauts are scrolled by the text shadow, the reference
+//	prints the last lines at their places.
+//
+static bool run_scroll_region( void )
+{
+	char	strText[ 32 ];
+	int32_t	first;
+
+	setup( CHIP_TYPE_SSD1306 );
+
+	oled_display_set_print_mode( &g_Display, PM_SCROLL_LINE );
+	oled_display_set_scroll_region( &g_Display, TEST_FIRST_LINE, TEST_LAST_LINE );
+	oled_display_set_cursor( &g_Display, TEST_FIRST_LINE, 0 );
+
+	for( int32_t line = 0 ; TEST_SCROLL_LINES > line ; line++ )
+	{
+		snprintf( strText, sizeof( strText ), g_strRegionText, (int)line );
+
+		oled_emu_reset_stats( &g_Emulator );
+		oled_display_println( &g_Display, strText );
+
+		//------------------------------------------------------------------
+		//	after a scroll the last line of the region is empty
+		//
+		first = (REGION_LINES - 2 < line) ? (line - (REGION_LINES - 2)) : 0;
+
+		oled_display_clear( &g_RefDisplay );
+
+		for( int32_t shown = first ; line >= shown ; shown++ )
+		{
+			snprintf( strText, sizeof( strText ), g_strRegionText, (int)shown );
+
+			oled_display_set_cursor( &g_RefDisplay, TEST_FIRST_LINE + (shown - first), 0 );
+			oled_display_print( &g_RefDisplay, strText );
+		}
+
+		if( !same_panels( "scroll region" ) )
+		{
+			printf( "scroll region: after line %d\n", (int)line );
+
+			return( false );
+		}
+
+		if( ((REGION_LINES - 1) <= line) && ((REGION_LINES * TEST_WIDTH) <= g_Emulator.dataBytes) )
+		{
+			printf( "scroll region: %u bytes for a scrolled line\n", (unsigned)g_Emulator.dataBytes );
+
+			return( false );
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	run_font
+//--------------------------------------------------------------------------
+//	the extended characters with a proportional font
+//
+static bool run_font( const char *strName, const oled_font_t *pFont )
+{
+	const oled_glyph_t	*pGlyph;
+	const char			*pText		= g_strFontText;
+	uint16_t			 x			= 0;
+	uint8_t				 usEnd;
+
+	memset( g_arusExpected, 0, sizeof( g_arusExpected ) );
+
+	while( 0x00 != *pText )
+	{
+		pGlyph = glyph_of_codepoint( pFont, next_codepoint( &pText ) );
+
+		if( NULL == pGlyph )
+		{
+			printf( "%s: character without glyph\n", strName );
+
+			return( false );
+		}
+
+		for( uint8_t column = 0 ; (pGlyph->width > column) && (TEST_WIDTH > x) ; column++ )
+		{
+			g_arusExpected[ x++ ] = oled_test_glyph_column( pFont, pGlyph, column );
+		}
+
+		x += pGlyph->advance - pGlyph->width;
+	}
+
+	setup( CHIP_TYPE_SSD1306 );
+
+	usEnd = oled_display_print_font( &g_Display, pFont, TEST_FONT_LINE, 0, g_strFontText );
+
+	if( (x != usEnd) || (x != oled_font_text_width( pFont, g_strFontText )) )
+	{
+		printf( "%s: text ends at %u instead of %u\n", strName, usEnd, (unsigned)x );
+
+		return( false );
+	}
+
+	for( uint8_t column = 0 ; usEnd > column ; column++ )
+	{
+		if( panel_column( TEST_FONT_LINE, column ) != g_arusExpected[ column ] )
+		{
+			printf( "%s: column %u is wrong\n", strName, column );
+
+			return( false );
+		}
+	}
+
+	//----------------------------------------------------------------------
+	//	a character without glyph and a broken sequence have no width
+	//
+	if( oled_font_text_width( pFont, "a\xE2\x98\x83" "b\xC3" ) != oled_font_text_width( pFont, "ab" ) )
+	{
+		printf( "%s: unknown characters have a width\n", strName );
+
+		return( false );
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	main
+//--------------------------------------------------------------------------
+//
+int main( int argc, char *argv[] )
+{
+	int	failures = 0;
+
+	(void)argc;
+	(void)argv;
+
+	for( size_t idx = 0 ; UTF8_CASES > idx ; idx++ )
+	{
+		failures += run_case( &g_arCase[ idx ] ) ? 0 : 1;
+	}
+
+	failures += run_glyphs() ? 0 : 1;
+	failures += run_scroll_region() ? 0 : 1;
+	failures += run_font( "5x7", &g_oledFont5x7 ) ? 0 : 1;
+	failures += run_font( "3x5", &g_oledFont3x5 ) ? 0 : 1;
+
+	printf( "Utf8Test: %s\n", (0 == failures) ? "passed" : "FAILED" );
+
+	return( (0 == failures) ? 0 : 1 );
+}
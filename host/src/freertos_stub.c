@@ -0,0 +1,649 @@
+//##########################################################################
+//#
+//#		freertos_stub.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Host stand-in for the FreeRTOS functions used by the library.
+//#	Everything is mapped onto POSIX threads, one tick is one millisecond.
+//#	The high resolution timer of ESP-IDF (esp_timer) is placed here too.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	task control block of the calling thread
+//	g_HostForeignTask is used for threads not created by xTaskCreateStatic
+//
+_Thread_local StaticTask_t	*g_pHostCurrentTask	= NULL;
+_Thread_local StaticTask_t	 g_HostForeignTask;
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+void _host_init_task( StaticTask_t *pTask );
+void *_host_task_entry( void *pArg );
+bool _host_deadline( TickType_t ticksToWait, struct timespec *pDeadline );
+bool _host_wait( pthread_cond_t *pCond, pthread_mutex_t *pMutex, TickType_t ticksToWait, const struct timespec *pDeadline );
+void _host_unlock( void *pMutex );
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	xSemaphoreCreateRecursiveMutexStatic
+//--------------------------------------------------------------------------
+//
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic( StaticSemaphore_t *pBuffer )
+{
+	pthread_mutexattr_t	attr;
+
+	if( NULL == pBuffer )
+	{
+		return( NULL );
+	}
+
+	pthread_mutexattr_init( &attr );
+	pthread_mutexattr_settype( &attr, PTHREAD_MUTEX_RECURSIVE );
+	pthread_mutex_init( &pBuffer->mutex, &attr );
+	pthread_mutexattr_destroy( &attr );
+
+	return( pBuffer );
+}
+
+
+//**************************************************************************
+//	xSemaphoreTakeRecursive
+//--------------------------------------------------------------------------
+//	Only blocking (portMAX_DELAY) and polling (0) are supported.
+//
+BaseType_t xSemaphoreTakeRecursive( SemaphoreHandle_t semaphore, TickType_t ticksToWait )
+{
+	if( 0 == ticksToWait )
+	{
+		return( (0 == pthread_mutex_trylock( &semaphore->mutex )) ? pdTRUE : pdFALSE );
+	}
+
+	return( (0 == pthread_mutex_lock( &semaphore->mutex )) ? pdTRUE : pdFALSE );
+}
+
+
+//**************************************************************************
+//	xSemaphoreGiveRecursive
+//--------------------------------------------------------------------------
+//
+BaseType_t xSemaphoreGiveRecursive( SemaphoreHandle_t semaphore )
+{
+	return( (0 == pthread_mutex_unlock( &semaphore->mutex )) ? pdTRUE : pdFALSE );
+}
+
+
+//**************************************************************************
+//	vSemaphoreDelete
+//--------------------------------------------------------------------------
+//
+void vSemaphoreDelete( SemaphoreHandle_t semaphore )
+{
+	pthread_mutex_destroy( &semaphore->mutex );
+}
+
+
+//**************************************************************************
+//	xSemaphoreCreateCountingStatic
+//--------------------------------------------------------------------------
+//
+SemaphoreHandle_t xSemaphoreCreateCountingStatic( UBaseType_t maxCount, UBaseType_t initialCount, StaticSemaphore_t *pBuffer )
+{
+	if( (NULL == pBuffer) || (0 == maxCount) || (maxCount < initialCount) )
+	{
+		return( NULL );
+	}
+
+	pthread_mutex_init( &pBuffer->mutex, NULL );
+	pthread_cond_init( &pBuffer->cond, NULL );
+
+	pBuffer->count		= initialCount;
+	pBuffer->maxCount	= maxCount;
+
+	return( pBuffer );
+}
+
+
+//**************************************************************************
+//	xSemaphoreTake
+//--------------------------------------------------------------------------
+//	Counting semaphore: wait until the count is not zero and decrement it.
+//
+BaseType_t xSemaphoreTake( SemaphoreHandle_t semaphore, TickType_t ticksToWait )
+{
+	struct timespec	deadline;
+	bool			bTimed		= _host_deadline( ticksToWait, &deadline );
+	BaseType_t		result		= pdFALSE;
+
+	pthread_mutex_lock( &semaphore->mutex );
+
+	while( 0 == semaphore->count )
+	{
+		if( !_host_wait( &semaphore->cond, &semaphore->mutex, ticksToWait, bTimed ? &deadline : NULL ) )
+		{
+			break;
+		}
+	}
+
+	if( 0 < semaphore->count )
+	{
+		semaphore->count--;
+		result = pdTRUE;
+	}
+
+	pthread_mutex_unlock( &semaphore->mutex );
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	xSemaphoreGive
+//--------------------------------------------------------------------------
+//	Counting semaphore: increment the count (up to the maximum).
+//
+BaseType_t xSemaphoreGive( SemaphoreHandle_t semaphore )
+{
+	BaseType_t	result = pdFALSE;
+
+	pthread_mutex_lock( &semaphore->mutex );
+
+	if( semaphore->maxCount > semaphore->count )
+	{
+		semaphore->count++;
+		result = pdTRUE;
+
+		pthread_cond_signal( &semaphore->cond );
+	}
+
+	pthread_mutex_unlock( &semaphore->mutex );
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	xSemaphoreGiveFromISR
+//--------------------------------------------------------------------------
+//	There are no interrupts on the host, no task switch is requested.
+//
+BaseType_t xSemaphoreGiveFromISR( SemaphoreHandle_t semaphore, BaseType_t *pHigherPriorityTaskWoken )
+{
+	if( NULL != pHigherPriorityTaskWoken )
+	{
+		*pHigherPriorityTaskWoken = pdFALSE;
+	}
+
+	return( xSemaphoreGive( semaphore ) );
+}
+
+
+//**************************************************************************
+//	xQueueCreateStatic
+//--------------------------------------------------------------------------
+//
+QueueHandle_t xQueueCreateStatic(	UBaseType_t		 length,
+									UBaseType_t		 itemSize,
+									uint8_t			*pStorage,
+									StaticQueue_t	*pQueueBuffer	)
+{
+	if( (NULL == pStorage) || (NULL == pQueueBuffer) || (0 == length) )
+	{
+		return( NULL );
+	}
+
+	pthread_mutex_init( &pQueueBuffer->mutex, NULL );
+	pthread_cond_init( &pQueueBuffer->notEmpty, NULL );
+	pthread_cond_init( &pQueueBuffer->notFull, NULL );
+
+	pQueueBuffer->pStorage	= pStorage;
+	pQueueBuffer->length	= length;
+	pQueueBuffer->itemSize	= itemSize;
+	pQueueBuffer->head		= 0;
+	pQueueBuffer->count		= 0;
+
+	return( pQueueBuffer );
+}
+
+
+//**************************************************************************
+//	xQueueSend
+//--------------------------------------------------------------------------
+//	Copy the item to the back of the queue, wait while the queue is full.
+//
+BaseType_t xQueueSend( QueueHandle_t queue, const void *pItem, TickType_t ticksToWait )
+{
+	struct timespec	deadline;
+	bool			bTimed		= _host_deadline( ticksToWait, &deadline );
+	BaseType_t		result		= pdFALSE;
+
+	pthread_mutex_lock( &queue->mutex );
+
+	while( queue->length <= queue->count )
+	{
+		if( !_host_wait( &queue->notFull, &queue->mutex, ticksToWait, bTimed ? &deadline : NULL ) )
+		{
+			break;
+		}
+	}
+
+	if( queue->length > queue->count )
+	{
+		UBaseType_t	tail = (queue->head + queue->count) % queue->length;
+
+		memcpy( &queue->pStorage[ tail * queue->itemSize ], pItem, queue->itemSize );
+		queue->count++;
+		result = pdTRUE;
+
+		pthread_cond_signal( &queue->notEmpty );
+	}
+
+	pthread_mutex_unlock( &queue->mutex );
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	xQueueReceive
+//--------------------------------------------------------------------------
+//	Copy the item from the front of the queue, wait while it is empty.
+//
+BaseType_t xQueueReceive( QueueHandle_t queue, void *pItem, TickType_t ticksToWait )
+{
+	struct timespec	deadline;
+	bool			bTimed		= _host_deadline( ticksToWait, &deadline );
+	BaseType_t		result		= pdFALSE;
+
+	pthread_mutex_lock( &queue->mutex );
+
+	while( 0 == queue->count )
+	{
+		if( !_host_wait( &queue->notEmpty, &queue->mutex, ticksToWait, bTimed ? &deadline : NULL ) )
+		{
+			break;
+		}
+	}
+
+	if( 0 < queue->count )
+	{
+		memcpy( pItem, &queue->pStorage[ queue->head * queue->itemSize ], queue->itemSize );
+		queue->head = (queue->head + 1) % queue->length;
+		queue->count--;
+		result = pdTRUE;
+
+		pthread_cond_signal( &queue->notFull );
+	}
+
+	pthread_mutex_unlock( &queue->mutex );
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	uxQueueMessagesWaiting
+//--------------------------------------------------------------------------
+//
+UBaseType_t uxQueueMessagesWaiting( QueueHandle_t queue )
+{
+	UBaseType_t	count;
+
+	pthread_mutex_lock( &queue->mutex );
+	count = queue->count;
+	pthread_mutex_unlock( &queue->mutex );
+
+	return( count );
+}
+
+
+//**************************************************************************
+//	xTaskCreateStatic
+//--------------------------------------------------------------------------
+//	The task runs in its own thread, stack size and priority are
+//	ignored on the host.
+//
+TaskHandle_t xTaskCreateStatic(	TaskFunction_t	 pFunction,
+								const char		*strName,
+								uint32_t		 stackDepth,
+								void			*pParameter,
+								UBaseType_t		 priority,
+								StackType_t		*pStack,
+								StaticTask_t	*pTaskBuffer	)
+{
+	int		result;
+
+	(void)strName;
+	(void)stackDepth;
+	(void)priority;
+	(void)pStack;
+
+	if( NULL == pTaskBuffer )
+	{
+		return( NULL );
+	}
+
+	_host_init_task( pTaskBuffer );
+
+	pTaskBuffer->pFunction	= pFunction;
+	pTaskBuffer->pParameter	= pParameter;
+
+	result = pthread_create( &pTaskBuffer->thread, NULL, _host_task_entry, pTaskBuffer );
+
+	return( (0 == result) ? pTaskBuffer : NULL );
+}
+
+
+//**************************************************************************
+//	vTaskDelete
+//--------------------------------------------------------------------------
+//	Another task is cancelled at the next point where it waits.
+//	Like on the target its buffers can be used again after the call.
+//
+void vTaskDelete( TaskHandle_t task )
+{
+	if( (NULL == task) || (xTaskGetCurrentTaskHandle() == task) )
+	{
+		pthread_detach( pthread_self() );
+		pthread_exit( NULL );
+	}
+
+	pthread_cancel( task->thread );
+	pthread_join( task->thread, NULL );
+}
+
+
+//**************************************************************************
+//	vTaskDelay
+//--------------------------------------------------------------------------
+//
+void vTaskDelay( TickType_t ticks )
+{
+	struct timespec	delay;
+
+	delay.tv_sec	= (ticks * portTICK_PERIOD_MS) / 1000;
+	delay.tv_nsec	= ((ticks * portTICK_PERIOD_MS) % 1000) * 1000000L;
+
+	nanosleep( &delay, NULL );
+}
+
+
+//**************************************************************************
+//	xTaskGetCurrentTaskHandle
+//--------------------------------------------------------------------------
+//
+TaskHandle_t xTaskGetCurrentTaskHandle( void )
+{
+	if( NULL == g_pHostCurrentTask )
+	{
+		_host_init_task( &g_HostForeignTask );
+
+		g_HostForeignTask.thread	= pthread_self();
+		g_pHostCurrentTask			= &g_HostForeignTask;
+	}
+
+	return( g_pHostCurrentTask );
+}
+
+
+//**************************************************************************
+//	xTaskGetTickCount
+//--------------------------------------------------------------------------
+//	Milliseconds of the monotonic clock (one tick is one millisecond).
+//
+TickType_t xTaskGetTickCount( void )
+{
+	return( (TickType_t)(esp_timer_get_time() / (1000 * portTICK_PERIOD_MS)) );
+}
+
+
+//**************************************************************************
+//	vTaskSetTimeOutState
+//--------------------------------------------------------------------------
+//
+void vTaskSetTimeOutState( TimeOut_t *pTimeOut )
+{
+	pTimeOut->timeOnEntering = xTaskGetTickCount();
+}
+
+
+//**************************************************************************
+//	xTaskCheckForTimeOut
+//--------------------------------------------------------------------------
+//	Like on the target: returns pdTRUE if the time ran out, otherwise
+//	the remaining ticks are stored and the time out starts again now.
+//
+BaseType_t xTaskCheckForTimeOut( TimeOut_t *pTimeOut, TickType_t *pTicksToWait )
+{
+	TickType_t	now		= xTaskGetTickCount();
+	TickType_t	elapsed	= now - pTimeOut->timeOnEntering;
+
+	if( portMAX_DELAY == *pTicksToWait )
+	{
+		return( pdFALSE );
+	}
+
+	if( elapsed >= *pTicksToWait )
+	{
+		*pTicksToWait = 0;
+
+		return( pdTRUE );
+	}
+
+	*pTicksToWait				-= elapsed;
+	pTimeOut->timeOnEntering	 = now;
+
+	return( pdFALSE );
+}
+
+
+//**************************************************************************
+//	xTaskNotifyGiveIndexed
+//--------------------------------------------------------------------------
+//
+BaseType_t xTaskNotifyGiveIndexed( TaskHandle_t task, UBaseType_t indexToNotify )
+{
+	pthread_mutex_lock( &task->mutex );
+	task->notifyValue[ indexToNotify ]++;
+	pthread_cond_signal( &task->cond );
+	pthread_mutex_unlock( &task->mutex );
+
+	return( pdPASS );
+}
+
+
+//**************************************************************************
+//	ulTaskNotifyTakeIndexed
+//--------------------------------------------------------------------------
+//	Returns the notification value before it was cleared or decremented,
+//	0 if the time ran out.
+//
+uint32_t ulTaskNotifyTakeIndexed( UBaseType_t indexToWaitOn, BaseType_t clearCountOnExit, TickType_t ticksToWait )
+{
+	StaticTask_t	*pTask		= xTaskGetCurrentTaskHandle();
+	uint32_t		*pValue		= &pTask->notifyValue[ indexToWaitOn ];
+	struct timespec	 deadline;
+	bool			 bTimed		= _host_deadline( ticksToWait, &deadline );
+	uint32_t		 value;
+
+	pthread_mutex_lock( &pTask->mutex );
+
+	while( 0 == *pValue )
+	{
+		if( !_host_wait( &pTask->cond, &pTask->mutex, ticksToWait, bTimed ? &deadline : NULL ) )
+		{
+			break;
+		}
+	}
+
+	value = *pValue;
+
+	if( 0 < value )
+	{
+		*pValue = clearCountOnExit ? 0 : (value - 1);
+	}
+
+	pthread_mutex_unlock( &pTask->mutex );
+
+	return( value );
+}
+
+
+//**************************************************************************
+//	esp_timer_get_time
+//--------------------------------------------------------------------------
+//	Time of the monotonic clock in µs.
+//
+int64_t esp_timer_get_time( void )
+{
+	struct timespec	now;
+
+	clock_gettime( CLOCK_MONOTONIC, &now );
+
+	return( (int64_t)now.tv_sec * 1000000LL + now.tv_nsec / 1000 );
+}
+
+
+//**************************************************************************
+//	_host_init_task (local)
+//--------------------------------------------------------------------------
+//
+void _host_init_task( StaticTask_t *pTask )
+{
+	memset( pTask, 0, sizeof( StaticTask_t ) );
+
+	pthread_mutex_init( &pTask->mutex, NULL );
+	pthread_cond_init( &pTask->cond, NULL );
+}
+
+
+//**************************************************************************
+//	_host_task_entry (local)
+//--------------------------------------------------------------------------
+//
+void *_host_task_entry( void *pArg )
+{
+	StaticTask_t	*pTask = (StaticTask_t *)pArg;
+
+	g_pHostCurrentTask = pTask;
+
+	pTask->pFunction( pTask->pParameter );
+
+	return( NULL );
+}
+
+
+//**************************************************************************
+//	_host_deadline (local)
+//--------------------------------------------------------------------------
+//	Calculate the point in time when waiting ends.
+//	Returns 'false' if there is no limit (portMAX_DELAY).
+//
+bool _host_deadline( TickType_t ticksToWait, struct timespec *pDeadline )
+{
+	if( portMAX_DELAY == ticksToWait )
+	{
+		return( false );
+	}
+
+	clock_gettime( CLOCK_REALTIME, pDeadline );
+
+	pDeadline->tv_sec	+= (ticksToWait * portTICK_PERIOD_MS) / 1000;
+	pDeadline->tv_nsec	+= ((ticksToWait * portTICK_PERIOD_MS) % 1000) * 1000000L;
+
+	if( 1000000000L <= pDeadline->tv_nsec )
+	{
+		pDeadline->tv_sec++;
+		pDeadline->tv_nsec -= 1000000000L;
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	_host_wait (local)
+//--------------------------------------------------------------------------
+//	Wait for the condition. Returns 'false' if the time ran out.
+//	If the waiting task is deleted the mutex is released.
+//
+bool _host_wait( pthread_cond_t *pCond, pthread_mutex_t *pMutex, TickType_t ticksToWait, const struct timespec *pDeadline )
+{
+	int	result = 0;
+
+	if( 0 == ticksToWait )
+	{
+		return( false );
+	}
+
+	pthread_cleanup_push( _host_unlock, pMutex );
+
+	if( NULL == pDeadline )
+	{
+		pthread_cond_wait( pCond, pMutex );
+	}
+	else
+	{
+		result = pthread_cond_timedwait( pCond, pMutex, pDeadline );
+	}
+
+	pthread_cleanup_pop( 0 );
+
+	return( ETIMEDOUT != result );
+}
+
+
+//**************************************************************************
+//	_host_unlock (local)
+//--------------------------------------------------------------------------
+//	cleanup handler of _host_wait()
+//
+void _host_unlock( void *pMutex )
+{
+	pthread_mutex_unlock( (pthread_mutex_t *)pMutex );
+}
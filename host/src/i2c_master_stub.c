@@ -0,0 +1,462 @@
+//##########################################################################
+//#
+//#		i2c_master_stub.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Host stand-in for the ESP-IDF I²C bus / device driver.
+//#	Like on the target a bus with a transaction queue (trans_queue_depth)
+//#	sends in the background: i2c_master_transmit() only queues the
+//#	buffer and a worker thread sends it to the emulated bus later, so a
+//#	caller that uses the buffer of a queued transaction again would send
+//#	wrong bytes. The worker takes as long as the transfer on the wire at
+//#	the clock of the device, so the overlap of rendering and sending can
+//#	be measured. When a transaction is done the callback of the device
+//#	is called from the worker thread (interrupt on the target).
+//#	Without a queue every transaction is send at once.
+//#	A test can let one queued transmit fail (host_i2c_master_fail_transmit).
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <driver/i2c.h>
+#include <driver/i2c_master.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define HOST_I2C_MASTER_BUSES			I2C_NUM_MAX
+#define HOST_I2C_MASTER_DEVICES			4
+#define HOST_I2C_MASTER_MAX_QUEUE		32
+
+//----	clocks on the wire  --------------------------------------------
+#define WIRE_CLOCKS_PER_BYTE			9		//	8 data bits + ACK
+#define WIRE_CLOCKS_PER_TRANSACTION		2		//	START + STOP
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	one queued transaction
+//
+typedef struct host_i2c_job
+{
+	i2c_master_dev_handle_t	 device;
+	const uint8_t			*pBuffer;
+	size_t					 length;
+
+} host_i2c_job_t;
+
+
+struct i2c_master_dev_t
+{
+	bool						 used;
+	i2c_master_bus_handle_t		 bus;
+	i2c_device_config_t			 config;
+	i2c_master_callback_t		 pOnDone;
+	void						*pArg;
+};
+
+
+struct i2c_master_bus_t
+{
+	bool						used;
+	bool						stop;
+	i2c_master_bus_config_t		config;
+	struct i2c_master_dev_t		arDevice[ HOST_I2C_MASTER_DEVICES ];
+
+	pthread_t					worker;
+	pthread_mutex_t				mutex;
+	pthread_cond_t				cond;
+
+	//----	queue, the transaction on the wire is the first one  -------
+	host_i2c_job_t				arJob[ HOST_I2C_MASTER_MAX_QUEUE ];
+	uint8_t						first;
+	uint8_t						count;
+};
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+extern oled_emu_bus_t		*g_pHostI2cBus[ I2C_NUM_MAX ];
+
+struct i2c_master_bus_t		 g_arHostI2cMasterBus[ HOST_I2C_MASTER_BUSES ];
+uint32_t					 g_ulHostI2cMasterMaxQueued	= 0;
+uint32_t					 g_ulHostI2cMasterFailIn	= 0;	//	0: no transmit fails
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+esp_err_t _host_i2c_master_send( i2c_master_dev_handle_t device, const uint8_t *pBuffer, size_t length );
+void *_host_i2c_master_worker( void *pArg );
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	host_i2c_master_max_queued
+//--------------------------------------------------------------------------
+//	The most transactions that were queued to a bus at the same time.
+//
+uint32_t host_i2c_master_max_queued( void )
+{
+	return( g_ulHostI2cMasterMaxQueued );
+}
+
+
+//**************************************************************************
+//	host_i2c_master_fail_transmit
+//--------------------------------------------------------------------------
+//	The given queued transmit from now on (1: the next one) is not
+//	queued and returns ESP_FAIL, like the driver does if its queue can
+//	not take the transaction.
+//
+void host_i2c_master_fail_transmit( uint32_t transmit )
+{
+	g_ulHostI2cMasterFailIn = transmit;
+}
+
+
+//**************************************************************************
+//	i2c_new_master_bus
+//--------------------------------------------------------------------------
+//
+esp_err_t i2c_new_master_bus( const i2c_master_bus_config_t *pConfig, i2c_master_bus_handle_t *pBus )
+{
+	struct i2c_master_bus_t	*pNew;
+
+	if(		(0 > pConfig->i2c_port) || (HOST_I2C_MASTER_BUSES <= pConfig->i2c_port)
+		||	(HOST_I2C_MASTER_MAX_QUEUE < pConfig->trans_queue_depth) )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	pNew = &g_arHostI2cMasterBus[ pConfig->i2c_port ];
+
+	if( pNew->used )
+	{
+		return( ESP_ERR_INVALID_STATE );
+	}
+
+	memset( pNew, 0, sizeof( struct i2c_master_bus_t ) );
+
+	pNew->used		= true;
+	pNew->config	= *pConfig;
+
+	pthread_mutex_init( &pNew->mutex, NULL );
+	pthread_cond_init( &pNew->cond, NULL );
+
+	if( 0 < pConfig->trans_queue_depth )
+	{
+		pthread_create( &pNew->worker, NULL, _host_i2c_master_worker, pNew );
+	}
+
+	*pBus = pNew;
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	i2c_del_master_bus
+//--------------------------------------------------------------------------
+//	The queued transactions are send before the bus is removed.
+//
+esp_err_t i2c_del_master_bus( i2c_master_bus_handle_t bus )
+{
+	if( 0 < bus->config.trans_queue_depth )
+	{
+		i2c_master_bus_wait_all_done( bus, -1 );
+
+		pthread_mutex_lock( &bus->mutex );
+		bus->stop = true;
+		pthread_cond_broadcast( &bus->cond );
+		pthread_mutex_unlock( &bus->mutex );
+
+		pthread_join( bus->worker, NULL );
+	}
+
+	pthread_cond_destroy( &bus->cond );
+	pthread_mutex_destroy( &bus->mutex );
+
+	bus->used = false;
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	i2c_master_bus_add_device
+//--------------------------------------------------------------------------
+//
+esp_err_t i2c_master_bus_add_device( i2c_master_bus_handle_t bus, const i2c_device_config_t *pConfig, i2c_master_dev_handle_t *pDevice )
+{
+	if( 0 == pConfig->scl_speed_hz )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	for( uint8_t idx = 0 ; HOST_I2C_MASTER_DEVICES > idx ; idx++ )
+	{
+		if( !bus->arDevice[ idx ].used )
+		{
+			memset( &bus->arDevice[ idx ], 0, sizeof( struct i2c_master_dev_t ) );
+
+			bus->arDevice[ idx ].used	= true;
+			bus->arDevice[ idx ].bus	= bus;
+			bus->arDevice[ idx ].config	= *pConfig;
+
+			*pDevice = &bus->arDevice[ idx ];
+
+			return( ESP_OK );
+		}
+	}
+
+	return( ESP_ERR_NO_MEM );
+}
+
+
+//**************************************************************************
+//	i2c_master_bus_rm_device
+//--------------------------------------------------------------------------
+//
+esp_err_t i2c_master_bus_rm_device( i2c_master_dev_handle_t device )
+{
+	i2c_master_bus_wait_all_done( device->bus, -1 );
+
+	device->used = false;
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	i2c_master_bus_wait_all_done
+//--------------------------------------------------------------------------
+//	Only waiting without a limit is supported.
+//
+esp_err_t i2c_master_bus_wait_all_done( i2c_master_bus_handle_t bus, int timeoutMs )
+{
+	(void)timeoutMs;
+
+	pthread_mutex_lock( &bus->mutex );
+
+	while( 0 < bus->count )
+	{
+		pthread_cond_wait( &bus->cond, &bus->mutex );
+	}
+
+	pthread_mutex_unlock( &bus->mutex );
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	i2c_master_register_event_callbacks
+//--------------------------------------------------------------------------
+//	Like on the target the callbacks are only available on a bus with a
+//	transaction queue.
+//
+esp_err_t i2c_master_register_event_callbacks( i2c_master_dev_handle_t device, const i2c_master_event_callbacks_t *pCallbacks, void *pArg )
+{
+	if( 0 == device->bus->config.trans_queue_depth )
+	{
+		return( ESP_ERR_INVALID_STATE );
+	}
+
+	device->pOnDone	= pCallbacks->on_trans_done;
+	device->pArg	= pArg;
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	i2c_master_probe
+//--------------------------------------------------------------------------
+//	Address byte only, after all queued transactions.
+//
+esp_err_t i2c_master_probe( i2c_master_bus_handle_t bus, uint16_t address, int timeoutMs )
+{
+	oled_emu_bus_t	*pEmuBus = g_pHostI2cBus[ bus->config.i2c_port ];
+
+	i2c_master_bus_wait_all_done( bus, timeoutMs );
+
+	if( NULL == pEmuBus )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	return( (ESP_OK == oled_emu_bus_write( pEmuBus, address, NULL, 0 )) ? ESP_OK : ESP_ERR_NOT_FOUND );
+}
+
+
+//**************************************************************************
+//	i2c_master_transmit
+//--------------------------------------------------------------------------
+//	With a transaction queue the buffer is only queued (the caller must
+//	keep it until the callback), the call waits while the queue is full.
+//
+esp_err_t i2c_master_transmit( i2c_master_dev_handle_t device, const uint8_t *pBuffer, size_t length, int timeoutMs )
+{
+	i2c_master_bus_handle_t	bus = device->bus;
+
+	(void)timeoutMs;
+
+	if( 0 == bus->config.trans_queue_depth )
+	{
+		return( _host_i2c_master_send( device, pBuffer, length ) );
+	}
+
+	pthread_mutex_lock( &bus->mutex );
+
+	if( (0 < g_ulHostI2cMasterFailIn) && (0 == --g_ulHostI2cMasterFailIn) )
+	{
+		pthread_mutex_unlock( &bus->mutex );
+
+		return( ESP_FAIL );
+	}
+
+	while( bus->config.trans_queue_depth <= bus->count )
+	{
+		pthread_cond_wait( &bus->cond, &bus->mutex );
+	}
+
+	host_i2c_job_t	*pJob = &bus->arJob[ (bus->first + bus->count) % HOST_I2C_MASTER_MAX_QUEUE ];
+
+	pJob->device	= device;
+	pJob->pBuffer	= pBuffer;
+	pJob->length	= length;
+
+	bus->count++;
+
+	if( g_ulHostI2cMasterMaxQueued < bus->count )
+	{
+		g_ulHostI2cMasterMaxQueued = bus->count;
+	}
+
+	pthread_cond_broadcast( &bus->cond );
+	pthread_mutex_unlock( &bus->mutex );
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	_host_i2c_master_send (local)
+//--------------------------------------------------------------------------
+//	One transaction on the emulated bus, it takes as long as on the wire.
+//	The buffer is read at the end, as the last byte leaves it only then:
+//	a buffer that is used again while it is on the wire sends wrong
+//	bytes.
+//
+esp_err_t _host_i2c_master_send( i2c_master_dev_handle_t device, const uint8_t *pBuffer, size_t length )
+{
+	oled_emu_bus_t	*pEmuBus = g_pHostI2cBus[ device->bus->config.i2c_port ];
+	struct timespec	 wireTime;
+	uint64_t		 ullClocks;
+	uint64_t		 ullNs;
+
+	if( NULL == pEmuBus )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	ullClocks	= (uint64_t)(length + 1) * WIRE_CLOCKS_PER_BYTE + WIRE_CLOCKS_PER_TRANSACTION;
+	ullNs		= ullClocks * 1000000000ULL / device->config.scl_speed_hz;
+
+	wireTime.tv_sec		= ullNs / 1000000000ULL;
+	wireTime.tv_nsec	= ullNs % 1000000000ULL;
+
+	nanosleep( &wireTime, NULL );
+
+	return( oled_emu_bus_write( pEmuBus, (uint8_t)device->config.device_address, pBuffer, length ) );
+}
+
+
+//**************************************************************************
+//	_host_i2c_master_worker (local)
+//--------------------------------------------------------------------------
+//	Send the queued transactions one after the other.
+//
+void *_host_i2c_master_worker( void *pArg )
+{
+	struct i2c_master_bus_t	*bus = (struct i2c_master_bus_t *)pArg;
+	host_i2c_job_t			 job;
+	i2c_master_event_data_t	 eventData;
+
+	pthread_mutex_lock( &bus->mutex );
+
+	while( !bus->stop )
+	{
+		if( 0 == bus->count )
+		{
+			pthread_cond_wait( &bus->cond, &bus->mutex );
+
+			continue;
+		}
+
+		job = bus->arJob[ bus->first ];
+
+		pthread_mutex_unlock( &bus->mutex );
+
+		eventData.event = (ESP_OK == _host_i2c_master_send( job.device, job.pBuffer, job.length )) ? I2C_EVENT_DONE : I2C_EVENT_NACK;
+
+		if( NULL != job.device->pOnDone )
+		{
+			job.device->pOnDone( job.device, &eventData, job.device->pArg );
+		}
+
+		pthread_mutex_lock( &bus->mutex );
+
+		bus->first = (bus->first + 1) % HOST_I2C_MASTER_MAX_QUEUE;
+		bus->count--;
+
+		pthread_cond_broadcast( &bus->cond );
+	}
+
+	pthread_mutex_unlock( &bus->mutex );
+
+	return( NULL );
+}
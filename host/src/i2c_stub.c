@@ -0,0 +1,363 @@
+//##########################################################################
+//#
+//#		i2c_stub.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Host stand-in for the ESP-IDF legacy I²C driver.
+//#	Command links are recorded and replayed on the emulated bus that is
+//#	attached to the port, so the legacy I²C transport of the library
+//#	runs unchanged on a Linux host.
+//#	Like the real driver, i2c_master_write() only stores the pointer to
+//#	the data and a static command link lives in the given buffer.
+//#	Every heap allocation of the stand-in is counted, so it can be
+//#	checked that a code path runs without heap.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdlib.h>
+#include <string.h>
+#include <driver/i2c.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define CMD_LINK_CAPACITY_STEP		64
+
+//----	marker for START / STOP in the recorded command link  ----------
+#define CMD_ITEM_BYTE				0
+#define CMD_ITEM_START				1
+#define CMD_ITEM_STOP				2
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef struct host_cmd_item
+{
+	const uint8_t	*pData;
+	uint16_t		 length;
+	uint8_t			 type;
+	uint8_t			 data;
+
+} host_cmd_item_t;
+
+
+typedef struct host_cmd_link
+{
+	host_cmd_item_t	*pItems;
+	uint16_t		 count;
+	uint16_t		 capacity;
+	bool			 isStatic;
+
+} host_cmd_link_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+oled_emu_bus_t	*g_pHostI2cBus[ I2C_NUM_MAX ] = { NULL };
+uint32_t		 g_ulHostI2cAllocations		= 0;
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+esp_err_t _host_cmd_add( i2c_cmd_handle_t cmd, uint8_t type, uint8_t data, const uint8_t *pData, size_t length );
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	host_i2c_attach_bus
+//--------------------------------------------------------------------------
+//	All transfers on the given port will go to the emulated bus.
+//
+void host_i2c_attach_bus( i2c_port_t port, struct oled_emu_bus *pBus )
+{
+	if( (0 <= port) && (I2C_NUM_MAX > port) )
+	{
+		g_pHostI2cBus[ port ] = pBus;
+	}
+}
+
+
+//**************************************************************************
+//	host_i2c_allocations
+//--------------------------------------------------------------------------
+//	Number of heap allocations done by the stand-in since program start.
+//
+uint32_t host_i2c_allocations( void )
+{
+	return( g_ulHostI2cAllocations );
+}
+
+
+//**************************************************************************
+//	i2c_master_write_to_device
+//--------------------------------------------------------------------------
+//	The real driver builds a static command link on the stack,
+//	so there is no heap allocation here either.
+//
+esp_err_t i2c_master_write_to_device(	i2c_port_t		 port,
+										uint8_t			 address,
+										const uint8_t	*pBuffer,
+										size_t			 length,
+										TickType_t		 ticksToWait	)
+{
+	(void)ticksToWait;
+
+	if( (0 > port) || (I2C_NUM_MAX <= port) || (NULL == g_pHostI2cBus[ port ]) )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	return( oled_emu_bus_write( g_pHostI2cBus[ port ], address, pBuffer, length ) );
+}
+
+
+//**************************************************************************
+//	i2c_cmd_link_create
+//--------------------------------------------------------------------------
+//
+i2c_cmd_handle_t i2c_cmd_link_create( void )
+{
+	g_ulHostI2cAllocations++;
+
+	return( calloc( 1, sizeof( host_cmd_link_t ) ) );
+}
+
+
+//**************************************************************************
+//	i2c_cmd_link_create_static
+//--------------------------------------------------------------------------
+//	The link header and the items are placed in the given buffer.
+//
+i2c_cmd_handle_t i2c_cmd_link_create_static( uint8_t *pBuffer, uint32_t size )
+{
+	host_cmd_link_t	*pLink = (host_cmd_link_t *)pBuffer;
+
+	if( (NULL == pBuffer) || (sizeof( host_cmd_link_t ) > size) )
+	{
+		return( NULL );
+	}
+
+	pLink->pItems	= (host_cmd_item_t *)(pBuffer + sizeof( host_cmd_link_t ));
+	pLink->count	= 0;
+	pLink->capacity	= (size - sizeof( host_cmd_link_t )) / sizeof( host_cmd_item_t );
+	pLink->isStatic	= true;
+
+	return( pLink );
+}
+
+
+//**************************************************************************
+//	i2c_cmd_link_delete
+//--------------------------------------------------------------------------
+//
+void i2c_cmd_link_delete( i2c_cmd_handle_t cmd )
+{
+	host_cmd_link_t	*pLink = (host_cmd_link_t *)cmd;
+
+	if( (NULL != pLink) && !pLink->isStatic )
+	{
+		free( pLink->pItems );
+		free( pLink );
+	}
+}
+
+
+//**************************************************************************
+//	i2c_cmd_link_delete_static
+//--------------------------------------------------------------------------
+//
+void i2c_cmd_link_delete_static( i2c_cmd_handle_t cmd )
+{
+	(void)cmd;
+}
+
+
+//**************************************************************************
+//	i2c_master_start
+//--------------------------------------------------------------------------
+//
+esp_err_t i2c_master_start( i2c_cmd_handle_t cmd )
+{
+	return( _host_cmd_add( cmd, CMD_ITEM_START, 0, NULL, 0 ) );
+}
+
+
+//**************************************************************************
+//	i2c_master_write_byte
+//--------------------------------------------------------------------------
+//
+esp_err_t i2c_master_write_byte( i2c_cmd_handle_t cmd, uint8_t data, bool ackEnable )
+{
+	(void)ackEnable;
+
+	return( _host_cmd_add( cmd, CMD_ITEM_BYTE, data, NULL, 0 ) );
+}
+
+
+//**************************************************************************
+//	i2c_master_write
+//--------------------------------------------------------------------------
+//
+esp_err_t i2c_master_write( i2c_cmd_handle_t cmd, const uint8_t *pData, size_t length, bool ackEnable )
+{
+	(void)ackEnable;
+
+	return( _host_cmd_add( cmd, CMD_ITEM_BYTE, 0, pData, length ) );
+}
+
+
+//**************************************************************************
+//	i2c_master_stop
+//--------------------------------------------------------------------------
+//
+esp_err_t i2c_master_stop( i2c_cmd_handle_t cmd )
+{
+	return( _host_cmd_add( cmd, CMD_ITEM_STOP, 0, NULL, 0 ) );
+}
+
+
+//**************************************************************************
+//	i2c_master_cmd_begin
+//--------------------------------------------------------------------------
+//	Replay the recorded command link on the emulated bus.
+//	The first byte after a START is the address byte.
+//	Like the real driver the complete link is send under the bus lock.
+//
+esp_err_t i2c_master_cmd_begin( i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t ticksToWait )
+{
+	host_cmd_link_t	*pLink		= (host_cmd_link_t *)cmd;
+	oled_emu_bus_t	*pBus;
+	bool			 bAddress	= false;
+	bool			 bAck		= true;
+
+	(void)ticksToWait;
+
+	if( (0 > port) || (I2C_NUM_MAX <= port) || (NULL == g_pHostI2cBus[ port ]) || (NULL == pLink) )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	pBus = g_pHostI2cBus[ port ];
+
+	oled_emu_bus_lock( pBus );
+
+	for( size_t idx = 0 ; pLink->count > idx ; idx++ )
+	{
+		host_cmd_item_t	*pItem = &pLink->pItems[ idx ];
+
+		if( CMD_ITEM_START == pItem->type )
+		{
+			bAddress = true;
+		}
+		else if( CMD_ITEM_STOP == pItem->type )
+		{
+			oled_emu_bus_stop( pBus );
+		}
+		else if( NULL != pItem->pData )
+		{
+			for( uint16_t usIdx = 0 ; pItem->length > usIdx ; usIdx++ )
+			{
+				oled_emu_bus_byte( pBus, pItem->pData[ usIdx ] );
+			}
+		}
+		else if( bAddress )
+		{
+			bAddress	= false;
+			bAck		= oled_emu_bus_start( pBus, pItem->data >> 1 ) && bAck;
+		}
+		else
+		{
+			oled_emu_bus_byte( pBus, pItem->data );
+		}
+	}
+
+	oled_emu_bus_unlock( pBus );
+
+	return( bAck ? ESP_OK : ESP_FAIL );
+}
+
+
+//**************************************************************************
+//	_host_cmd_add (local)
+//--------------------------------------------------------------------------
+//	Append one item to the command link.
+//	Like the real driver only the pointer to a data buffer is stored.
+//
+esp_err_t _host_cmd_add( i2c_cmd_handle_t cmd, uint8_t type, uint8_t data, const uint8_t *pData, size_t length )
+{
+	host_cmd_link_t	*pLink = (host_cmd_link_t *)cmd;
+
+	if( NULL == pLink )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	if( pLink->capacity <= pLink->count )
+	{
+		if( pLink->isStatic )
+		{
+			return( ESP_ERR_NO_MEM );
+		}
+
+		g_ulHostI2cAllocations++;
+
+		size_t			 newCapacity	= pLink->capacity + CMD_LINK_CAPACITY_STEP;
+		host_cmd_item_t	*pItems			= realloc( pLink->pItems, newCapacity * sizeof( host_cmd_item_t ) );
+
+		if( NULL == pItems )
+		{
+			return( ESP_FAIL );
+		}
+
+		pLink->pItems	= pItems;
+		pLink->capacity	= newCapacity;
+	}
+
+	pLink->pItems[ pLink->count ].type		= type;
+	pLink->pItems[ pLink->count ].data		= data;
+	pLink->pItems[ pLink->count ].pData		= pData;
+	pLink->pItems[ pLink->count ].length	= (uint16_t)length;
+	pLink->count++;
+
+	return( ESP_OK );
+}
@@ -0,0 +1,981 @@
+//##########################################################################
+//#
+//#		oled_emulator.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Host side emulator of the sh1106 and ssd1306 display controllers.
+//#	The emulator decodes the I²C byte stream (prefix bytes, commands and
+//#	display data) or the SPI transfers (D/C pin instead of the prefix
+//#	bytes) like the real controller does and keeps the display
+//#	RAM, so the resulting pixels on the panel can be checked.
+//#	Every emulated bus counts the transactions and bytes send over it.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <string.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//----	prefix bits  ---------------------------------------------------
+#define	PREFIX_BIT_CONTINUATION			0x80
+#define PREFIX_BIT_DATA					0x40
+
+//----	command codes (both chips)  ------------------------------------
+#define OPC_SET_CONTRAST				0x81
+#define OPC_CHARGE_PUMP_SETTING			0x8D
+#define OPC_SEG_ROTATION_RIGHT			0xA0
+#define OPC_SEG_ROTATION_LEFT			0xA1
+#define	OPC_ENTIRE_DISPLAY_NORMAL		0xA4
+#define	OPC_ENTIRE_DISPLAY_ON			0xA5
+#define OPC_MODE_NORMAL					0xA6
+#define OPC_MODE_INVERSE				0xA7
+#define OPC_SET_MULTIPLEX_RATIO			0xA8
+#define OPC_DC_DC_CONTROL_MODE			0xAD
+#define OPC_DISPLAY_OFF					0xAE
+#define OPC_DISPLAY_ON					0xAF
+#define OPC_OUTPUT_SCAN_NORMAL			0xC0
+#define OPC_OUTPUT_SCAN_INVERSE			0xC8
+#define OPC_DISPLAY_LINE_OFFSET			0xD3
+#define OPC_CLK_DIV_OSC_FREQ			0xD5
+#define OPC_DIS_PRE_CHARGE_PERIOD		0xD9
+#define OPC_SET_COM_PINS				0xDA
+#define OPC_SET_VCOM_DESELECT_LEVEL		0xDB
+
+//----	sh1107 only  ---------------------------------------------------
+#define OPC_DISPLAY_START_LINE_SH1107	0xDC
+
+//----	ssd1306 only  --------------------------------------------------
+#define OPC_MEMORY_ADR_MODE				0x20
+#define OPC_COLUMN_RANGE				0x21
+#define OPC_PAGE_RANGE					0x22
+#define OPC_RIGHT_SCROLL				0x26
+#define OPC_LEFT_SCROLL					0x27
+#define OPC_VERTICAL_RIGHT_SCROLL		0x29
+#define OPC_VERTICAL_LEFT_SCROLL		0x2A
+#define OPC_DEACTIVATE_SCROLL			0x2E
+#define OPC_ACTIVATE_SCROLL				0x2F
+#define OPC_VERTICAL_SCROLL_AREA		0xA3
+
+#define ADR_MODE_HORIZONTAL				0x00
+#define ADR_MODE_VERTICAL				0x01
+#define ADR_MODE_PAGE					0x02
+
+#define RAM_ROWS( pEmu )				((pEmu)->ramPages * 8)
+
+//----	COM pins configuration  ----------------------------------------
+#define COM_PINS_ALTERNATIVE			0x10
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+void _oled_emu_byte( oled_emu_t *pEmu, uint8_t data );
+void _oled_emu_command( oled_emu_t *pEmu, uint8_t opCode );
+void _oled_emu_execute( oled_emu_t *pEmu );
+void _oled_emu_data( oled_emu_t *pEmu, uint8_t data );
+void _oled_emu_scroll_setup( oled_emu_t *pEmu, uint8_t parameters );
+void _oled_emu_scroll_step( oled_emu_t *pEmu );
+uint8_t _oled_emu_com_of_row( const oled_emu_t *pEmu, uint8_t y );
+
+esp_err_t _oled_emu_probe( void *pContext, uint8_t address );
+esp_err_t _oled_emu_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length );
+esp_err_t _oled_emu_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length );
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	frames between two scroll steps for the interval codes
+//
+const uint16_t	g_aruiScrollFrames[ 8 ] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+const oled_transport_t	g_oledEmuTransport =
+	{
+		.probe		= _oled_emu_probe,
+		.write		= _oled_emu_write,
+		.write_data	= _oled_emu_write_data
+	};
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	oled_emu_init
+//--------------------------------------------------------------------------
+//	Power on state of the controller. The RAM is filled with a pattern,
+//	because the real RAM content is undefined after power on.
+//	The panel is the default panel of the chip: 128x128 for the sh1107,
+//	128x64 for the others (see oled_emu_set_panel).
+//
+void oled_emu_init( oled_emu_t *pEmu, chip_type_t chipType, uint8_t address )
+{
+	memset( pEmu, 0, sizeof( oled_emu_t ) );
+	memset( pEmu->ram, 0x55, sizeof( pEmu->ram ) );
+
+	pEmu->chipType		= chipType;
+	pEmu->address		= address;
+	pEmu->ramPages		= (CHIP_TYPE_SH1107 == chipType) ? OLED_EMU_RAM_PAGES : 8;
+	pEmu->multiplex		= RAM_ROWS( pEmu ) - 1;
+	pEmu->comPins		= 0x12;
+	pEmu->pageEnd		= 7;
+	pEmu->adrMode		= ADR_MODE_PAGE;
+	pEmu->scrollInterval		= g_aruiScrollFrames[ 0 ];
+	pEmu->verticalScrollRows	= RAM_ROWS( pEmu );
+
+	if( CHIP_TYPE_SH1106 == chipType )
+	{
+		//------------------------------------------------------------------
+		//	the 128 pixel panel is connected to SEG2 ... SEG129
+		//
+		pEmu->ramColumns = OLED_EMU_RAM_COLUMNS;
+		oled_emu_set_panel( pEmu, OLED_EMU_PANEL_WIDTH, OLED_EMU_PANEL_HEIGHT, (OLED_EMU_RAM_COLUMNS - OLED_EMU_PANEL_WIDTH) / 2, 0x12 );
+	}
+	else
+	{
+		pEmu->ramColumns = OLED_EMU_PANEL_WIDTH;
+		oled_emu_set_panel( pEmu, OLED_EMU_PANEL_WIDTH, RAM_ROWS( pEmu ), 0, 0x12 );
+	}
+
+	pEmu->columnEnd		= pEmu->ramColumns - 1;
+	pEmu->expectControl	= true;
+}
+
+
+//**************************************************************************
+//	oled_emu_set_panel
+//--------------------------------------------------------------------------
+//	Connect another panel to the controller: width x height pixels,
+//	wired to SEG<segmentOffset> ... and to the COM outputs in the given
+//	COM pins configuration (0x02: sequential, 0x12: alternative).
+//	If the controller is set to another configuration the rows of the
+//	panel are shown in the wrong order.
+//
+void oled_emu_set_panel( oled_emu_t *pEmu, uint8_t width, uint8_t height, uint8_t segmentOffset, uint8_t comPins )
+{
+	pEmu->panelWidth			= width;
+	pEmu->panelHeight			= height;
+	pEmu->panelSegmentOffset	= segmentOffset;
+	pEmu->panelComPins			= comPins;
+}
+
+
+//**************************************************************************
+//	oled_emu_reset_stats
+//--------------------------------------------------------------------------
+//
+void oled_emu_reset_stats( oled_emu_t *pEmu )
+{
+	pEmu->transactions	= 0;
+	pEmu->controlBytes	= 0;
+	pEmu->commandBytes	= 0;
+	pEmu->dataBytes		= 0;
+}
+
+
+//**************************************************************************
+//	oled_emu_run_frames
+//--------------------------------------------------------------------------
+//	Let the given number of frames pass on the panel. An active scroll
+//	does one step every scrollInterval frames.
+//
+void oled_emu_run_frames( oled_emu_t *pEmu, uint32_t frames )
+{
+	while( pEmu->scrollActive && (0 < frames--) )
+	{
+		if( pEmu->scrollInterval <= ++pEmu->scrollFrames )
+		{
+			pEmu->scrollFrames = 0;
+
+			_oled_emu_scroll_step( pEmu );
+		}
+	}
+}
+
+
+//**************************************************************************
+//	oled_emu_pixel
+//--------------------------------------------------------------------------
+//	Returns the state of the pixel at panel position x / y
+//	(0 / 0 is the top left corner) as it would be seen by the user.
+//
+bool oled_emu_pixel( const oled_emu_t *pEmu, uint8_t x, uint8_t y )
+{
+	uint8_t	usCom;
+	uint8_t	usRow;
+	uint8_t	usSegment;
+	uint8_t	usColumn;
+	bool	bOn;
+
+
+	if( !pEmu->displayOn || (pEmu->panelWidth <= x) || (pEmu->panelHeight <= y) || (pEmu->multiplex < y) )
+	{
+		return( false );
+	}
+
+	if( pEmu->entireDisplayOn )
+	{
+		bOn = true;
+	}
+	else
+	{
+		//------------------------------------------------------------------
+		//	the scan direction decides which COM drives panel row y,
+		//	the display offset and the start line decide which RAM row
+		//	is shown on that COM
+		//
+		usCom = _oled_emu_com_of_row( pEmu, y );
+		usCom = pEmu->comScanReverse ? (pEmu->multiplex - usCom) : usCom;
+
+		if(		pEmu->scrollActive
+			&&	(pEmu->verticalFixedRows <= usCom)
+			&&	((pEmu->verticalFixedRows + pEmu->verticalScrollRows) > usCom) )
+		{
+			usCom	= pEmu->verticalFixedRows
+					+ (usCom - pEmu->verticalFixedRows + pEmu->verticalScrollLine) % pEmu->verticalScrollRows;
+		}
+
+		usRow = (usCom + pEmu->lineOffset + pEmu->startLine) % RAM_ROWS( pEmu );
+
+		//------------------------------------------------------------------
+		//	the segment remap decides which RAM column drives SEGx
+		//
+		usSegment	= x + pEmu->panelSegmentOffset;
+		usColumn	= pEmu->segmentRemap ? (pEmu->ramColumns - 1 - usSegment) : usSegment;
+
+		bOn = 0 != (pEmu->ram[ usRow >> 3 ][ usColumn ] & (1 << (usRow & 0x07)));
+	}
+
+	return( bOn != pEmu->inverse );
+}
+
+
+//**************************************************************************
+//	oled_emu_snapshot
+//--------------------------------------------------------------------------
+//	Keep all pixels of the panel, e.g. to check later that only a part
+//	of the panel has changed (see oled_emu_compare_outside).
+//
+void oled_emu_snapshot( const oled_emu_t *pEmu, oled_emu_snapshot_t *pSnapshot )
+{
+	pSnapshot->width	= pEmu->panelWidth;
+	pSnapshot->height	= pEmu->panelHeight;
+
+	for( uint8_t y = 0 ; pSnapshot->height > y ; y++ )
+	{
+		for( uint8_t x = 0 ; pSnapshot->width > x ; x++ )
+		{
+			pSnapshot->pixel[ y ][ x ] = oled_emu_pixel( pEmu, x, y );
+		}
+	}
+}
+
+
+//**************************************************************************
+//	oled_emu_compare_outside
+//--------------------------------------------------------------------------
+//	Returns 'true' if every pixel of the panel outside of the rectangle
+//	(columns x ... x + width - 1, rows y ... y + height - 1) is the same
+//	as in the snapshot. Otherwise the position of the first different
+//	pixel is stored in pX / pY (may be NULL).
+//	The rectangle may reach beyond the panel or be empty.
+//
+bool oled_emu_compare_outside(	const oled_emu_t			*pEmu,
+								const oled_emu_snapshot_t	*pSnapshot,
+								uint16_t					 x,
+								uint16_t					 y,
+								uint16_t					 width,
+								uint16_t					 height,
+								uint8_t						*pX,
+								uint8_t						*pY			)
+{
+	for( uint8_t row = 0 ; pSnapshot->height > row ; row++ )
+	{
+		for( uint8_t column = 0 ; pSnapshot->width > column ; column++ )
+		{
+			if(		(x <= column) && ((x + width) > column)
+				&&	(y <= row) && ((y + height) > row) )
+			{
+				continue;
+			}
+
+			if( oled_emu_pixel( pEmu, column, row ) != pSnapshot->pixel[ row ][ column ] )
+			{
+				if( NULL != pX )
+				{
+					*pX = column;
+				}
+
+				if( NULL != pY )
+				{
+					*pY = row;
+				}
+
+				return( false );
+			}
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	oled_emu_dump
+//--------------------------------------------------------------------------
+//	Print the panel as ASCII art ('#' = pixel on).
+//
+void oled_emu_dump( const oled_emu_t *pEmu, FILE *pFile )
+{
+	for( uint8_t y = 0 ; pEmu->panelHeight > y ; y++ )
+	{
+		for( uint8_t x = 0 ; pEmu->panelWidth > x ; x++ )
+		{
+			fputc( oled_emu_pixel( pEmu, x, y ) ? '#' : '.', pFile );
+		}
+
+		fputc( '\n', pFile );
+	}
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_init
+//--------------------------------------------------------------------------
+//
+void oled_emu_bus_init( oled_emu_bus_t *pBus )
+{
+	pthread_mutexattr_t	attr;
+
+	memset( pBus, 0, sizeof( oled_emu_bus_t ) );
+
+	pthread_mutexattr_init( &attr );
+	pthread_mutexattr_settype( &attr, PTHREAD_MUTEX_RECURSIVE );
+	pthread_mutex_init( &pBus->lock, &attr );
+	pthread_mutexattr_destroy( &attr );
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_lock
+//--------------------------------------------------------------------------
+//	Take the bus for one complete transaction (START ... STOP).
+//
+void oled_emu_bus_lock( oled_emu_bus_t *pBus )
+{
+	pthread_mutex_lock( &pBus->lock );
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_unlock
+//--------------------------------------------------------------------------
+//
+void oled_emu_bus_unlock( oled_emu_bus_t *pBus )
+{
+	pthread_mutex_unlock( &pBus->lock );
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_attach
+//--------------------------------------------------------------------------
+//	Connect the display to the bus.
+//
+void oled_emu_bus_attach( oled_emu_bus_t *pBus, oled_emu_t *pEmu )
+{
+	if( OLED_EMU_BUS_DEVICES > pBus->deviceCount )
+	{
+		pBus->pDevices[ pBus->deviceCount++ ] = pEmu;
+	}
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_reset_stats
+//--------------------------------------------------------------------------
+//
+void oled_emu_bus_reset_stats( oled_emu_bus_t *pBus )
+{
+	pBus->transactions	= 0;
+	pBus->bytes			= 0;
+	pBus->nacks			= 0;
+
+	for( uint8_t idx = 0 ; pBus->deviceCount > idx ; idx++ )
+	{
+		oled_emu_reset_stats( pBus->pDevices[ idx ] );
+	}
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_start
+//--------------------------------------------------------------------------
+//	START condition followed by the address byte.
+//	Returns 'true' if a display has acknowledged the address.
+//
+bool oled_emu_bus_start( oled_emu_bus_t *pBus, uint8_t address )
+{
+	pBus->transactions++;
+	pBus->pActive = NULL;
+
+	for( uint8_t idx = 0 ; pBus->deviceCount > idx ; idx++ )
+	{
+		if( address == pBus->pDevices[ idx ]->address )
+		{
+			pBus->pActive					= pBus->pDevices[ idx ];
+			pBus->pActive->expectControl	= true;
+			pBus->pActive->transactions++;
+		}
+	}
+
+	if( NULL == pBus->pActive )
+	{
+		pBus->nacks++;
+
+		return( false );
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_byte
+//--------------------------------------------------------------------------
+//	One byte of the actual transaction.
+//
+void oled_emu_bus_byte( oled_emu_bus_t *pBus, uint8_t data )
+{
+	if( NULL != pBus->pActive )
+	{
+		pBus->bytes++;
+
+		_oled_emu_byte( pBus->pActive, data );
+	}
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_stop
+//--------------------------------------------------------------------------
+//	STOP condition. A command with missing parameters is discarded.
+//
+void oled_emu_bus_stop( oled_emu_bus_t *pBus )
+{
+	if( NULL != pBus->pActive )
+	{
+		pBus->pActive->parametersExpected = 0;
+	}
+
+	pBus->pActive = NULL;
+}
+
+
+//**************************************************************************
+//	oled_emu_bus_write
+//--------------------------------------------------------------------------
+//	One complete transaction.
+//
+esp_err_t oled_emu_bus_write( oled_emu_bus_t *pBus, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	esp_err_t	result = ESP_FAIL;
+
+	oled_emu_bus_lock( pBus );
+
+	if( oled_emu_bus_start( pBus, address ) )
+	{
+		for( size_t idx = 0 ; length > idx ; idx++ )
+		{
+			oled_emu_bus_byte( pBus, pBuffer[ idx ] );
+		}
+
+		result = ESP_OK;
+	}
+
+	oled_emu_bus_stop( pBus );
+	oled_emu_bus_unlock( pBus );
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	oled_emu_spi_write
+//--------------------------------------------------------------------------
+//	One transfer on the SPI bus (CS low ... CS high). There are no prefix
+//	bytes, the D/C pin tells if the bytes are commands or display data.
+//	A command can get its parameters in the next transfer.
+//
+void oled_emu_spi_write( oled_emu_t *pEmu, bool isData, const uint8_t *pData, size_t length )
+{
+	pEmu->transactions++;
+
+	for( size_t idx = 0 ; length > idx ; idx++ )
+	{
+		if( isData )
+		{
+			pEmu->dataBytes++;
+
+			_oled_emu_data( pEmu, pData[ idx ] );
+		}
+		else
+		{
+			pEmu->commandBytes++;
+
+			_oled_emu_command( pEmu, pData[ idx ] );
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_emu_byte (local)
+//--------------------------------------------------------------------------
+//	Decode one byte following the address byte.
+//	A prefix (control) byte with the continuation bit set is followed by
+//	exactly one command or data byte and then by the next prefix byte.
+//	Without the continuation bit all following bytes are commands or
+//	data until the end of the transaction.
+//
+void _oled_emu_byte( oled_emu_t *pEmu, uint8_t data )
+{
+	if( pEmu->expectControl )
+	{
+		pEmu->controlBytes++;
+		pEmu->isData		= 0 != (data & PREFIX_BIT_DATA);
+		pEmu->singleByte	= 0 != (data & PREFIX_BIT_CONTINUATION);
+		pEmu->expectControl	= false;
+
+		return;
+	}
+
+	if( pEmu->isData )
+	{
+		pEmu->dataBytes++;
+
+		_oled_emu_data( pEmu, data );
+	}
+	else
+	{
+		pEmu->commandBytes++;
+
+		_oled_emu_command( pEmu, data );
+	}
+
+	pEmu->expectControl = pEmu->singleByte;
+}
+
+
+//**************************************************************************
+//	_oled_emu_command (local)
+//--------------------------------------------------------------------------
+//	Decode one command byte. Commands with parameters are collected until
+//	all parameters are received.
+//
+void _oled_emu_command( oled_emu_t *pEmu, uint8_t opCode )
+{
+	if( pEmu->parametersExpected > pEmu->parameterCount )
+	{
+		pEmu->parameters[ pEmu->parameterCount++ ] = opCode;
+
+		if( pEmu->parametersExpected == pEmu->parameterCount )
+		{
+			_oled_emu_execute( pEmu );
+
+			pEmu->parametersExpected = 0;
+		}
+
+		return;
+	}
+
+	pEmu->opCode			= opCode;
+	pEmu->parameterCount	= 0;
+
+	if( 0x10 > opCode )
+	{
+		pEmu->column = (pEmu->column & 0xF0) | (opCode & 0x0F);
+	}
+	else if( 0x20 > opCode )
+	{
+		pEmu->column = (pEmu->column & 0x0F) | ((opCode & 0x0F) << 4);
+	}
+	else if( (0x40 <= opCode) && (0x80 > opCode) && (CHIP_TYPE_SH1107 != pEmu->chipType) )
+	{
+		pEmu->startLine = opCode & 0x3F;
+	}
+	else if( (0xB0 <= opCode) && ((0xB0 + pEmu->ramPages) > opCode) )
+	{
+		pEmu->page = opCode & 0x0F;
+	}
+	else
+	{
+		switch( opCode )
+		{
+			case OPC_MEMORY_ADR_MODE:
+				pEmu->parametersExpected = (CHIP_TYPE_SSD1306 == pEmu->chipType) ? 1 : 0;
+				break;
+
+			case OPC_COLUMN_RANGE:
+			case OPC_PAGE_RANGE:
+				pEmu->parametersExpected = (CHIP_TYPE_SSD1306 == pEmu->chipType) ? 2 : 0;
+				break;
+
+			case OPC_RIGHT_SCROLL:
+			case OPC_LEFT_SCROLL:
+				_oled_emu_scroll_setup( pEmu, 6 );
+				break;
+
+			case OPC_VERTICAL_RIGHT_SCROLL:
+			case OPC_VERTICAL_LEFT_SCROLL:
+				_oled_emu_scroll_setup( pEmu, 5 );
+				break;
+
+			case OPC_VERTICAL_SCROLL_AREA:
+				_oled_emu_scroll_setup( pEmu, 2 );
+				break;
+
+			case OPC_DEACTIVATE_SCROLL:
+				pEmu->scrollActive			= false;
+				pEmu->verticalScrollLine	= 0;
+				break;
+
+			case OPC_ACTIVATE_SCROLL:
+				pEmu->scrollActive	= (CHIP_TYPE_SSD1306 == pEmu->chipType) && (0 != pEmu->scrollOpCode);
+				pEmu->scrollFrames	= 0;
+				break;
+
+			case OPC_SET_CONTRAST:
+			case OPC_CHARGE_PUMP_SETTING:
+			case OPC_SET_MULTIPLEX_RATIO:
+			case OPC_DC_DC_CONTROL_MODE:
+			case OPC_DISPLAY_LINE_OFFSET:
+			case OPC_CLK_DIV_OSC_FREQ:
+			case OPC_DIS_PRE_CHARGE_PERIOD:
+			case OPC_SET_COM_PINS:
+			case OPC_SET_VCOM_DESELECT_LEVEL:
+				pEmu->parametersExpected = 1;
+				break;
+
+			case OPC_DISPLAY_START_LINE_SH1107:
+				pEmu->parametersExpected = (CHIP_TYPE_SH1107 == pEmu->chipType) ? 1 : 0;
+				break;
+
+			case OPC_SEG_ROTATION_RIGHT:	pEmu->segmentRemap		= false;	break;
+			case OPC_SEG_ROTATION_LEFT:		pEmu->segmentRemap		= true;		break;
+			case OPC_ENTIRE_DISPLAY_NORMAL:	pEmu->entireDisplayOn	= false;	break;
+			case OPC_ENTIRE_DISPLAY_ON:		pEmu->entireDisplayOn	= true;		break;
+			case OPC_MODE_NORMAL:			pEmu->inverse			= false;	break;
+			case OPC_MODE_INVERSE:			pEmu->inverse			= true;		break;
+			case OPC_DISPLAY_OFF:			pEmu->displayOn			= false;	break;
+			case OPC_DISPLAY_ON:			pEmu->displayOn			= true;		break;
+			case OPC_OUTPUT_SCAN_NORMAL:	pEmu->comScanReverse	= false;	break;
+			case OPC_OUTPUT_SCAN_INVERSE:	pEmu->comScanReverse	= true;		break;
+
+			default:
+				break;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_emu_execute (local)
+//--------------------------------------------------------------------------
+//	Execute a command after all of its parameters are received.
+//
+void _oled_emu_execute( oled_emu_t *pEmu )
+{
+	uint8_t	usParameter = pEmu->parameters[ 0 ];
+
+	switch( pEmu->opCode )
+	{
+		case OPC_MEMORY_ADR_MODE:
+			pEmu->adrMode = usParameter & 0x03;
+			break;
+
+		case OPC_COLUMN_RANGE:
+			pEmu->columnStart	= usParameter & 0x7F;
+			pEmu->columnEnd		= pEmu->parameters[ 1 ] & 0x7F;
+			pEmu->column		= pEmu->columnStart;
+			break;
+
+		case OPC_PAGE_RANGE:
+			pEmu->pageStart		= usParameter & 0x07;
+			pEmu->pageEnd		= pEmu->parameters[ 1 ] & 0x07;
+			pEmu->page			= pEmu->pageStart;
+			break;
+
+		case OPC_SET_MULTIPLEX_RATIO:
+			pEmu->multiplex = usParameter & (RAM_ROWS( pEmu ) - 1);
+			break;
+
+		case OPC_DISPLAY_LINE_OFFSET:
+			pEmu->lineOffset = usParameter & (RAM_ROWS( pEmu ) - 1);
+			break;
+
+		case OPC_SET_COM_PINS:
+			pEmu->comPins = usParameter;
+			break;
+
+		case OPC_DISPLAY_START_LINE_SH1107:
+			pEmu->startLine = usParameter & 0x7F;
+			break;
+
+		case OPC_RIGHT_SCROLL:
+		case OPC_LEFT_SCROLL:
+		case OPC_VERTICAL_RIGHT_SCROLL:
+		case OPC_VERTICAL_LEFT_SCROLL:
+			pEmu->scrollOpCode			= pEmu->opCode;
+			pEmu->scrollStartPage		= pEmu->parameters[ 1 ] & 0x07;
+			pEmu->scrollInterval		= g_aruiScrollFrames[ pEmu->parameters[ 2 ] & 0x07 ];
+			pEmu->scrollEndPage			= pEmu->parameters[ 3 ] & 0x07;
+			pEmu->scrollVerticalOffset	= pEmu->parameters[ 4 ] & 0x3F;
+			break;
+
+		case OPC_VERTICAL_SCROLL_AREA:
+			pEmu->verticalFixedRows		= usParameter & 0x3F;
+			pEmu->verticalScrollRows	= pEmu->parameters[ 1 ] & 0x7F;
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+//**************************************************************************
+//	_oled_emu_data (local)
+//--------------------------------------------------------------------------
+//	Write one byte into the display RAM and move the RAM pointer
+//	according to the memory addressing mode.
+//
+void _oled_emu_data( oled_emu_t *pEmu, uint8_t data )
+{
+	if( (pEmu->ramPages > pEmu->page) && (pEmu->ramColumns > pEmu->column) )
+	{
+		pEmu->ram[ pEmu->page ][ pEmu->column ] = data;
+	}
+
+	if( ADR_MODE_HORIZONTAL == pEmu->adrMode )
+	{
+		if( pEmu->columnEnd <= pEmu->column )
+		{
+			pEmu->column = pEmu->columnStart;
+			pEmu->page	 = (pEmu->pageEnd <= pEmu->page) ? pEmu->pageStart : (pEmu->page + 1);
+		}
+		else
+		{
+			pEmu->column++;
+		}
+	}
+	else if( ADR_MODE_VERTICAL == pEmu->adrMode )
+	{
+		if( pEmu->pageEnd <= pEmu->page )
+		{
+			pEmu->page	 = pEmu->pageStart;
+			pEmu->column = (pEmu->columnEnd <= pEmu->column) ? pEmu->columnStart : (pEmu->column + 1);
+		}
+		else
+		{
+			pEmu->page++;
+		}
+	}
+	else if( pEmu->ramColumns > pEmu->column )
+	{
+		//------------------------------------------------------------------
+		//	page mode: the column pointer stops at the end of the RAM
+		//	(sh1106), the ssd1306 wraps around to the first column
+		//
+		pEmu->column++;
+
+		if( (CHIP_TYPE_SSD1306 == pEmu->chipType) && (pEmu->ramColumns <= pEmu->column) )
+		{
+			pEmu->column = 0;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_emu_scroll_setup (local)
+//--------------------------------------------------------------------------
+//	A command of the scroll engine (ssd1306 only) with the given number
+//	of parameters. The controller must not get a new setup while the
+//	scroll is active, this is counted as an error.
+//
+void _oled_emu_scroll_setup( oled_emu_t *pEmu, uint8_t parameters )
+{
+	if( CHIP_TYPE_SSD1306 == pEmu->chipType )
+	{
+		pEmu->parametersExpected = parameters;
+
+		if( pEmu->scrollActive )
+		{
+			pEmu->scrollSetupErrors++;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_emu_scroll_step (local)
+//--------------------------------------------------------------------------
+//	One step of the active scroll: the columns of the pages in the range
+//	are rotated by one column, a diagonal scroll moves the rows of the
+//	vertical scroll area by the vertical offset.
+//
+void _oled_emu_scroll_step( oled_emu_t *pEmu )
+{
+	uint8_t	usLast = pEmu->ramColumns - 1;
+	uint8_t	usKeep;
+	bool	bRight;
+
+	bRight = (OPC_RIGHT_SCROLL == pEmu->scrollOpCode) || (OPC_VERTICAL_RIGHT_SCROLL == pEmu->scrollOpCode);
+
+	for( uint8_t usPage = pEmu->scrollStartPage ; pEmu->scrollEndPage >= usPage ; usPage++ )
+	{
+		uint8_t *pRow = pEmu->ram[ usPage ];
+
+		if( bRight )
+		{
+			usKeep = pRow[ usLast ];
+			memmove( &pRow[ 1 ], &pRow[ 0 ], usLast );
+			pRow[ 0 ] = usKeep;
+		}
+		else
+		{
+			usKeep = pRow[ 0 ];
+			memmove( &pRow[ 0 ], &pRow[ 1 ], usLast );
+			pRow[ usLast ] = usKeep;
+		}
+	}
+
+	if(		((OPC_VERTICAL_RIGHT_SCROLL == pEmu->scrollOpCode) || (OPC_VERTICAL_LEFT_SCROLL == pEmu->scrollOpCode))
+		&&	(0 < pEmu->verticalScrollRows) )
+	{
+		pEmu->verticalScrollLine = (pEmu->verticalScrollLine + pEmu->scrollVerticalOffset) % pEmu->verticalScrollRows;
+	}
+
+	pEmu->scrollSteps++;
+}
+
+
+//**************************************************************************
+//	_oled_emu_com_of_row (local)
+//--------------------------------------------------------------------------
+//	The COM output (in scan order) that drives panel row y.
+//	With the alternative configuration the controller drives the rows
+//	of the first half of the scan from the even COM pins and the second
+//	half from the odd ones. If the wiring of the panel expects the other
+//	configuration the rows are interleaved.
+//
+uint8_t _oled_emu_com_of_row( const oled_emu_t *pEmu, uint8_t y )
+{
+	uint8_t	usHalf = (pEmu->multiplex + 1) / 2;
+
+	if( (CHIP_TYPE_SH1107 == pEmu->chipType) || (0 == ((pEmu->comPins ^ pEmu->panelComPins) & COM_PINS_ALTERNATIVE)) )
+	{
+		return( y );
+	}
+
+	if( pEmu->panelComPins & COM_PINS_ALTERNATIVE )
+	{
+		//------------------------------------------------------------------
+		//	panel wired alternative, controller scans sequential
+		//
+		return( (y & 0x01) ? (usHalf + (y >> 1)) : (y >> 1) );
+	}
+
+	//----------------------------------------------------------------------
+	//	panel wired sequential, controller scans alternative
+	//
+	return( (usHalf > y) ? (y << 1) : (((y - usHalf) << 1) + 1) );
+}
+
+
+//**************************************************************************
+//	_oled_emu_probe (local)
+//--------------------------------------------------------------------------
+//	Transport: address byte only.
+//
+esp_err_t _oled_emu_probe( void *pContext, uint8_t address )
+{
+	return( oled_emu_bus_write( (oled_emu_bus_t *)pContext, address, NULL, 0 ) );
+}
+
+
+//**************************************************************************
+//	_oled_emu_write (local)
+//--------------------------------------------------------------------------
+//	Transport: complete buffer as one transaction.
+//
+esp_err_t _oled_emu_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	return( oled_emu_bus_write( (oled_emu_bus_t *)pContext, address, pBuffer, length ) );
+}
+
+
+//**************************************************************************
+//	_oled_emu_write_data (local)
+//--------------------------------------------------------------------------
+//	Transport: data prefix followed by the display data.
+//
+esp_err_t _oled_emu_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length )
+{
+	oled_emu_bus_t	*pBus	= (oled_emu_bus_t *)pContext;
+	esp_err_t		 result	= ESP_FAIL;
+
+	oled_emu_bus_lock( pBus );
+
+	if( oled_emu_bus_start( pBus, address ) )
+	{
+		oled_emu_bus_byte( pBus, PREFIX_BIT_DATA );
+
+		for( size_t idx = 0 ; length > idx ; idx++ )
+		{
+			oled_emu_bus_byte( pBus, pData[ idx ] );
+		}
+
+		result = ESP_OK;
+	}
+
+	oled_emu_bus_stop( pBus );
+	oled_emu_bus_unlock( pBus );
+
+	return( result );
+}
@@ -0,0 +1,271 @@
+//##########################################################################
+//#
+//#		oled_test.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Helpers shared by the host tests.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_test.h"
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+typedef void (*test_step_t)( oled_test_display_t *pTest );
+
+typedef struct test_case
+{
+	const char	*strName;
+	test_step_t	 pStep;
+
+} test_case_t;
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+const char g_strTestHello[]		= "Hello World !";
+const char g_strTestLongText[]	= "This text is longer than one line of the display";
+
+
+//==========================================================================
+//
+//		S T E P S
+//
+//==========================================================================
+
+static void step_nothing( oled_test_display_t *pTest )
+{
+	(void)pTest;
+}
+
+static void step_print( oled_test_display_t *pTest )
+{
+	oled_display_print( &pTest->display, g_strTestHello );
+}
+
+static void step_println_long( oled_test_display_t *pTest )
+{
+	oled_display_println( &pTest->display, g_strTestLongText );
+}
+
+static void step_scroll( oled_test_display_t *pTest )
+{
+	for( int idx = 0 ; 40 > idx ; idx++ )
+	{
+		oled_display_println( &pTest->display, g_strTestHello );
+	}
+}
+
+static void step_clear_line( oled_test_display_t *pTest )
+{
+	oled_display_clear_line( &pTest->display, 2 );
+}
+
+static void step_inverse_font( oled_test_display_t *pTest )
+{
+	oled_display_set_inverse_font( &pTest->display, true );
+	oled_display_set_cursor( &pTest->display, 3, 4 );
+	oled_display_print( &pTest->display, "inverse" );
+	oled_display_set_inverse_font( &pTest->display, false );
+}
+
+static void step_flip( oled_test_display_t *pTest )
+{
+	oled_display_flip( &pTest->display, true );
+	oled_display_set_cursor( &pTest->display, 0, 0 );
+	oled_display_print( &pTest->display, g_strTestHello );
+}
+
+static void step_column_offset( oled_test_display_t *pTest )
+{
+	oled_display_set_display_column_offset( &pTest->display, 1 );
+	oled_display_clear( &pTest->display );
+	oled_display_print( &pTest->display, g_strTestHello );
+}
+
+static void step_frame_buffer( oled_test_display_t *pTest )
+{
+	oled_display_set_frame_buffer( &pTest->display, &pTest->frameBuffer );
+	oled_display_flush( &pTest->display );
+	oled_display_set_cursor( &pTest->display, 1, 0 );
+	oled_display_print( &pTest->display, "Temp:  21.5 C" );
+	oled_display_flush( &pTest->display );
+}
+
+static void step_frame_buffer_scroll( oled_test_display_t *pTest )
+{
+	step_scroll( pTest );
+	oled_display_flush( &pTest->display );
+	oled_display_set_frame_buffer( &pTest->display, NULL );
+}
+
+static void step_clear( oled_test_display_t *pTest )
+{
+	oled_display_clear( &pTest->display );
+}
+
+const test_case_t	g_arStep[] =
+	{
+		{ "init",					step_nothing				},
+		{ "print",					step_print					},
+		{ "println_long",			step_println_long			},
+		{ "scroll",					step_scroll					},
+		{ "clear_line",				step_clear_line				},
+		{ "inverse_font",			step_inverse_font			},
+		{ "flip",					step_flip					},
+		{ "column_offset",			step_column_offset			},
+		{ "frame_buffer",			step_frame_buffer			},
+		{ "frame_buffer_scroll",	step_frame_buffer_scroll	},
+		{ "clear",					step_clear					}
+	};
+
+#define TEST_STEPS		(sizeof( g_arStep ) / sizeof( g_arStep[ 0 ] ))
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	oled_test_run_steps
+//--------------------------------------------------------------------------
+//	Do every step on the reference display and on the display under
+//	test, wait for the transport of the display under test (pWait may
+//	be NULL) and compare both controllers.
+//
+bool oled_test_run_steps(	const char			*strCase,
+							oled_test_display_t	*pRef,
+							oled_test_display_t	*pTest,
+							oled_test_wait_t	 pWait,
+							void				*pContext	)
+{
+	for( size_t idx = 0 ; TEST_STEPS > idx ; idx++ )
+	{
+		g_arStep[ idx ].pStep( pRef );
+		g_arStep[ idx ].pStep( pTest );
+
+		if( (NULL != pWait) && !pWait( pContext ) )
+		{
+			printf( "%s %s: waiting for the transport failed\n", strCase, g_arStep[ idx ].strName );
+
+			return( false );
+		}
+
+		if( !pTest->display.displayConnected )
+		{
+			printf( "%s %s: display lost\n", strCase, g_arStep[ idx ].strName );
+
+			return( false );
+		}
+
+		if( !oled_test_compare( strCase, g_arStep[ idx ].strName, pRef->pEmulator, pTest->pEmulator ) )
+		{
+			return( false );
+		}
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	oled_test_compare
+//--------------------------------------------------------------------------
+//	RAM, registers and received bytes of both controllers.
+//	The bytes are counted by the controller without the prefix (control)
+//	bytes, so a transport that splits the data into more transactions
+//	than the reference receives the same.
+//
+bool oled_test_compare( const char *strCase, const char *strStep, const oled_emu_t *pRef, const oled_emu_t *pTest )
+{
+	if( 0 != memcmp( pRef->ram, pTest->ram, sizeof( pRef->ram ) ) )
+	{
+		printf( "%s %s: RAM differs\n", strCase, strStep );
+
+		return( false );
+	}
+
+	if(		(pRef->page != pTest->page) || (pRef->column != pTest->column)
+		||	(pRef->startLine != pTest->startLine) || (pRef->lineOffset != pTest->lineOffset)
+		||	(pRef->multiplex != pTest->multiplex) || (pRef->comPins != pTest->comPins)
+		||	(pRef->segmentRemap != pTest->segmentRemap) || (pRef->comScanReverse != pTest->comScanReverse)
+		||	(pRef->inverse != pTest->inverse) || (pRef->displayOn != pTest->displayOn) )
+	{
+		printf( "%s %s: registers differ\n", strCase, strStep );
+
+		return( false );
+	}
+
+	if( (pRef->commandBytes != pTest->commandBytes) || (pRef->dataBytes != pTest->dataBytes) )
+	{
+		printf(	"%s %s: received commands / data differ (reference: %u / %u, test: %u / %u)\n",
+				strCase, strStep,
+				(unsigned)pRef->commandBytes, (unsigned)pRef->dataBytes,
+				(unsigned)pTest->commandBytes, (unsigned)pTest->dataBytes			);
+
+		return( false );
+	}
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	oled_test_glyph_column
+//--------------------------------------------------------------------------
+//	One column of a glyph of a proportional font, taken bit by bit out
+//	of the font and moved down by its top rows.
+//
+uint8_t oled_test_glyph_column( const oled_font_t *pFont, const oled_glyph_t *pGlyph, uint8_t column )
+{
+	uint8_t		usColumn = 0;
+	uint32_t	ulBit;
+
+	if( 0 == (OLED_FONT_PACKED & pFont->flags) )
+	{
+		return( (uint8_t)(pFont->pColumns[ pGlyph->offset + column ] << pFont->top) );
+	}
+
+	for( uint8_t row = 0 ; pFont->height > row ; row++ )
+	{
+		ulBit = (uint32_t)(pGlyph->offset + column) * pFont->height + row;
+
+		if( pFont->pColumns[ ulBit / 8 ] & (1 << (ulBit % 8)) )
+		{
+			usColumn |= 1 << (row + pFont->top);
+		}
+	}
+
+	return( usColumn );
+}
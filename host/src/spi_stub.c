@@ -0,0 +1,337 @@
+//##########################################################################
+//#
+//#		spi_stub.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Host stand-in for the ESP-IDF SPI master and GPIO drivers.
+//#	Queued transfers are not done at once: like the DMA on the target a
+//#	transfer is done when its result is fetched, so a caller that uses
+//#	the buffer of a queued transfer again would send wrong bytes.
+//#	The pre-transfer callback is called right before the transfer and
+//#	the level of the D/C pin at this time decides if the bytes are
+//#	commands or display data for the emulated display on the CS pin.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <string.h>
+#include <driver/spi_master.h>
+#include <driver/gpio.h>
+#include "oled_emulator.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define HOST_SPI_DEVICES			4
+#define HOST_SPI_MAX_QUEUE			16
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	an emulated display on the bus
+//
+typedef struct host_spi_display
+{
+	spi_host_device_t	 host;
+	int					 csPin;
+	gpio_num_t			 dcPin;
+	oled_emu_t			*pEmu;
+
+} host_spi_display_t;
+
+
+//----------------------------------------------------------------------
+//	a device added to the bus with its queue of transfers
+//
+struct spi_device_t
+{
+	bool							 used;
+	spi_host_device_t				 host;
+	spi_device_interface_config_t	 config;
+	spi_transaction_t				*arQueue[ HOST_SPI_MAX_QUEUE ];
+	uint8_t							 first;
+	uint8_t							 count;
+};
+
+
+//==========================================================================
+//
+//		G L O B A L   V A R I A B L E S
+//
+//==========================================================================
+
+host_spi_display_t		g_arHostSpiDisplay[ HOST_SPI_DEVICES ];
+uint8_t					g_usHostSpiDisplays		= 0;
+
+struct spi_device_t		g_arHostSpiDevice[ HOST_SPI_DEVICES ];
+uint32_t				g_ulHostSpiMaxQueued	= 0;
+
+uint32_t				g_arulHostGpioLevel[ GPIO_NUM_MAX ];
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+void _host_spi_transfer( spi_device_handle_t handle, spi_transaction_t *pTrans );
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	host_spi_attach_display
+//--------------------------------------------------------------------------
+//	The emulated display is connected to the bus of the host with the
+//	given CS and D/C pin.
+//
+void host_spi_attach_display( spi_host_device_t host, int csPin, gpio_num_t dcPin, struct oled_emu *pEmu )
+{
+	if( HOST_SPI_DEVICES > g_usHostSpiDisplays )
+	{
+		g_arHostSpiDisplay[ g_usHostSpiDisplays ].host	= host;
+		g_arHostSpiDisplay[ g_usHostSpiDisplays ].csPin	= csPin;
+		g_arHostSpiDisplay[ g_usHostSpiDisplays ].dcPin	= dcPin;
+		g_arHostSpiDisplay[ g_usHostSpiDisplays ].pEmu	= pEmu;
+
+		g_usHostSpiDisplays++;
+	}
+}
+
+
+//**************************************************************************
+//	host_spi_max_queued
+//--------------------------------------------------------------------------
+//	The most transfers that were queued to one device at the same time.
+//
+uint32_t host_spi_max_queued( void )
+{
+	return( g_ulHostSpiMaxQueued );
+}
+
+
+//**************************************************************************
+//	spi_bus_add_device
+//--------------------------------------------------------------------------
+//
+esp_err_t spi_bus_add_device( spi_host_device_t host, const spi_device_interface_config_t *pConfig, spi_device_handle_t *pHandle )
+{
+	if( (HOST_SPI_MAX_QUEUE < pConfig->queue_size) || (0 >= pConfig->queue_size) )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	for( uint8_t idx = 0 ; HOST_SPI_DEVICES > idx ; idx++ )
+	{
+		if( !g_arHostSpiDevice[ idx ].used )
+		{
+			memset( &g_arHostSpiDevice[ idx ], 0, sizeof( struct spi_device_t ) );
+
+			g_arHostSpiDevice[ idx ].used	= true;
+			g_arHostSpiDevice[ idx ].host	= host;
+			g_arHostSpiDevice[ idx ].config	= *pConfig;
+
+			*pHandle = &g_arHostSpiDevice[ idx ];
+
+			return( ESP_OK );
+		}
+	}
+
+	return( ESP_ERR_NO_MEM );
+}
+
+
+//**************************************************************************
+//	spi_bus_remove_device
+//--------------------------------------------------------------------------
+//	Like the real driver, a device with queued transfers can not be
+//	removed.
+//
+esp_err_t spi_bus_remove_device( spi_device_handle_t handle )
+{
+	if( 0 < handle->count )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	handle->used = false;
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	spi_device_queue_trans
+//--------------------------------------------------------------------------
+//	The queue holds the transfers that are queued and those whose result
+//	was not fetched yet, so a full queue is an error of the caller here.
+//
+esp_err_t spi_device_queue_trans( spi_device_handle_t handle, spi_transaction_t *pTrans, TickType_t ticksToWait )
+{
+	(void)ticksToWait;
+
+	if( handle->config.queue_size <= handle->count )
+	{
+		return( ESP_ERR_TIMEOUT );
+	}
+
+	if( (0 == pTrans->length) || ((NULL == pTrans->tx_buffer) && !(pTrans->flags & SPI_TRANS_USE_TXDATA)) )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	handle->arQueue[ (handle->first + handle->count) % HOST_SPI_MAX_QUEUE ] = pTrans;
+	handle->count++;
+
+	if( g_ulHostSpiMaxQueued < handle->count )
+	{
+		g_ulHostSpiMaxQueued = handle->count;
+	}
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	spi_device_get_trans_result
+//--------------------------------------------------------------------------
+//	Do the oldest transfer and return it.
+//
+esp_err_t spi_device_get_trans_result( spi_device_handle_t handle, spi_transaction_t **ppTrans, TickType_t ticksToWait )
+{
+	(void)ticksToWait;
+
+	if( 0 == handle->count )
+	{
+		return( ESP_ERR_TIMEOUT );
+	}
+
+	*ppTrans = handle->arQueue[ handle->first ];
+
+	handle->first = (handle->first + 1) % HOST_SPI_MAX_QUEUE;
+	handle->count--;
+
+	_host_spi_transfer( handle, *ppTrans );
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	gpio_reset_pin
+//--------------------------------------------------------------------------
+//
+esp_err_t gpio_reset_pin( gpio_num_t gpioNum )
+{
+	return( gpio_set_level( gpioNum, 0 ) );
+}
+
+
+//**************************************************************************
+//	gpio_set_direction
+//--------------------------------------------------------------------------
+//
+esp_err_t gpio_set_direction( gpio_num_t gpioNum, gpio_mode_t mode )
+{
+	(void)mode;
+
+	return( ((0 <= gpioNum) && (GPIO_NUM_MAX > gpioNum)) ? ESP_OK : ESP_ERR_INVALID_ARG );
+}
+
+
+//**************************************************************************
+//	gpio_set_level
+//--------------------------------------------------------------------------
+//
+esp_err_t gpio_set_level( gpio_num_t gpioNum, uint32_t level )
+{
+	if( (0 > gpioNum) || (GPIO_NUM_MAX <= gpioNum) )
+	{
+		return( ESP_ERR_INVALID_ARG );
+	}
+
+	g_arulHostGpioLevel[ gpioNum ] = level;
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	gpio_get_level
+//--------------------------------------------------------------------------
+//
+int gpio_get_level( gpio_num_t gpioNum )
+{
+	if( (0 > gpioNum) || (GPIO_NUM_MAX <= gpioNum) )
+	{
+		return( 0 );
+	}
+
+	return( 0 != g_arulHostGpioLevel[ gpioNum ] );
+}
+
+
+//**************************************************************************
+//	_host_spi_transfer (local)
+//--------------------------------------------------------------------------
+//	One transfer on the wire: the callbacks of the device are called
+//	around it and the bytes go to the display on the CS pin of the
+//	device (if any).
+//
+void _host_spi_transfer( spi_device_handle_t handle, spi_transaction_t *pTrans )
+{
+	const uint8_t	*pData;
+
+	if( NULL != handle->config.pre_cb )
+	{
+		handle->config.pre_cb( pTrans );
+	}
+
+	pData = (pTrans->flags & SPI_TRANS_USE_TXDATA) ? pTrans->tx_data : (const uint8_t *)pTrans->tx_buffer;
+
+	for( uint8_t idx = 0 ; g_usHostSpiDisplays > idx ; idx++ )
+	{
+		host_spi_display_t	*pDisplay = &g_arHostSpiDisplay[ idx ];
+
+		if( (handle->host == pDisplay->host) && (handle->config.spics_io_num == pDisplay->csPin) )
+		{
+			oled_emu_spi_write( pDisplay->pEmu, 0 != gpio_get_level( pDisplay->dcPin ), pData, pTrans->length / 8 );
+		}
+	}
+
+	if( NULL != handle->config.post_cb )
+	{
+		handle->config.post_cb( pTrans );
+	}
+}
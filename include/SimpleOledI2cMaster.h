@@ -0,0 +1,129 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		SimpleOledI2cMaster.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	I²C transport for the SimpleOledLib with the bus / device driver of
+//#	ESP-IDF 5.2 and later (driver/i2c_master.h), needs OLED_I2C_MASTER.
+//#	All functions of SimpleOledLib.h can be used with it.
+//#
+//#	On a bus with a transaction queue (trans_queue_depth) the transport
+//#	only queues the transactions and returns, so the library prepares
+//#	the next page while the last one is still on the wire. Every queued
+//#	transaction has its own buffer, so the library can use its buffers
+//#	again at once. Only if all buffers are in use the transport waits
+//#	for the oldest transaction.
+//#	Without a transaction queue every transaction is send at once.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include "SimpleOledLib.h"
+
+#if OLED_I2C_MASTER
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <driver/i2c_master.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	OLED_I2C_QUEUE_DEPTH transactions of one display can be queued at
+//	the same time (the bus needs at least this trans_queue_depth), every
+//	one with a buffer of OLED_I2C_CHUNK_SIZE bytes including the prefix
+//	byte. Longer display data is split into several transactions.
+//	The default chunk holds a complete page of the sh1106 RAM.
+//
+#ifndef OLED_I2C_QUEUE_DEPTH
+#define OLED_I2C_QUEUE_DEPTH		4
+#endif
+
+#ifndef OLED_I2C_CHUNK_SIZE
+#define OLED_I2C_CHUNK_SIZE			(1 + 132)
+#endif
+
+#define OLED_I2C_CLOCK_DEFAULT		400000
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	the I²C connection of one display (context of g_oledI2cMasterTransport)
+//	The device is added to the bus with the address the library has
+//	found at init.
+//
+typedef struct oled_i2c_master
+{
+	i2c_master_bus_handle_t	bus;
+	i2c_master_dev_handle_t	device;
+	uint32_t				clockHz;
+	uint8_t					address;		//	address of the device
+	uint8_t					next;			//	slot of the next transaction
+	bool					async;			//	transactions are queued
+	volatile esp_err_t		error;			//	of a queued transaction
+
+	SemaphoreHandle_t		freeSlots;
+	StaticSemaphore_t		freeSlotsBuffer;
+
+	uint8_t					arBuffer[ OLED_I2C_QUEUE_DEPTH ][ OLED_I2C_CHUNK_SIZE ];
+
+} oled_i2c_master_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   V A R I A B L E S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	transport for the I²C bus / device driver (driver/i2c_master.h)
+//	the context is the oled_i2c_master_t of the display
+//
+extern const oled_transport_t	g_oledI2cMasterTransport;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+esp_err_t oled_i2c_master_init( oled_i2c_master_t *pI2c, i2c_master_bus_handle_t bus, uint32_t clockHz );
+esp_err_t oled_i2c_master_wait( oled_i2c_master_t *pI2c );
+
+uint8_t oled_display_init_i2c_master(	oled_display_handle_t	*pHandle,
+										oled_i2c_master_t		*pI2c,
+										chip_type_t				 chipType,
+										uint8_t					 address,
+										const oled_geometry_t	*pGeometry		);
+
+#endif
@@ -8,7 +8,8 @@
 //#-------------------------------------------------------------------------
 //#
 //#	The functions in this library are used to control an OLED display
-//#	with an sh1106 or ssd1306 chipset via the I²C bus.
+//#	with an sh1106, sh1107 or ssd1306 chipset via the I²C bus
+//#	(or via the SPI bus, see SimpleOledSpi.h).
 //#	Supported are only simple text output and some auxiliary functions,
 //#	e.g.: clear display, clear line, position cursor, etc.
 //#	If no display is connected nothing will be send over the I2C bus.
@@ -39,7 +40,70 @@
 //==========================================================================
 
 #include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <esp_err.h>
+
+//----------------------------------------------------------------------
+//	I²C backends
+//	OLED_I2C_LEGACY: legacy driver (driver/i2c.h, see oled_display_init)
+//	OLED_I2C_MASTER: bus / device driver (driver/i2c_master.h, ESP-IDF
+//	5.2 and later, see SimpleOledI2cMaster.h)
+//	ESP-IDF does not allow both drivers in one firmware, so for the
+//	target only one of them should be enabled.
+//
+#ifndef OLED_I2C_LEGACY
+#define OLED_I2C_LEGACY				1
+#endif
+
+#ifndef OLED_I2C_MASTER
+#define OLED_I2C_MASTER				0
+#endif
+
+#if OLED_I2C_LEGACY
 #include <driver/i2c.h>
+#endif
+
+#ifndef OLED_DISPLAY_LOCK
+#define OLED_DISPLAY_LOCK			1
+#endif
+
+//----------------------------------------------------------------------
+//	With OLED_DISPLAY_ASYNC the output of a display can be handed over
+//	to a render task (see oled_display_start_async).
+//
+#ifndef OLED_DISPLAY_ASYNC
+#define OLED_DISPLAY_ASYNC			1
+#endif
+
+//----------------------------------------------------------------------
+//	The task notification used to wait for the render task (see
+//	oled_display_wait). With more than one notification per task
+//	(configTASK_NOTIFICATION_ARRAY_ENTRIES) an index of its own keeps
+//	it apart from the notifications of the application.
+//
+#ifndef OLED_NOTIFY_INDEX
+#define OLED_NOTIFY_INDEX			0
+#endif
+
+//----------------------------------------------------------------------
+//	With OLED_DISPLAY_STATS every display counts its bus traffic
+//	(see oled_display_get_stats).
+//
+#ifndef OLED_DISPLAY_STATS
+#define OLED_DISPLAY_STATS			1
+#endif
+
+#if OLED_DISPLAY_LOCK || OLED_DISPLAY_ASYNC
+#include <freertos/FreeRTOS.h>
+#endif
+#if OLED_DISPLAY_LOCK
+#include <freertos/semphr.h>
+#endif
+#if OLED_DISPLAY_ASYNC
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#endif
 
 
 //==========================================================================
@@ -52,6 +116,98 @@
 #define DISPLAY_ADDRESS_TWO			61
 #define DISPLAY_ADDRESS_DEFAULT		255
 
+#define OLED_COMMAND_BUFFER_SIZE	3
+#define OLED_POSITION_BUFFER_SIZE	6
+
+#define OLED_ASYNC_QUEUE_LENGTH		16
+#define OLED_ASYNC_TEXT_SIZE		16
+#define OLED_ASYNC_STACK_SIZE		3072
+
+//----------------------------------------------------------------------
+//	OLED_MAX_PAGES is the number of RAM pages of the biggest controller
+//	that is used: 8 for sh1106 and ssd1306 (64 rows), 16 for the sh1107
+//	(128 rows). The frame buffer and the text shadow are sized by it.
+//
+#ifndef OLED_MAX_PAGES
+#define OLED_MAX_PAGES				8
+#endif
+
+#define OLED_FRAME_BUFFER_PAGES		OLED_MAX_PAGES
+#define OLED_FRAME_BUFFER_COLUMNS	128
+
+#define OLED_TEXT_LINES				OLED_MAX_PAGES
+#define OLED_TEXT_COLUMNS			16
+
+#define OLED_COLUMN_OFFSET_CENTER	0xFF
+
+//----	chip types (see chip_type_t)  ----------------------------------
+#define OLED_CHIP_SH1106			0
+#define OLED_CHIP_SSD1306			1
+#define OLED_CHIP_SH1107			2
+
+//----------------------------------------------------------------------
+//	Specialized build for one kind of display
+//
+//	OLED_FIXED_CHIP_TYPE pins the chip type of all displays at compile
+//	time (OLED_CHIP_SH1106, OLED_CHIP_SSD1306 or OLED_CHIP_SH1107).
+//	OLED_FIXED_WIDTH and OLED_FIXED_HEIGHT pin the geometry of the panel
+//	as well (together with OLED_FIXED_COM_PINS and
+//	OLED_FIXED_COLUMN_OFFSET, default: 0x12 and centered), this needs
+//	OLED_FIXED_CHIP_TYPE.
+//	All values of the chip and the geometry become constants, so the
+//	compiler removes the code for the other chips. With a fixed geometry
+//	the column offset can not be changed at runtime.
+//	The init refuses displays of another chip or geometry (return 3).
+//
+#if defined( OLED_FIXED_WIDTH ) || defined( OLED_FIXED_HEIGHT )
+#if !defined( OLED_FIXED_WIDTH ) || !defined( OLED_FIXED_HEIGHT ) || !defined( OLED_FIXED_CHIP_TYPE )
+#error "OLED_FIXED_WIDTH and OLED_FIXED_HEIGHT need each other and OLED_FIXED_CHIP_TYPE"
+#endif
+#ifndef OLED_FIXED_COM_PINS
+#define OLED_FIXED_COM_PINS			0x12
+#endif
+#ifndef OLED_FIXED_COLUMN_OFFSET
+#define OLED_FIXED_COLUMN_OFFSET	OLED_COLUMN_OFFSET_CENTER
+#endif
+#endif
+
+//----------------------------------------------------------------------
+//	With OLED_FRAME_BUFFER_SHADOW the frame buffer keeps a copy of the
+//	image as it was send to the display (additional 1 KB RAM).
+//	oled_display_flush() will then send only the changed columns.
+//
+#ifndef OLED_FRAME_BUFFER_SHADOW
+#define OLED_FRAME_BUFFER_SHADOW	1
+#endif
+
+//----------------------------------------------------------------------
+//	With OLED_GLYPH_VARIANTS the compiler generates the font as 64 bit
+//	tables: normal, inverted, horizontally mirrored and rotated by 180°
+//	(3 KB flash). A character is then copied with one 64 bit store.
+//	Without the tables the variants are calculated for every character.
+//	OLED_GLYPH_VARIANTS_IN_RAM places the tables in RAM (DRAM_ATTR)
+//	instead of flash, this avoids flash cache misses but needs 3 KB RAM.
+//
+#ifndef OLED_GLYPH_VARIANTS
+#define OLED_GLYPH_VARIANTS			1
+#endif
+
+#ifndef OLED_GLYPH_VARIANTS_IN_RAM
+#define OLED_GLYPH_VARIANTS_IN_RAM	0
+#endif
+
+//----------------------------------------------------------------------
+//	With OLED_TEXT_SHADOW every display keeps the characters that are
+//	shown on the display (128 bytes and one inverse bit per character).
+//	Without frame buffer a character that is already shown at the
+//	position is not send again, so only the changed characters of a
+//	text go over the bus and clearing a line sends only the columns
+//	that are not blank.
+//
+#ifndef OLED_TEXT_SHADOW
+#define OLED_TEXT_SHADOW			1
+#endif
+
 
 //==========================================================================
 //
@@ -61,12 +217,35 @@
 
 typedef enum chip_type
 {
-	CHIP_TYPE_SH1106	= 0,
-	CHIP_TYPE_SSD1306
+	CHIP_TYPE_SH1106	= OLED_CHIP_SH1106,
+	CHIP_TYPE_SSD1306	= OLED_CHIP_SSD1306,
+	CHIP_TYPE_SH1107	= OLED_CHIP_SH1107
 
 } chip_type_t;
 
 
+//----------------------------------------------------------------------
+//	The geometry of the panel
+//
+//	width and height are the visible pixels of the panel, both must be
+//	a multiple of 8 (one character). columnOffset is the RAM column that
+//	is shown in the left most pixel column, OLED_COLUMN_OFFSET_CENTER
+//	places the panel in the middle of the RAM (that is how most panels
+//	are connected). comPins is the parameter of the COM pins hardware
+//	configuration (0x02: sequential, 0x12: alternative), the sh1107 has
+//	no such command.
+//	Only the visible pages and columns are cleared and send.
+//
+typedef struct oled_geometry
+{
+	uint8_t		width;
+	uint8_t		height;
+	uint8_t		columnOffset;
+	uint8_t		comPins;
+
+} oled_geometry_t;
+
+
 //----------------------------------------------------------------------
 //	The different print modes
 //
@@ -87,6 +266,9 @@ typedef enum chip_type
 //		If it was the last line of the display then scroll all lines
 //		up one line, discarding the first line, clear the last line
 //		and continue the output in the cleared last line.
+//		The display can scroll smoothly (see
+//		oled_display_set_smooth_scroll) and the scroll can be limited
+//		to some lines (see oled_display_set_scroll_region).
 //
 typedef enum print_mode
 {
@@ -97,46 +279,445 @@ typedef enum print_mode
 } print_mode_t;
 
 
+//----------------------------------------------------------------------
+//	The different glyph variants
+//
+//	Only the bitmap of every character is changed, not the position
+//	where it is printed (see oled_display_set_glyph_variant).
+//
+//	GLYPH_NORMAL:
+//		the characters as they are defined in the font.
+//
+//	GLYPH_MIRRORED:
+//		every character is mirrored horizontally (right to left).
+//
+//	GLYPH_ROTATED:
+//		every character is rotated by 180° (upside down).
+//
+typedef enum glyph_variant
+{
+	GLYPH_NORMAL	= 0,
+	GLYPH_MIRRORED,
+	GLYPH_ROTATED
+
+} glyph_variant_t;
+
+
+//----------------------------------------------------------------------
+//	The directions of a marquee (see oled_display_start_marquee)
+//
+//	MARQUEE_LEFT, MARQUEE_RIGHT:
+//		the lines move one column to the left / right with every step.
+//
+//	MARQUEE_UP_LEFT, MARQUEE_UP_RIGHT:
+//		same as above, in addition the whole panel moves one row up
+//		with every step (diagonal scroll).
+//
+typedef enum marquee_direction
+{
+	MARQUEE_LEFT	= 0,
+	MARQUEE_RIGHT,
+	MARQUEE_UP_LEFT,
+	MARQUEE_UP_RIGHT
+
+} marquee_direction_t;
+
+
+//----------------------------------------------------------------------
+//	The time between two steps of a marquee in frames of the display
+//	(with the oscillator setting of the init about 100 frames per
+//	second). The values are the codes of the ssd1306.
+//
+typedef enum scroll_interval
+{
+	SCROLL_INTERVAL_5_FRAMES	= 0,
+	SCROLL_INTERVAL_64_FRAMES,
+	SCROLL_INTERVAL_128_FRAMES,
+	SCROLL_INTERVAL_256_FRAMES,
+	SCROLL_INTERVAL_3_FRAMES,
+	SCROLL_INTERVAL_4_FRAMES,
+	SCROLL_INTERVAL_25_FRAMES,
+	SCROLL_INTERVAL_2_FRAMES
+
+} scroll_interval_t;
+
+
+//----------------------------------------------------------------------
+//	Proportional fonts (see oled_display_print_font)
+//
+//	Every character firstChar ... lastChar (ASCII) has a glyph with its
+//	own width. The text is UTF-8: the glyphs of the other characters
+//	follow in pGlyphs, their Unicode codepoints are in pCodepoints in
+//	the same order, sorted ascending (binary search). A font without
+//	them has extendedChars 0. The columns of all glyphs are stored one
+//	after the other in pColumns, bit 0 of a column is the top row of
+//	the glyph:
+//	-	one byte per column
+//	-	with OLED_FONT_PACKED 'height' bits per column without gaps,
+//		starting with the lowest bit of the first byte. The data needs
+//		one spare byte at the end.
+//	The glyph is drawn 'top' rows below the top of the text line, the
+//	next glyph starts 'advance' columns later (no kerning). The columns
+//	between width and advance are empty.
+//
+#define OLED_FONT_PACKED			0x01
+
+typedef struct oled_glyph
+{
+	uint16_t	offset;			//	number of the first column
+	uint8_t		width;			//	columns of the glyph
+	uint8_t		advance;		//	columns up to the next glyph
+
+} oled_glyph_t;
+
+typedef struct oled_font
+{
+	const uint8_t		*pColumns;
+	const oled_glyph_t	*pGlyphs;		//	firstChar ... lastChar
+	uint8_t				 firstChar;
+	uint8_t				 lastChar;
+	uint8_t				 height;		//	rows of a column (1 ... 8)
+	uint8_t				 top;			//	empty rows above the glyphs
+	uint8_t				 flags;			//	OLED_FONT_PACKED
+	const uint16_t		*pCodepoints;	//	extended characters, sorted
+	uint16_t			 extendedChars;
+
+} oled_font_t;
+
+//----------------------------------------------------------------------
+//	largest scale of oled_display_print_scaled(), a text line of the
+//	font becomes OLED_MAX_SCALE text lines of the display
+//
+#define OLED_MAX_SCALE				4
+
+
+//----------------------------------------------------------------------
+//	The transport layer
+//
+//	All bytes for the display are send through these functions, so the
+//	library can talk to the display over another bus or to an emulator.
+//	pContext is the value given to oled_display_init_transport().
+//
+//	probe:
+//		check if a device answers under the given address
+//		(address byte only, no data)
+//
+//	write:
+//		send the buffer as one transaction, the buffer already starts
+//		with the prefix (control) byte
+//
+//	write_data:
+//		send the prefix PREFIX_DATA followed by the given display data
+//		as one transaction
+//
+typedef struct oled_transport
+{
+	esp_err_t	(*probe)( void *pContext, uint8_t address );
+	esp_err_t	(*write)( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length );
+	esp_err_t	(*write_data)( void *pContext, uint8_t address, const uint8_t *pData, size_t length );
+
+} oled_transport_t;
+
+
+//----------------------------------------------------------------------
+//	RAM copy of the display (frame buffer)
+//
+//	The image is organized like the display RAM: one byte holds the
+//	eight pixels of one column in a page, bit 0 is the top pixel.
+//	The pages are the RAM pages of the display, i.e. the line offset
+//	used for scrolling is not applied to the image.
+//	Each bit in dirtyPages marks a page that must be send with the
+//	next oled_display_flush().
+//	shadow holds the image as it was send to the display, it can only
+//	be used for pages that are marked in validPages.
+//	The image is aligned to 64 bit, so a character can be copied into
+//	it with one 64 bit store.
+//
+typedef struct oled_frame_buffer
+{
+	_Alignas( uint64_t )
+	uint8_t		image[ OLED_FRAME_BUFFER_PAGES ][ OLED_FRAME_BUFFER_COLUMNS ];
+#if OLED_FRAME_BUFFER_SHADOW
+	uint8_t		shadow[ OLED_FRAME_BUFFER_PAGES ][ OLED_FRAME_BUFFER_COLUMNS ];
+	uint16_t	validPages;
+#endif
+	uint16_t	dirtyPages;
+	bool		lineOffsetDirty;
+
+} oled_frame_buffer_t;
+
+
+//----------------------------------------------------------------------
+//	What the drawing functions do with the pixels of a shape
+//	(see oled_display_draw_pixel)
+//
+typedef enum pixel_op
+{
+	PIXEL_SET	= 0,
+	PIXEL_CLEAR,
+	PIXEL_XOR
+
+} pixel_op_t;
+
+
+//----------------------------------------------------------------------
+//	Bus statistics
+//
+//	The bus traffic is counted for the function of the display that
+//	caused it. If a function calls another one, e.g. clear calls
+//	set_cursor, the traffic is counted for the first one, except for
+//	scrolling which is always counted for itself.
+//	The position commands of set_cursor are send with the next output,
+//	but they are counted for set_cursor (or the function that called it).
+//	OLED_STATS_OTHER counts init, inverse, flip, etc.
+//
+//	calls:			number of calls (scrolling: number of scrolled lines)
+//	transactions:	transactions on the bus
+//	bytes:			bytes on the bus, address bytes included
+//	failures:		transactions that failed (timeouts not included)
+//	timeouts:		transactions that ran into the timeout
+//	cursorWrites:	position commands (page and column address)
+//	timeUs:			time spent in the transport (bus driver) in µs
+//
+typedef enum oled_stats_entry
+{
+	OLED_STATS_PRINT	= 0,
+	OLED_STATS_CLEAR,
+	OLED_STATS_CLEAR_LINE,
+	OLED_STATS_SET_CURSOR,
+	OLED_STATS_SCROLL,
+	OLED_STATS_FLUSH,
+	OLED_STATS_OTHER,
+	OLED_STATS_ENTRIES
+
+} oled_stats_entry_t;
+
+#if OLED_DISPLAY_STATS
+typedef struct oled_stats_counter
+{
+	uint32_t	calls;
+	uint32_t	transactions;
+	uint32_t	bytes;
+	uint32_t	failures;
+	uint32_t	timeouts;
+	uint32_t	cursorWrites;
+	uint64_t	timeUs;
+
+} oled_stats_counter_t;
+
+typedef struct oled_display_stats
+{
+	oled_stats_counter_t	entry[ OLED_STATS_ENTRIES ];
+
+} oled_display_stats_t;
+#endif
+
+
+#if OLED_DISPLAY_ASYNC
+struct oled_display_handle;
+
+//----------------------------------------------------------------------
+//	Asynchronous output (render task)
+//
+//	Every function of the display puts a small render command into the
+//	queue and returns at once. The render task takes the commands out
+//	of the queue and does the output on the bus.
+//	A text is split into commands of OLED_ASYNC_TEXT_SIZE characters.
+//	If the queue is full the caller waits until there is space again.
+//
+//	A fence is a marker in the queue. When the render task reaches the
+//	fence all output queued before the fence has been send and the done
+//	callback is called (in the context of the render task) with the
+//	number of the fence. oled_display_wait() uses a fence too.
+//
+typedef void (*oled_display_done_cb_t)( struct oled_display_handle *pHandle, uint32_t fence, void *pUser );
+
+typedef struct oled_render_cmd
+{
+	uint8_t		type;
+	uint8_t		length;
+	uint8_t		parameter[ 2 ];
+	union
+	{
+		char					 text[ OLED_ASYNC_TEXT_SIZE ];
+		struct oled_frame_buffer	*pFrameBuffer;
+		struct
+		{
+			uint32_t			 fence;
+			TaskHandle_t		 waiter;
+		};
+	};
+
+} oled_render_cmd_t;
+
+typedef struct oled_async
+{
+	QueueHandle_t			queue;
+	StaticQueue_t			queueBuffer;
+	uint8_t					queueStorage[ OLED_ASYNC_QUEUE_LENGTH * sizeof( oled_render_cmd_t ) ];
+	TaskHandle_t			task;
+	StaticTask_t			taskBuffer;
+	StackType_t				stack[ OLED_ASYNC_STACK_SIZE ];
+	oled_display_done_cb_t	pDoneCallback;
+	void				   *pUser;
+	uint32_t				fenceIssued;
+	volatile uint32_t		fenceDone;
+
+} oled_async_t;
+#endif
+
+
 //----------------------------------------------------------------------
 //	the display structure
 //
 typedef struct oled_display_handle
 {
+	const oled_transport_t	*pTransport;
+	void					*pTransportContext;
+	oled_frame_buffer_t		*pFrameBuffer;
+#if OLED_DISPLAY_ASYNC
+	oled_async_t			*pAsync;
+#endif
+#if OLED_I2C_LEGACY
 	i2c_port_t		port;
+#endif
 	chip_type_t		chipType;
 	uint8_t			address;
 	print_mode_t	printMode;
 	uint8_t			displayColumnOffset;
+	oled_geometry_t	geometry;
+	uint8_t			textLines;			//	visible text lines
+	uint8_t			textColumns;		//	visible text columns
+	uint8_t			ramPages;			//	pages of the display RAM
+	uint8_t			ramColumns;			//	columns of the display RAM
 	uint8_t			textLine;
 	uint8_t			textColumn;
 	uint8_t			lineOffset;
 	bool			displayConnected;
 	bool			inverse;
+	bool			flipped;
+	bool			positionPending;	//	RAM pointer is not at the cursor
+	glyph_variant_t	glyphVariant;
+	uint16_t		marqueePages;		//	RAM pages scrolled by the controller
+	uint8_t			smoothScrollMs;		//	time per row, 0: scroll whole lines
+	uint8_t			scrollFirstLine;	//	scroll region of PM_SCROLL_LINE
+	uint8_t			scrollLastLine;
+
+	//------------------------------------------------------------------
+	//	command buffers, every display has its own, so different
+	//	displays can be used by different tasks at the same time
+	//
+	uint8_t			commandBuffer[ OLED_COMMAND_BUFFER_SIZE ];
+	uint8_t			positionCommandBuffer[ OLED_POSITION_BUFFER_SIZE ];
+
+#if OLED_I2C_LEGACY
+	//------------------------------------------------------------------
+	//	memory for the I²C command link of the legacy I²C transport,
+	//	so no heap is needed to send display data
+	//
+	uint8_t			i2cLinkBuffer[ I2C_LINK_RECOMMENDED_SIZE( 1 ) ];
+#endif
+
+#if OLED_TEXT_SHADOW
+	//------------------------------------------------------------------
+	//	characters shown on the display (see OLED_TEXT_SHADOW)
+	//	indexed by the RAM page, 0x00 marks an unknown character
+	//
+	uint8_t			textShadow[ OLED_TEXT_LINES ][ OLED_TEXT_COLUMNS ];
+	uint16_t		textShadowInverse[ OLED_TEXT_LINES ];
+#endif
+
+#if OLED_DISPLAY_STATS
+	oled_display_stats_t	stats;
+	uint8_t					statsEntry;		//	entry that is counted
+	uint8_t					positionEntry;	//	entry that moved the cursor
+#endif
+
+#if OLED_DISPLAY_LOCK
+	//------------------------------------------------------------------
+	//	optional lock (see oled_display_enable_lock)
+	//
+	SemaphoreHandle_t	lock;
+	StaticSemaphore_t	lockBuffer;
+#endif
 
 } oled_display_handle_t;
 
 
+//==========================================================================
+//
+//		E X T E R N   V A R I A B L E S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	transport for the legacy ESP-IDF I²C driver (driver/i2c.h)
+//	the context is the display handle
+//
+#if OLED_I2C_LEGACY
+extern const oled_transport_t	g_oledI2cTransport;
+#endif
+
+//----------------------------------------------------------------------
+//	geometries of the supported panels
+//	(128x128 needs the sh1107 and OLED_MAX_PAGES 16)
+//
+extern const oled_geometry_t	g_oledGeometry128x64;
+extern const oled_geometry_t	g_oledGeometry128x32;
+extern const oled_geometry_t	g_oledGeometry64x48;
+extern const oled_geometry_t	g_oledGeometry72x40;
+extern const oled_geometry_t	g_oledGeometry128x128;
+
+//----------------------------------------------------------------------
+//	proportional fonts (see font_proportional.h)
+//
+extern const oled_font_t		g_oledFont5x7;
+extern const oled_font_t		g_oledFont3x5;
+
+
 //==========================================================================
 //
 //		E X T E R N   F U N C T I O N S
 //
 //==========================================================================
 
-uint8_t oled_display_max_text_lines( void );
-uint8_t oled_display_max_column_lines( void );
+uint8_t oled_display_max_text_lines( oled_display_handle_t *pHandle );
+uint8_t oled_display_max_column_lines( oled_display_handle_t *pHandle );
 
+#if OLED_I2C_LEGACY
 uint8_t oled_display_init( oled_display_handle_t *pHandle, i2c_port_t port, chip_type_t chipType, uint8_t address );
+#endif
+uint8_t oled_display_init_transport(	oled_display_handle_t	*pHandle,
+										const oled_transport_t	*pTransport,
+										void					*pContext,
+										chip_type_t				 chipType,
+										uint8_t					 address		);
+uint8_t oled_display_init_panel(	oled_display_handle_t	*pHandle,
+									const oled_transport_t	*pTransport,
+									void					*pContext,
+									chip_type_t				 chipType,
+									uint8_t					 address,
+									const oled_geometry_t	*pGeometry		);
 
 void oled_display_print_char( oled_display_handle_t *pHandle, uint8_t charIdx );
 void oled_display_print( oled_display_handle_t *pHandle, const char* strText );
 void oled_display_println( oled_display_handle_t *pHandle, const char* strText );
+uint8_t oled_display_print_font(	oled_display_handle_t	*pHandle,
+									const oled_font_t		*pFont,
+									uint8_t					 textLine,
+									uint8_t					 x,
+									const char				*strText	);
+uint8_t oled_display_print_scaled(	oled_display_handle_t	*pHandle,
+									const oled_font_t		*pFont,
+									uint8_t					 scale,
+									uint8_t					 textLine,
+									uint8_t					 x,
+									const char				*strText	);
+uint16_t oled_font_text_width( const oled_font_t *pFont, const char *strText );
 
 void oled_display_clear( oled_display_handle_t *pHandle );
 void oled_display_clear_line( oled_display_handle_t *pHandle, uint8_t lineToClear );
-inline void oled_display_clear_actual_line( oled_display_handle_t *pHandle )
-{
-	oled_display_clear_line( pHandle, pHandle->textLine );
-};
+void oled_display_clear_actual_line( oled_display_handle_t *pHandle );
 
 void oled_display_set_cursor( oled_display_handle_t *pHandle, uint8_t textLine, uint8_t textColumn );
 
@@ -148,14 +729,50 @@ inline void oled_display_home( oled_display_handle_t *pHandle )
 void oled_display_set_inverse( oled_display_handle_t *pHandle, bool inverse );
 void oled_display_flip( oled_display_handle_t *pHandle, bool flip );
 
-inline void oled_display_set_inverse_font( oled_display_handle_t *pHandle, bool bInverse )
-{
-	pHandle->inverse = bInverse;
-};
+void oled_display_start_marquee(	oled_display_handle_t	*pHandle,
+									uint8_t					 firstLine,
+									uint8_t					 lastLine,
+									marquee_direction_t		 direction,
+									scroll_interval_t		 interval	);
+void oled_display_stop_marquee( oled_display_handle_t *pHandle );
 
-inline void oled_display_set_print_mode( oled_display_handle_t *pHandle, print_mode_t printMode )
-{
-	pHandle->printMode = printMode;
-};
+void oled_display_set_inverse_font( oled_display_handle_t *pHandle, bool bInverse );
+void oled_display_set_glyph_variant( oled_display_handle_t *pHandle, glyph_variant_t glyphVariant );
+void oled_display_set_print_mode( oled_display_handle_t *pHandle, print_mode_t printMode );
+void oled_display_set_smooth_scroll( oled_display_handle_t *pHandle, uint8_t stepMs );
+void oled_display_set_scroll_region( oled_display_handle_t *pHandle, uint8_t firstLine, uint8_t lastLine );
 
 void oled_display_set_display_column_offset( oled_display_handle_t *pHandle, uint8_t offset );
+
+void oled_display_set_frame_buffer( oled_display_handle_t *pHandle, oled_frame_buffer_t *pFrameBuffer );
+uint32_t oled_display_flush( oled_display_handle_t *pHandle );
+
+void oled_display_draw_pixel( oled_display_handle_t *pHandle, int16_t x, int16_t y, pixel_op_t op );
+void oled_display_draw_hline( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t width, pixel_op_t op );
+void oled_display_draw_vline( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t height, pixel_op_t op );
+void oled_display_draw_line( oled_display_handle_t *pHandle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, pixel_op_t op );
+void oled_display_draw_rect( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t width, int16_t height, pixel_op_t op );
+void oled_display_fill_rect( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t width, int16_t height, pixel_op_t op );
+void oled_display_draw_circle( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t radius, pixel_op_t op );
+
+#if OLED_DISPLAY_LOCK
+void oled_display_enable_lock( oled_display_handle_t *pHandle );
+#endif
+void oled_display_lock( oled_display_handle_t *pHandle );
+void oled_display_unlock( oled_display_handle_t *pHandle );
+
+#if OLED_DISPLAY_STATS
+void oled_display_get_stats( oled_display_handle_t *pHandle, oled_display_stats_t *pStats, bool bReset );
+void oled_display_reset_stats( oled_display_handle_t *pHandle );
+#endif
+
+#if OLED_DISPLAY_ASYNC
+uint8_t oled_display_start_async(	oled_display_handle_t	*pHandle,
+									oled_async_t			*pAsync,
+									UBaseType_t				 priority,
+									oled_display_done_cb_t	 pDoneCallback,
+									void					*pUser			);
+void oled_display_stop_async( oled_display_handle_t *pHandle );
+uint32_t oled_display_fence( oled_display_handle_t *pHandle );
+bool oled_display_wait( oled_display_handle_t *pHandle, TickType_t ticksToWait );
+#endif
@@ -0,0 +1,135 @@
+#pragma once
+
+//##########################################################################
+//#
+//#		SimpleOledSpi.h
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	SPI transport for the SimpleOledLib: the sh1106, sh1107 and ssd1306
+//#	controllers are connected over 4-wire SPI (SCLK, MOSI, CS and the
+//#	D/C pin that selects between commands and display data).
+//#	All functions of SimpleOledLib.h can be used with it.
+//#
+//#	The transfers are queued to the SPI master driver (DMA) and the
+//#	transport returns without waiting for the end of the transfer.
+//#	Every queued transfer has its own buffer, so the library can use
+//#	its buffers again at once. Only if all buffers are in use the
+//#	transport waits for the oldest transfer.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <freertos/FreeRTOS.h>
+#include <driver/spi_master.h>
+#include <driver/gpio.h>
+#include <esp_attr.h>
+
+#include "SimpleOledLib.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	OLED_SPI_QUEUE_DEPTH transfers can be queued to the driver at the
+//	same time, every one with a buffer of OLED_SPI_CHUNK_SIZE bytes.
+//	Longer writes are split into several transfers. The default chunk
+//	holds a complete page of the sh1106 RAM.
+//
+#ifndef OLED_SPI_QUEUE_DEPTH
+#define OLED_SPI_QUEUE_DEPTH		4
+#endif
+
+#ifndef OLED_SPI_CHUNK_SIZE
+#define OLED_SPI_CHUNK_SIZE			132
+#endif
+
+#define OLED_SPI_CLOCK_DEFAULT		(8 * 1000 * 1000)
+
+
+//==========================================================================
+//
+//		T Y P E   D E F I N I T I O N S
+//
+//==========================================================================
+
+struct oled_spi;
+
+//----------------------------------------------------------------------
+//	one transfer of the queue together with its level of the D/C pin
+//
+typedef struct oled_spi_trans
+{
+	spi_transaction_t	 trans;
+	struct oled_spi		*pSpi;
+	uint8_t				 dcLevel;		//	0: commands, 1: display data
+
+} oled_spi_trans_t;
+
+
+//----------------------------------------------------------------------
+//	the SPI connection of one display (context of g_oledSpiTransport)
+//	The buffers are used by the DMA, so the structure must be placed in
+//	internal RAM (static variable or MALLOC_CAP_DMA).
+//
+typedef struct oled_spi
+{
+	spi_device_handle_t	device;
+	gpio_num_t			dcPin;
+	uint8_t				next;			//	slot of the transfer that is filled
+	uint8_t				queued;			//	transfers queued to the driver
+	uint16_t			fill;			//	bytes in the buffer of the next slot
+	uint8_t				fillLevel;		//	D/C level of these bytes
+
+	oled_spi_trans_t	arTrans[ OLED_SPI_QUEUE_DEPTH ];
+
+	WORD_ALIGNED_ATTR uint8_t	arBuffer[ OLED_SPI_QUEUE_DEPTH ][ OLED_SPI_CHUNK_SIZE ];
+
+} oled_spi_t;
+
+
+//==========================================================================
+//
+//		E X T E R N   V A R I A B L E S
+//
+//==========================================================================
+
+//----------------------------------------------------------------------
+//	transport for the SPI master driver (driver/spi_master.h)
+//	the context is the oled_spi_t of the display, the address is not used
+//
+extern const oled_transport_t	g_oledSpiTransport;
+
+
+//==========================================================================
+//
+//		E X T E R N   F U N C T I O N S
+//
+//==========================================================================
+
+esp_err_t oled_spi_init( oled_spi_t *pSpi, spi_host_device_t host, gpio_num_t csPin, gpio_num_t dcPin, int clockHz );
+esp_err_t oled_spi_wait( oled_spi_t *pSpi );
+
+uint8_t oled_display_init_spi(	oled_display_handle_t	*pHandle,
+								oled_spi_t				*pSpi,
+								chip_type_t				 chipType,
+								const oled_geometry_t	*pGeometry		);
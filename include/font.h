@@ -30,102 +30,147 @@
 //	May be that this is different than other fonts where each value will
 //	hold the dots for one row of a character.
 //
-const unsigned char font8x8_simple[768] =
+//	The glyphs are given as list, so the compiler can generate variants
+//	of the font (see SimpleOledLib.c). GLYPH( c0, .. c7 ) is called for
+//	every character with the eight column bytes.
+//
+#define FONT8X8_SIMPLE( GLYPH )	\
+	GLYPH( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 )	/*	space	*/	\
+	GLYPH( 0x00, 0x00, 0x06, 0x5F, 0x5F, 0x06, 0x00, 0x00 )	/*	!	*/	\
+	GLYPH( 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00 )	/*	"	*/	\
+	GLYPH( 0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x00 )	/*	#	*/	\
+	GLYPH( 0x24, 0x2E, 0x6B, 0x6B, 0x3A, 0x12, 0x00, 0x00 )	/*	$	*/	\
+	GLYPH( 0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x00 )	/*	%	*/	\
+	GLYPH( 0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48, 0x00 )	/*	&	*/	\
+	GLYPH( 0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00 )	/*	'	*/	\
+	GLYPH( 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x00, 0x00, 0x00 )	/*	(	*/	\
+	GLYPH( 0x00, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x00, 0x00 )	/*	)	*/	\
+	GLYPH( 0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08 )	/*	*	*/	\
+	GLYPH( 0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x00, 0x00 )	/*	+	*/	\
+	GLYPH( 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00, 0x00, 0x00 )	/*	,	*/	\
+	GLYPH( 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 )	/*	-	*/	\
+	GLYPH( 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 )	/*	.	*/	\
+	GLYPH( 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00 )	/*	/	*/	\
+	GLYPH( 0x3E, 0x7F, 0x71, 0x59, 0x4D, 0x7F, 0x3E, 0x00 )	/*	0	*/	\
+	GLYPH( 0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x00, 0x00 )	/*	1	*/	\
+	GLYPH( 0x62, 0x73, 0x59, 0x49, 0x6F, 0x26, 0x00, 0x00 )	/*	2	*/	\
+	GLYPH( 0x22, 0x63, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x00 )	/*	3	*/	\
+	GLYPH( 0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50, 0x00 )	/*	4	*/	\
+	GLYPH( 0x27, 0x67, 0x45, 0x45, 0x7D, 0x39, 0x00, 0x00 )	/*	5	*/	\
+	GLYPH( 0x3C, 0x7E, 0x4B, 0x49, 0x79, 0x30, 0x00, 0x00 )	/*	6	*/	\
+	GLYPH( 0x03, 0x03, 0x71, 0x79, 0x0F, 0x07, 0x00, 0x00 )	/*	7	*/	\
+	GLYPH( 0x36, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x00 )	/*	8	*/	\
+	GLYPH( 0x06, 0x4F, 0x49, 0x69, 0x3F, 0x1E, 0x00, 0x00 )	/*	9	*/	\
+	GLYPH( 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 )	/*	:	*/	\
+	GLYPH( 0x00, 0x80, 0xE6, 0x66, 0x00, 0x00, 0x00, 0x00 )	/*	;	*/	\
+	GLYPH( 0x00, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x00, 0x00 )	/*	<	*/	\
+	GLYPH( 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00 )	/*	=	*/	\
+	GLYPH( 0x00, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x00, 0x00 )	/*	>	*/	\
+	GLYPH( 0x02, 0x03, 0x51, 0x59, 0x0F, 0x06, 0x00, 0x00 )	/*	?	*/	\
+	GLYPH( 0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x1F, 0x1E, 0x00 )	/*	@	*/	\
+	GLYPH( 0x7C, 0x7E, 0x13, 0x13, 0x7E, 0x7C, 0x00, 0x00 )	/*	A	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00 )	/*	B	*/	\
+	GLYPH( 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00 )	/*	C	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x41, 0x63, 0x7E, 0x1C, 0x00 )	/*	D	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00 )	/*	E	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03, 0x00 )	/*	F	*/	\
+	GLYPH( 0x1C, 0x3E, 0x63, 0x41, 0x51, 0x73, 0x72, 0x00 )	/*	G	*/	\
+	GLYPH( 0x7F, 0x7F, 0x08, 0x08, 0x7F, 0x7F, 0x00, 0x00 )	/*	H	*/	\
+	GLYPH( 0x00, 0x41, 0x7F, 0x7F, 0x41, 0x00, 0x00, 0x00 )	/*	I	*/	\
+	GLYPH( 0x30, 0x70, 0x41, 0x4F, 0x7F, 0x31, 0x00, 0x00 )	/*	J	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63, 0x00 )	/*	K	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70, 0x00 )	/*	L	*/	\
+	GLYPH( 0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x00 )	/*	M	*/	\
+	GLYPH( 0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F, 0x00 )	/*	N	*/	\
+	GLYPH( 0x1C, 0x3E, 0x63, 0x41, 0x63, 0x3E, 0x1C, 0x00 )	/*	O	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06, 0x00 )	/*	P	*/	\
+	GLYPH( 0x1E, 0x3F, 0x21, 0x71, 0x7F, 0x5E, 0x00, 0x00 )	/*	Q	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66, 0x00 )	/*	R	*/	\
+	GLYPH( 0x26, 0x6F, 0x4D, 0x59, 0x73, 0x32, 0x00, 0x00 )	/*	S	*/	\
+	GLYPH( 0x03, 0x41, 0x7F, 0x7F, 0x41, 0x03, 0x00, 0x00 )	/*	T	*/	\
+	GLYPH( 0x7F, 0x7F, 0x40, 0x40, 0x7F, 0x7F, 0x00, 0x00 )	/*	U	*/	\
+	GLYPH( 0x1F, 0x3F, 0x60, 0x60, 0x3F, 0x1F, 0x00, 0x00 )	/*	V	*/	\
+	GLYPH( 0x7F, 0x7F, 0x30, 0x18, 0x30, 0x7F, 0x7F, 0x00 )	/*	W	*/	\
+	GLYPH( 0x43, 0x67, 0x3C, 0x18, 0x3C, 0x67, 0x43, 0x00 )	/*	X	*/	\
+	GLYPH( 0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07, 0x00, 0x00 )	/*	Y	*/	\
+	GLYPH( 0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73, 0x00 )	/*	Z	*/	\
+	GLYPH( 0x00, 0x7F, 0x7F, 0x41, 0x41, 0x00, 0x00, 0x00 )	/*	[	*/	\
+	GLYPH( 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00 )	/*	(\)	*/	\
+	GLYPH( 0x00, 0x41, 0x41, 0x7F, 0x7F, 0x00, 0x00, 0x00 )	/*	]	*/	\
+	GLYPH( 0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08, 0x00 )	/*	^	*/	\
+	GLYPH( 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 )	/*	_	*/	\
+	GLYPH( 0x00, 0x00, 0x03, 0x07, 0x04, 0x00, 0x00, 0x00 )	/*	`	*/	\
+	GLYPH( 0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40, 0x00 )	/*	a	*/	\
+	GLYPH( 0x41, 0x7F, 0x3F, 0x48, 0x48, 0x78, 0x30, 0x00 )	/*	b	*/	\
+	GLYPH( 0x38, 0x7C, 0x44, 0x44, 0x6C, 0x28, 0x00, 0x00 )	/*	c	*/	\
+	GLYPH( 0x30, 0x78, 0x48, 0x49, 0x3F, 0x7F, 0x40, 0x00 )	/*	d	*/	\
+	GLYPH( 0x38, 0x7C, 0x54, 0x54, 0x5C, 0x18, 0x00, 0x00 )	/*	e	*/	\
+	GLYPH( 0x48, 0x7E, 0x7F, 0x49, 0x03, 0x02, 0x00, 0x00 )	/*	f	*/	\
+	GLYPH( 0x98, 0xBC, 0xA4, 0xA4, 0xF8, 0x7C, 0x04, 0x00 )	/*	g	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78, 0x00 )	/*	h	*/	\
+	GLYPH( 0x00, 0x44, 0x7D, 0x7D, 0x40, 0x00, 0x00, 0x00 )	/*	i	*/	\
+	GLYPH( 0x60, 0xE0, 0x80, 0x80, 0xFD, 0x7D, 0x00, 0x00 )	/*	j	*/	\
+	GLYPH( 0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44, 0x00 )	/*	k	*/	\
+	GLYPH( 0x00, 0x41, 0x7F, 0x7F, 0x40, 0x00, 0x00, 0x00 )	/*	l	*/	\
+	GLYPH( 0x7C, 0x7C, 0x18, 0x38, 0x1C, 0x7C, 0x78, 0x00 )	/*	m	*/	\
+	GLYPH( 0x7C, 0x7C, 0x04, 0x04, 0x7C, 0x78, 0x00, 0x00 )	/*	n	*/	\
+	GLYPH( 0x38, 0x7C, 0x44, 0x44, 0x7C, 0x38, 0x00, 0x00 )	/*	o	*/	\
+	GLYPH( 0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18, 0x00 )	/*	p	*/	\
+	GLYPH( 0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84, 0x00 )	/*	q	*/	\
+	GLYPH( 0x44, 0x7C, 0x78, 0x4C, 0x04, 0x1C, 0x18, 0x00 )	/*	r	*/	\
+	GLYPH( 0x48, 0x5C, 0x54, 0x54, 0x74, 0x24, 0x00, 0x00 )	/*	s	*/	\
+	GLYPH( 0x00, 0x04, 0x3E, 0x7F, 0x44, 0x24, 0x00, 0x00 )	/*	t	*/	\
+	GLYPH( 0x3C, 0x7C, 0x40, 0x40, 0x3C, 0x7C, 0x40, 0x00 )	/*	u	*/	\
+	GLYPH( 0x1C, 0x3C, 0x60, 0x60, 0x3C, 0x1C, 0x00, 0x00 )	/*	v	*/	\
+	GLYPH( 0x3C, 0x7C, 0x70, 0x38, 0x70, 0x7C, 0x3C, 0x00 )	/*	w	*/	\
+	GLYPH( 0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x00 )	/*	x	*/	\
+	GLYPH( 0x1C, 0xBC, 0xE0, 0xE0, 0x3C, 0x1C, 0x00, 0x00 )	/*	y	*/	\
+	GLYPH( 0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64, 0x00, 0x00 )	/*	z	*/	\
+	GLYPH( 0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x00, 0x00 )	/*	({)	*/	\
+	GLYPH( 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00 )	/*	|	*/	\
+	GLYPH( 0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x00, 0x00 )	/*	(})	*/	\
+	GLYPH( 0x08, 0x0C, 0x04, 0x0C, 0x08, 0x0C, 0x04, 0x00 )	/*	(~)	*/	\
+	GLYPH( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 )	/*	DEL	*/
+
+//--------------------------------------------------------------------------
+//	Constant: font8x8_extended
+//
+//	Characters outside of ASCII, the list follows the printable
+//	characters (the first one has the index 96). The Unicode codepoints
+//	of these characters are in font_extended_codepoints, in the same
+//	order and sorted ascending, so the glyph of a codepoint is found
+//	with a binary search.
+//	The library handles a character as a one byte glyph code
+//	(0x80 + index), so the list can hold at most 128 characters.
+//
+#define FONT8X8_EXTENDED( GLYPH )	\
+	GLYPH( 0x02, 0x07, 0x05, 0x07, 0x02, 0x00, 0x00, 0x00 )	/*	°	*/	\
+	GLYPH( 0x44, 0x44, 0x5F, 0x5F, 0x44, 0x44, 0x00, 0x00 )	/*	±	*/	\
+	GLYPH( 0x09, 0x0D, 0x0F, 0x0A, 0x00, 0x00, 0x00, 0x00 )	/*	²	*/	\
+	GLYPH( 0x09, 0x0B, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00 )	/*	³	*/	\
+	GLYPH( 0xFC, 0xFC, 0x40, 0x40, 0x7C, 0x7C, 0x00, 0x00 )	/*	µ	*/	\
+	GLYPH( 0x79, 0x7D, 0x14, 0x14, 0x7D, 0x79, 0x00, 0x00 )	/*	Ä	*/	\
+	GLYPH( 0x39, 0x7D, 0x44, 0x44, 0x44, 0x7D, 0x39, 0x00 )	/*	Ö	*/	\
+	GLYPH( 0x7D, 0x7D, 0x40, 0x40, 0x7D, 0x7D, 0x00, 0x00 )	/*	Ü	*/	\
+	GLYPH( 0x7E, 0x7F, 0x01, 0x49, 0x7F, 0x36, 0x00, 0x00 )	/*	ß	*/	\
+	GLYPH( 0x21, 0x75, 0x54, 0x54, 0x3D, 0x79, 0x40, 0x00 )	/*	ä	*/	\
+	GLYPH( 0x39, 0x7D, 0x44, 0x44, 0x7D, 0x39, 0x00, 0x00 )	/*	ö	*/	\
+	GLYPH( 0x3D, 0x7D, 0x40, 0x40, 0x3D, 0x7D, 0x40, 0x00 )	/*	ü	*/	\
+	GLYPH( 0x4C, 0x5E, 0x73, 0x01, 0x73, 0x5E, 0x4C, 0x00 )	/*	Ω	*/	\
+	GLYPH( 0x14, 0x3E, 0x7F, 0x55, 0x41, 0x63, 0x22, 0x00 )	/*	€	*/
+
+const uint16_t font_extended_codepoints[] =
+{
+	0x00B0,	0x00B1,	0x00B2,	0x00B3,	0x00B5,	0x00C4,	0x00D6,	0x00DC,
+	0x00DF,	0x00E4,	0x00F6,	0x00FC,	0x03A9,	0x20AC
+};
+
+#define FONT_EXTENDED_CHARS		(sizeof( font_extended_codepoints ) / sizeof( font_extended_codepoints[ 0 ] ))
+
+#define FONT8X8_BYTES( c0, c1, c2, c3, c4, c5, c6, c7 )	c0, c1, c2, c3, c4, c5, c6, c7,
+
+const unsigned char font8x8_simple[] =
 {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,		//	space
-	0x00, 0x00, 0x06, 0x5F, 0x5F, 0x06, 0x00, 0x00,		//	!
-	0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00,		//	"
-	0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x00,		//	#
-	0x24, 0x2E, 0x6B, 0x6B, 0x3A, 0x12, 0x00, 0x00,		//	$
-	0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x00,		//	%
-	0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48, 0x00,		//	&
-	0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,		//	'
-	0x00, 0x1C, 0x3E, 0x63, 0x41, 0x00, 0x00, 0x00,		//	(
-	0x00, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x00, 0x00,		//	)
-	0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08,		//	*
-	0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x00, 0x00,		//	+
-	0x00, 0x80, 0xE0, 0x60, 0x00, 0x00, 0x00, 0x00,		//	,
-	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,		//	-
-	0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,		//	.
-	0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00,		//	/
-	0x3E, 0x7F, 0x71, 0x59, 0x4D, 0x7F, 0x3E, 0x00,		//	0
-	0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x00, 0x00,		//	1
-	0x62, 0x73, 0x59, 0x49, 0x6F, 0x26, 0x00, 0x00,		//	2
-	0x22, 0x63, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x00,		//	3
-	0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50, 0x00,		//	4
-	0x27, 0x67, 0x45, 0x45, 0x7D, 0x39, 0x00, 0x00,		//	5
-	0x3C, 0x7E, 0x4B, 0x49, 0x79, 0x30, 0x00, 0x00,		//	6
-	0x03, 0x03, 0x71, 0x79, 0x0F, 0x07, 0x00, 0x00,		//	7
-	0x36, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x00,		//	8
-	0x06, 0x4F, 0x49, 0x69, 0x3F, 0x1E, 0x00, 0x00,		//	9
-	0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,		//	:
-	0x00, 0x80, 0xE6, 0x66, 0x00, 0x00, 0x00, 0x00,		//	;
-	0x00, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x00, 0x00,		//	<
-	0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00,		//	=
-	0x00, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x00, 0x00,		//	>
-	0x02, 0x03, 0x51, 0x59, 0x0F, 0x06, 0x00, 0x00,		//	?
-	0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x1F, 0x1E, 0x00,		//	@
-	0x7C, 0x7E, 0x13, 0x13, 0x7E, 0x7C, 0x00, 0x00,		//	A
-	0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00,		//	B
-	0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00,		//	C
-	0x41, 0x7F, 0x7F, 0x41, 0x63, 0x7E, 0x1C, 0x00,		//	D
-	0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00,		//	E
-	0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03, 0x00,		//	F
-	0x1C, 0x3E, 0x63, 0x41, 0x51, 0x73, 0x72, 0x00,		//	G
-	0x7F, 0x7F, 0x08, 0x08, 0x7F, 0x7F, 0x00, 0x00,		//	H
-	0x00, 0x41, 0x7F, 0x7F, 0x41, 0x00, 0x00, 0x00,		//	I
-	0x30, 0x70, 0x41, 0x4F, 0x7F, 0x31, 0x00, 0x00,		//	J
-	0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63, 0x00,		//	K
-	0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70, 0x00,		//	L
-	0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x00,		//	M
-	0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F, 0x00,		//	N
-	0x1C, 0x3E, 0x63, 0x41, 0x63, 0x3E, 0x1C, 0x00,		//	O
-	0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06, 0x00,		//	P
-	0x1E, 0x3F, 0x21, 0x71, 0x7F, 0x5E, 0x00, 0x00,		//	Q
-	0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66, 0x00,		//	R
-	0x26, 0x6F, 0x4D, 0x59, 0x73, 0x32, 0x00, 0x00,		//	S
-	0x03, 0x41, 0x7F, 0x7F, 0x41, 0x03, 0x00, 0x00,		//	T
-	0x7F, 0x7F, 0x40, 0x40, 0x7F, 0x7F, 0x00, 0x00,		//	U
-	0x1F, 0x3F, 0x60, 0x60, 0x3F, 0x1F, 0x00, 0x00,		//	V
-	0x7F, 0x7F, 0x30, 0x18, 0x30, 0x7F, 0x7F, 0x00,		//	W
-	0x43, 0x67, 0x3C, 0x18, 0x3C, 0x67, 0x43, 0x00,		//	X
-	0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07, 0x00, 0x00,		//	Y
-	0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73, 0x00,		//	Z
-	0x00, 0x7F, 0x7F, 0x41, 0x41, 0x00, 0x00, 0x00,		//	[
-	0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00,		//	(\)
-	0x00, 0x41, 0x41, 0x7F, 0x7F, 0x00, 0x00, 0x00,		//	]
-	0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08, 0x00,		//	^
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,		//	_
-	0x00, 0x00, 0x03, 0x07, 0x04, 0x00, 0x00, 0x00,		//	`
-	0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40, 0x00,		//	a
-	0x41, 0x7F, 0x3F, 0x48, 0x48, 0x78, 0x30, 0x00,		//	b
-	0x38, 0x7C, 0x44, 0x44, 0x6C, 0x28, 0x00, 0x00,		//	c
-	0x30, 0x78, 0x48, 0x49, 0x3F, 0x7F, 0x40, 0x00,		//	d
-	0x38, 0x7C, 0x54, 0x54, 0x5C, 0x18, 0x00, 0x00,		//	e
-	0x48, 0x7E, 0x7F, 0x49, 0x03, 0x02, 0x00, 0x00,		//	f
-	0x98, 0xBC, 0xA4, 0xA4, 0xF8, 0x7C, 0x04, 0x00,		//	g
-	0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78, 0x00,		//	h
-	0x00, 0x44, 0x7D, 0x7D, 0x40, 0x00, 0x00, 0x00,		//	i
-	0x60, 0xE0, 0x80, 0x80, 0xFD, 0x7D, 0x00, 0x00,		//	j
-	0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44, 0x00,		//	k
-	0x00, 0x41, 0x7F, 0x7F, 0x40, 0x00, 0x00, 0x00,		//	l
-	0x7C, 0x7C, 0x18, 0x38, 0x1C, 0x7C, 0x78, 0x00,		//	m
-	0x7C, 0x7C, 0x04, 0x04, 0x7C, 0x78, 0x00, 0x00,		//	n
-	0x38, 0x7C, 0x44, 0x44, 0x7C, 0x38, 0x00, 0x00,		//	o
-	0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18, 0x00,		//	p
-	0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84, 0x00,		//	q
-	0x44, 0x7C, 0x78, 0x4C, 0x04, 0x1C, 0x18, 0x00,		//	r
-	0x48, 0x5C, 0x54, 0x54, 0x74, 0x24, 0x00, 0x00,		//	s
-	0x00, 0x04, 0x3E, 0x7F, 0x44, 0x24, 0x00, 0x00,		//	t
-	0x3C, 0x7C, 0x40, 0x40, 0x3C, 0x7C, 0x40, 0x00,		//	u
-	0x1C, 0x3C, 0x60, 0x60, 0x3C, 0x1C, 0x00, 0x00,		//	v
-	0x3C, 0x7C, 0x70, 0x38, 0x70, 0x7C, 0x3C, 0x00,		//	w
-	0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x00,		//	x
-	0x1C, 0xBC, 0xE0, 0xE0, 0x3C, 0x1C, 0x00, 0x00,		//	y
-	0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64, 0x00, 0x00,		//	z
-	0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x00, 0x00,		//	({)
-	0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00,		//	|
-	0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x00, 0x00,		//	(})
-	0x08, 0x0C, 0x04, 0x0C, 0x08, 0x0C, 0x04, 0x00,		//	(~)
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00		//
+	FONT8X8_SIMPLE( FONT8X8_BYTES )
+	FONT8X8_EXTENDED( FONT8X8_BYTES )
 };
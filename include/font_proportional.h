@@ -0,0 +1,388 @@
+//##########################################################################
+//#
+//#		Proportional fonts for rendering
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	Font5x7:	the classic 5x7 dot matrix font (public domain), the empty
+//#				columns at the left and right of every glyph are removed.
+//#				Raw columns, 7 rows, about 24 characters on 128 pixels.
+//#	Font3x5:	a small font with 5 rows for capitals and digits, the
+//#				lowercase letters have one row for descenders. The columns
+//#				are packed with 6 bits each (OLED_FONT_PACKED), about 33
+//#				characters on 128 pixels.
+//#
+//#	Both fonts have the characters 0x20 (space) up to 0x7E (~) followed
+//#	by the extended characters of font_extended_codepoints (see font.h)
+//#	in the same order. Every glyph is followed by one empty column
+//#	(advance = width + 1).
+//#	Bit 0 of a column is the top row of the glyph.
+//#
+//#	Generated from the bitmaps, do not edit the column data by hand.
+//#
+//##########################################################################
+
+const uint8_t	g_arusFont5x7Columns[ 486 ] =
+	{
+		0x00, 0x00,								//	' '
+		0x5F,									//	'!'
+		0x07, 0x00, 0x07,						//	'"'
+		0x14, 0x7F, 0x14, 0x7F, 0x14,			//	'#'
+		0x24, 0x2A, 0x7F, 0x2A, 0x12,			//	'$'
+		0x23, 0x13, 0x08, 0x64, 0x62,			//	'%'
+		0x36, 0x49, 0x55, 0x22, 0x50,			//	'&'
+		0x05, 0x03,								//	'\''
+		0x1C, 0x22, 0x41,						//	'('
+		0x41, 0x22, 0x1C,						//	')'
+		0x08, 0x2A, 0x1C, 0x2A, 0x08,			//	'*'
+		0x08, 0x08, 0x3E, 0x08, 0x08,			//	'+'
+		0x50, 0x30,								//	','
+		0x08, 0x08, 0x08, 0x08, 0x08,			//	'-'
+		0x60, 0x60,								//	'.'
+		0x20, 0x10, 0x08, 0x04, 0x02,			//	'/'
+		0x3E, 0x51, 0x49, 0x45, 0x3E,			//	'0'
+		0x42, 0x7F, 0x40,						//	'1'
+		0x42, 0x61, 0x51, 0x49, 0x46,			//	'2'
+		0x21, 0x41, 0x45, 0x4B, 0x31,			//	'3'
+		0x18, 0x14, 0x12, 0x7F, 0x10,			//	'4'
+		0x27, 0x45, 0x45, 0x45, 0x39,			//	'5'
+		0x3C, 0x4A, 0x49, 0x49, 0x30,			//	'6'
+		0x01, 0x71, 0x09, 0x05, 0x03,			//	'7'
+		0x36, 0x49, 0x49, 0x49, 0x36,			//	'8'
+		0x06, 0x49, 0x49, 0x29, 0x1E,			//	'9'
+		0x36, 0x36,								//	':'
+		0x56, 0x36,								//	';'
+		0x08, 0x14, 0x22, 0x41,					//	'<'
+		0x14, 0x14, 0x14, 0x14, 0x14,			//	'='
+		0x41, 0x22, 0x14, 0x08,					//	'>'
+		0x02, 0x01, 0x51, 0x09, 0x06,			//	'?'
+		0x32, 0x49, 0x79, 0x41, 0x3E,			//	'@'
+		0x7E, 0x11, 0x11, 0x11, 0x7E,			//	'A'
+		0x7F, 0x49, 0x49, 0x49, 0x36,			//	'B'
+		0x3E, 0x41, 0x41, 0x41, 0x22,			//	'C'
+		0x7F, 0x41, 0x41, 0x22, 0x1C,			//	'D'
+		0x7F, 0x49, 0x49, 0x49, 0x41,			//	'E'
+		0x7F, 0x09, 0x09, 0x09, 0x01,			//	'F'
+		0x3E, 0x41, 0x49, 0x49, 0x7A,			//	'G'
+		0x7F, 0x08, 0x08, 0x08, 0x7F,			//	'H'
+		0x41, 0x7F, 0x41,						//	'I'
+		0x20, 0x40, 0x41, 0x3F, 0x01,			//	'J'
+		0x7F, 0x08, 0x14, 0x22, 0x41,			//	'K'
+		0x7F, 0x40, 0x40, 0x40, 0x40,			//	'L'
+		0x7F, 0x02, 0x0C, 0x02, 0x7F,			//	'M'
+		0x7F, 0x04, 0x08, 0x10, 0x7F,			//	'N'
+		0x3E, 0x41, 0x41, 0x41, 0x3E,			//	'O'
+		0x7F, 0x09, 0x09, 0x09, 0x06,			//	'P'
+		0x3E, 0x41, 0x51, 0x21, 0x5E,			//	'Q'
+		0x7F, 0x09, 0x19, 0x29, 0x46,			//	'R'
+		0x46, 0x49, 0x49, 0x49, 0x31,			//	'S'
+		0x01, 0x01, 0x7F, 0x01, 0x01,			//	'T'
+		0x3F, 0x40, 0x40, 0x40, 0x3F,			//	'U'
+		0x1F, 0x20, 0x40, 0x20, 0x1F,			//	'V'
+		0x3F, 0x40, 0x38, 0x40, 0x3F,			//	'W'
+		0x63, 0x14, 0x08, 0x14, 0x63,			//	'X'
+		0x07, 0x08, 0x70, 0x08, 0x07,			//	'Y'
+		0x61, 0x51, 0x49, 0x45, 0x43,			//	'Z'
+		0x7F, 0x41, 0x41,						//	'['
+		0x02, 0x04, 0x08, 0x10, 0x20,			//	'\\'
+		0x41, 0x41, 0x7F,						//	']'
+		0x04, 0x02, 0x01, 0x02, 0x04,			//	'^'
+		0x40, 0x40, 0x40, 0x40, 0x40,			//	'_'
+		0x01, 0x02, 0x04,						//	'`'
+		0x20, 0x54, 0x54, 0x54, 0x78,			//	'a'
+		0x7F, 0x48, 0x44, 0x44, 0x38,			//	'b'
+		0x38, 0x44, 0x44, 0x44, 0x20,			//	'c'
+		0x38, 0x44, 0x44, 0x48, 0x7F,			//	'd'
+		0x38, 0x54, 0x54, 0x54, 0x18,			//	'e'
+		0x08, 0x7E, 0x09, 0x01, 0x02,			//	'f'
+		0x0C, 0x52, 0x52, 0x52, 0x3E,			//	'g'
+		0x7F, 0x08, 0x04, 0x04, 0x78,			//	'h'
+		0x44, 0x7D, 0x40,						//	'i'
+		0x20, 0x40, 0x44, 0x3D,					//	'j'
+		0x7F, 0x10, 0x28, 0x44,					//	'k'
+		0x41, 0x7F, 0x40,						//	'l'
+		0x7C, 0x04, 0x18, 0x04, 0x78,			//	'm'
+		0x7C, 0x08, 0x04, 0x04, 0x78,			//	'n'
+		0x38, 0x44, 0x44, 0x44, 0x38,			//	'o'
+		0x7C, 0x14, 0x14, 0x14, 0x08,			//	'p'
+		0x08, 0x14, 0x14, 0x18, 0x7C,			//	'q'
+		0x7C, 0x08, 0x04, 0x04, 0x08,			//	'r'
+		0x48, 0x54, 0x54, 0x54, 0x20,			//	's'
+		0x04, 0x3F, 0x44, 0x40, 0x20,			//	't'
+		0x3C, 0x40, 0x40, 0x20, 0x7C,			//	'u'
+		0x1C, 0x20, 0x40, 0x20, 0x1C,			//	'v'
+		0x3C, 0x40, 0x30, 0x40, 0x3C,			//	'w'
+		0x44, 0x28, 0x10, 0x28, 0x44,			//	'x'
+		0x0C, 0x50, 0x50, 0x50, 0x3C,			//	'y'
+		0x44, 0x64, 0x54, 0x4C, 0x44,			//	'z'
+		0x08, 0x36, 0x41,						//	'{'
+		0x7F,									//	'|'
+		0x41, 0x36, 0x08,						//	'}'
+		0x02, 0x01, 0x02, 0x04, 0x02,			//	'~'
+		0x06, 0x09, 0x09, 0x06,					//	'°'
+		0x44, 0x44, 0x5F, 0x44, 0x44,			//	'±'
+		0x09, 0x0D, 0x0A,						//	'²'
+		0x09, 0x0B, 0x06,						//	'³'
+		0x7E, 0x20, 0x20, 0x10, 0x3E,			//	'µ'
+		0x79, 0x14, 0x12, 0x14, 0x79,			//	'Ä'
+		0x3D, 0x42, 0x42, 0x42, 0x3D,			//	'Ö'
+		0x3D, 0x40, 0x40, 0x40, 0x3D,			//	'Ü'
+		0x7E, 0x01, 0x49, 0x56, 0x20,			//	'ß'
+		0x20, 0x55, 0x54, 0x55, 0x78,			//	'ä'
+		0x38, 0x45, 0x44, 0x45, 0x38,			//	'ö'
+		0x3C, 0x41, 0x40, 0x21, 0x7C,			//	'ü'
+		0x4E, 0x71, 0x01, 0x71, 0x4E,			//	'Ω'
+		0x14, 0x3E, 0x55, 0x55, 0x41			//	'€'
+	};
+
+const oled_glyph_t	g_arFont5x7Glyphs[ 109 ] =
+	{
+		{    0, 2, 3 },						//	' '
+		{    2, 1, 2 },						//	'!'
+		{    3, 3, 4 },						//	'"'
+		{    6, 5, 6 },						//	'#'
+		{   11, 5, 6 },						//	'$'
+		{   16, 5, 6 },						//	'%'
+		{   21, 5, 6 },						//	'&'
+		{   26, 2, 3 },						//	'\''
+		{   28, 3, 4 },						//	'('
+		{   31, 3, 4 },						//	')'
+		{   34, 5, 6 },						//	'*'
+		{   39, 5, 6 },						//	'+'
+		{   44, 2, 3 },						//	','
+		{   46, 5, 6 },						//	'-'
+		{   51, 2, 3 },						//	'.'
+		{   53, 5, 6 },						//	'/'
+		{   58, 5, 6 },						//	'0'
+		{   63, 3, 4 },						//	'1'
+		{   66, 5, 6 },						//	'2'
+		{   71, 5, 6 },						//	'3'
+		{   76, 5, 6 },						//	'4'
+		{   81, 5, 6 },						//	'5'
+		{   86, 5, 6 },						//	'6'
+		{   91, 5, 6 },						//	'7'
+		{   96, 5, 6 },						//	'8'
+		{  101, 5, 6 },						//	'9'
+		{  106, 2, 3 },						//	':'
+		{  108, 2, 3 },						//	';'
+		{  110, 4, 5 },						//	'<'
+		{  114, 5, 6 },						//	'='
+		{  119, 4, 5 },						//	'>'
+		{  123, 5, 6 },						//	'?'
+		{  128, 5, 6 },						//	'@'
+		{  133, 5, 6 },						//	'A'
+		{  138, 5, 6 },						//	'B'
+		{  143, 5, 6 },						//	'C'
+		{  148, 5, 6 },						//	'D'
+		{  153, 5, 6 },						//	'E'
+		{  158, 5, 6 },						//	'F'
+		{  163, 5, 6 },						//	'G'
+		{  168, 5, 6 },						//	'H'
+		{  173, 3, 4 },						//	'I'
+		{  176, 5, 6 },						//	'J'
+		{  181, 5, 6 },						//	'K'
+		{  186, 5, 6 },						//	'L'
+		{  191, 5, 6 },						//	'M'
+		{  196, 5, 6 },						//	'N'
+		{  201, 5, 6 },						//	'O'
+		{  206, 5, 6 },						//	'P'
+		{  211, 5, 6 },						//	'Q'
+		{  216, 5, 6 },						//	'R'
+		{  221, 5, 6 },						//	'S'
+		{  226, 5, 6 },						//	'T'
+		{  231, 5, 6 },						//	'U'
+		{  236, 5, 6 },						//	'V'
+		{  241, 5, 6 },						//	'W'
+		{  246, 5, 6 },						//	'X'
+		{  251, 5, 6 },						//	'Y'
+		{  256, 5, 6 },						//	'Z'
+		{  261, 3, 4 },						//	'['
+		{  264, 5, 6 },						//	'\\'
+		{  269, 3, 4 },						//	']'
+		{  272, 5, 6 },						//	'^'
+		{  277, 5, 6 },						//	'_'
+		{  282, 3, 4 },						//	'`'
+		{  285, 5, 6 },						//	'a'
+		{  290, 5, 6 },						//	'b'
+		{  295, 5, 6 },						//	'c'
+		{  300, 5, 6 },						//	'd'
+		{  305, 5, 6 },						//	'e'
+		{  310, 5, 6 },						//	'f'
+		{  315, 5, 6 },						//	'g'
+		{  320, 5, 6 },						//	'h'
+		{  325, 3, 4 },						//	'i'
+		{  328, 4, 5 },						//	'j'
+		{  332, 4, 5 },						//	'k'
+		{  336, 3, 4 },						//	'l'
+		{  339, 5, 6 },						//	'm'
+		{  344, 5, 6 },						//	'n'
+		{  349, 5, 6 },						//	'o'
+		{  354, 5, 6 },						//	'p'
+		{  359, 5, 6 },						//	'q'
+		{  364, 5, 6 },						//	'r'
+		{  369, 5, 6 },						//	's'
+		{  374, 5, 6 },						//	't'
+		{  379, 5, 6 },						//	'u'
+		{  384, 5, 6 },						//	'v'
+		{  389, 5, 6 },						//	'w'
+		{  394, 5, 6 },						//	'x'
+		{  399, 5, 6 },						//	'y'
+		{  404, 5, 6 },						//	'z'
+		{  409, 3, 4 },						//	'{'
+		{  412, 1, 2 },						//	'|'
+		{  413, 3, 4 },						//	'}'
+		{  416, 5, 6 },						//	'~'
+		{  421, 4, 5 },						//	'°'
+		{  425, 5, 6 },						//	'±'
+		{  430, 3, 4 },						//	'²'
+		{  433, 3, 4 },						//	'³'
+		{  436, 5, 6 },						//	'µ'
+		{  441, 5, 6 },						//	'Ä'
+		{  446, 5, 6 },						//	'Ö'
+		{  451, 5, 6 },						//	'Ü'
+		{  456, 5, 6 },						//	'ß'
+		{  461, 5, 6 },						//	'ä'
+		{  466, 5, 6 },						//	'ö'
+		{  471, 5, 6 },						//	'ü'
+		{  476, 5, 6 },						//	'Ω'
+		{  481, 5, 6 }						//	'€'
+	};
+
+
+const uint8_t	g_arusFont3x5Columns[ 241 ] =
+	{
+		0x00, 0x70, 0x0D, 0xC0, 0xA0, 0x7C, 0xCA, 0xA7, 0x58, 0x5F, 0x93, 0x11,
+		0x93, 0x52, 0x29, 0xD0, 0xE0, 0x44, 0x91, 0xA3, 0x10, 0x0A, 0xE1, 0x10,
+		0x20, 0x44, 0x10, 0x04, 0x84, 0x11, 0xC3, 0x17, 0x7D, 0xD2, 0x07, 0x65,
+		0x95, 0x14, 0x55, 0xCA, 0x41, 0x7C, 0x57, 0x95, 0x78, 0x55, 0x17, 0x64,
+		0xC7, 0x57, 0x7D, 0x57, 0xF5, 0x28, 0x90, 0x42, 0x28, 0x91, 0xA2, 0x28,
+		0x91, 0x42, 0x04, 0x95, 0xE0, 0x44, 0x97, 0xE1, 0x15, 0xDE, 0x57, 0x29,
+		0x4E, 0x14, 0x7D, 0x91, 0xF3, 0x55, 0xD1, 0x57, 0x04, 0x4E, 0xD4, 0x7D,
+		0xC4, 0x17, 0x7D, 0x11, 0x02, 0x3D, 0x1F, 0xB1, 0x7D, 0x10, 0xF4, 0x09,
+		0x84, 0xF0, 0x7D, 0x02, 0xF1, 0x39, 0x91, 0xF3, 0x15, 0x82, 0x93, 0x59,
+		0x5F, 0xA1, 0x49, 0x55, 0x12, 0x7C, 0xC1, 0x07, 0x7D, 0x0F, 0xF4, 0x7C,
+		0x08, 0x81, 0x7C, 0x1B, 0xB1, 0x0D, 0xDC, 0x90, 0x55, 0xD3, 0x17, 0x0D,
+		0x04, 0x16, 0x7D, 0x42, 0x20, 0x80, 0x20, 0x18, 0x08, 0x9A, 0xC5, 0x7D,
+		0x14, 0xC2, 0x48, 0x12, 0x42, 0x7D, 0x8C, 0x66, 0x11, 0x5E, 0xC1, 0xAA,
+		0xDE, 0x47, 0x60, 0x1D, 0xD8, 0x7D, 0x8C, 0xF4, 0x79, 0x02, 0x27, 0x70,
+		0x9E, 0xC0, 0x31, 0x12, 0xE3, 0x4B, 0x0C, 0x23, 0xF9, 0x9C, 0x20, 0x50,
+		0x92, 0x22, 0x7C, 0x92, 0x03, 0x79, 0x0E, 0xE4, 0x38, 0x10, 0x02, 0x39,
+		0x12, 0x23, 0x99, 0xA8, 0xA7, 0x59, 0x12, 0xF1, 0x45, 0x5F, 0xF4, 0x11,
+		0x84, 0x40, 0x08, 0x42, 0x21, 0x48, 0x97, 0xD4, 0x2C, 0xCD, 0xE3, 0x43,
+		0x5E, 0xA7, 0x74, 0x8D, 0xD4, 0x74, 0x50, 0xF7, 0x57, 0x4A, 0x42, 0x75,
+		0x09, 0x95, 0x34, 0x50, 0x67, 0x65, 0x41, 0x66, 0x11, 0x4E, 0x55, 0x01,
+		0x00
+	};
+
+const oled_glyph_t	g_arFont3x5Glyphs[ 109 ] =
+	{
+		{    0, 2, 3 },						//	' '
+		{    2, 1, 2 },						//	'!'
+		{    3, 3, 4 },						//	'"'
+		{    6, 5, 6 },						//	'#'
+		{   11, 3, 4 },						//	'$'
+		{   14, 3, 4 },						//	'%'
+		{   17, 4, 5 },						//	'&'
+		{   21, 1, 2 },						//	'\''
+		{   22, 2, 3 },						//	'('
+		{   24, 2, 3 },						//	')'
+		{   26, 3, 4 },						//	'*'
+		{   29, 3, 4 },						//	'+'
+		{   32, 2, 3 },						//	','
+		{   34, 3, 4 },						//	'-'
+		{   37, 1, 2 },						//	'.'
+		{   38, 3, 4 },						//	'/'
+		{   41, 3, 4 },						//	'0'
+		{   44, 3, 4 },						//	'1'
+		{   47, 3, 4 },						//	'2'
+		{   50, 3, 4 },						//	'3'
+		{   53, 3, 4 },						//	'4'
+		{   56, 3, 4 },						//	'5'
+		{   59, 3, 4 },						//	'6'
+		{   62, 3, 4 },						//	'7'
+		{   65, 3, 4 },						//	'8'
+		{   68, 3, 4 },						//	'9'
+		{   71, 1, 2 },						//	':'
+		{   72, 2, 3 },						//	';'
+		{   74, 3, 4 },						//	'<'
+		{   77, 3, 4 },						//	'='
+		{   80, 3, 4 },						//	'>'
+		{   83, 3, 4 },						//	'?'
+		{   86, 4, 5 },						//	'@'
+		{   90, 3, 4 },						//	'A'
+		{   93, 3, 4 },						//	'B'
+		{   96, 3, 4 },						//	'C'
+		{   99, 3, 4 },						//	'D'
+		{  102, 3, 4 },						//	'E'
+		{  105, 3, 4 },						//	'F'
+		{  108, 3, 4 },						//	'G'
+		{  111, 3, 4 },						//	'H'
+		{  114, 3, 4 },						//	'I'
+		{  117, 3, 4 },						//	'J'
+		{  120, 3, 4 },						//	'K'
+		{  123, 3, 4 },						//	'L'
+		{  126, 5, 6 },						//	'M'
+		{  131, 4, 5 },						//	'N'
+		{  135, 3, 4 },						//	'O'
+		{  138, 3, 4 },						//	'P'
+		{  141, 3, 4 },						//	'Q'
+		{  144, 3, 4 },						//	'R'
+		{  147, 3, 4 },						//	'S'
+		{  150, 3, 4 },						//	'T'
+		{  153, 3, 4 },						//	'U'
+		{  156, 3, 4 },						//	'V'
+		{  159, 5, 6 },						//	'W'
+		{  164, 3, 4 },						//	'X'
+		{  167, 3, 4 },						//	'Y'
+		{  170, 3, 4 },						//	'Z'
+		{  173, 2, 3 },						//	'['
+		{  175, 3, 4 },						//	'\\'
+		{  178, 2, 3 },						//	']'
+		{  180, 3, 4 },						//	'^'
+		{  183, 3, 4 },						//	'_'
+		{  186, 2, 3 },						//	'`'
+		{  188, 3, 4 },						//	'a'
+		{  191, 3, 4 },						//	'b'
+		{  194, 3, 4 },						//	'c'
+		{  197, 3, 4 },						//	'd'
+		{  200, 3, 4 },						//	'e'
+		{  203, 3, 4 },						//	'f'
+		{  206, 3, 4 },						//	'g'
+		{  209, 3, 4 },						//	'h'
+		{  212, 1, 2 },						//	'i'
+		{  213, 2, 3 },						//	'j'
+		{  215, 3, 4 },						//	'k'
+		{  218, 1, 2 },						//	'l'
+		{  219, 5, 6 },						//	'm'
+		{  224, 3, 4 },						//	'n'
+		{  227, 3, 4 },						//	'o'
+		{  230, 3, 4 },						//	'p'
+		{  233, 3, 4 },						//	'q'
+		{  236, 3, 4 },						//	'r'
+		{  239, 3, 4 },						//	's'
+		{  242, 3, 4 },						//	't'
+		{  245, 3, 4 },						//	'u'
+		{  248, 3, 4 },						//	'v'
+		{  251, 5, 6 },						//	'w'
+		{  256, 3, 4 },						//	'x'
+		{  259, 3, 4 },						//	'y'
+		{  262, 3, 4 },						//	'z'
+		{  265, 3, 4 },						//	'{'
+		{  268, 1, 2 },						//	'|'
+		{  269, 3, 4 },						//	'}'
+		{  272, 4, 5 },						//	'~'
+		{  276, 3, 4 },						//	'°'
+		{  279, 3, 4 },						//	'±'
+		{  282, 2, 3 },						//	'²'
+		{  284, 2, 3 },						//	'³'
+		{  286, 3, 4 },						//	'µ'
+		{  289, 3, 4 },						//	'Ä'
+		{  292, 3, 4 },						//	'Ö'
+		{  295, 3, 4 },						//	'Ü'
+		{  298, 3, 4 },						//	'ß'
+		{  301, 3, 4 },						//	'ä'
+		{  304, 3, 4 },						//	'ö'
+		{  307, 3, 4 },						//	'ü'
+		{  310, 5, 6 },						//	'Ω'
+		{  315, 4, 5 }						//	'€'
+	};
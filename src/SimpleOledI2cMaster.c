@@ -0,0 +1,400 @@
+//##########################################################################
+//#
+//#		SimpleOledI2cMaster.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	I²C transport for the SimpleOledLib with the bus / device driver
+//#	(see SimpleOledI2cMaster.h).
+//#
+//#	Every transaction is copied into one of OLED_I2C_QUEUE_DEPTH buffers
+//#	and handed over to the driver. A counting semaphore holds the number
+//#	of free buffers, it is given back by the callback of the driver when
+//#	a transaction is done. The transactions of one bus are done in the
+//#	order they were queued, so the oldest buffer is free first.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <string.h>
+
+#include "SimpleOledI2cMaster.h"
+
+#if OLED_I2C_MASTER
+
+#include <esp_attr.h>
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define I2C_MASTER_TIMEOUT_MS			50
+#define I2C_MASTER_TIMEOUT_TICKS		(I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS)
+
+#define PREFIX_DATA						0x40
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+bool _oled_i2c_master_done( i2c_master_dev_handle_t device, const i2c_master_event_data_t *pEventData, void *pArg );
+esp_err_t _oled_i2c_master_device( oled_i2c_master_t *pI2c, uint8_t address );
+uint8_t *_oled_i2c_master_slot( oled_i2c_master_t *pI2c );
+esp_err_t _oled_i2c_master_send( oled_i2c_master_t *pI2c, size_t length );
+
+esp_err_t _oled_i2c_master_probe( void *pContext, uint8_t address );
+esp_err_t _oled_i2c_master_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length );
+esp_err_t _oled_i2c_master_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length );
+
+
+//==========================================================================
+//
+//		T R A N S P O R T S
+//
+//==========================================================================
+
+const oled_transport_t	g_oledI2cMasterTransport =
+	{
+		.probe		= _oled_i2c_master_probe,
+		.write		= _oled_i2c_master_write,
+		.write_data	= _oled_i2c_master_write_data
+	};
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	oled_i2c_master_init
+//--------------------------------------------------------------------------
+//	Prepare the connection of a display on the given bus (created with
+//	i2c_new_master_bus). For queued transactions the bus needs a
+//	trans_queue_depth of at least OLED_I2C_QUEUE_DEPTH.
+//	With clockHz 0 the display is clocked with OLED_I2C_CLOCK_DEFAULT.
+//
+esp_err_t oled_i2c_master_init( oled_i2c_master_t *pI2c, i2c_master_bus_handle_t bus, uint32_t clockHz )
+{
+	memset( pI2c, 0, sizeof( oled_i2c_master_t ) );
+
+	pI2c->bus		= bus;
+	pI2c->clockHz	= (0 < clockHz) ? clockHz : OLED_I2C_CLOCK_DEFAULT;
+	pI2c->error		= ESP_OK;
+	pI2c->freeSlots	= xSemaphoreCreateCountingStatic( OLED_I2C_QUEUE_DEPTH, OLED_I2C_QUEUE_DEPTH, &pI2c->freeSlotsBuffer );
+
+	return( (NULL != pI2c->freeSlots) ? ESP_OK : ESP_ERR_NO_MEM );
+}
+
+
+//**************************************************************************
+//	oled_i2c_master_wait
+//--------------------------------------------------------------------------
+//	Wait until all queued transactions of the display are done, e.g.
+//	before the display is switched off or the bus is deleted.
+//	Returns the error of a failed transaction (if any).
+//
+esp_err_t oled_i2c_master_wait( oled_i2c_master_t *pI2c )
+{
+	esp_err_t	result	= ESP_OK;
+	uint8_t		usTaken	= 0;
+
+	while( OLED_I2C_QUEUE_DEPTH > usTaken )
+	{
+		if( pdTRUE != xSemaphoreTake( pI2c->freeSlots, I2C_MASTER_TIMEOUT_TICKS ) )
+		{
+			result = ESP_ERR_TIMEOUT;
+
+			break;
+		}
+
+		usTaken++;
+	}
+
+	while( 0 < usTaken-- )
+	{
+		xSemaphoreGive( pI2c->freeSlots );
+	}
+
+	if( (ESP_OK == result) && (ESP_OK != pI2c->error) )
+	{
+		result		= pI2c->error;
+		pI2c->error	= ESP_OK;
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	oled_display_init_i2c_master
+//--------------------------------------------------------------------------
+//	Same as oled_display_init_panel() for a display on the I²C bus of
+//	the bus / device driver (pI2c must be initialized with
+//	oled_i2c_master_init).
+//
+uint8_t oled_display_init_i2c_master(	oled_display_handle_t	*pHandle,
+										oled_i2c_master_t		*pI2c,
+										chip_type_t				 chipType,
+										uint8_t					 address,
+										const oled_geometry_t	*pGeometry		)
+{
+	return( oled_display_init_panel( pHandle, &g_oledI2cMasterTransport, pI2c, chipType, address, pGeometry ) );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_master_done (local)
+//--------------------------------------------------------------------------
+//	Called by the driver (interrupt) when a queued transaction is done:
+//	its buffer is free again.
+//
+IRAM_ATTR bool _oled_i2c_master_done( i2c_master_dev_handle_t device, const i2c_master_event_data_t *pEventData, void *pArg )
+{
+	oled_i2c_master_t	*pI2c	= (oled_i2c_master_t *)pArg;
+	BaseType_t			 woken	= pdFALSE;
+
+	(void)device;
+
+	if( I2C_EVENT_DONE != pEventData->event )
+	{
+		pI2c->error = ESP_FAIL;
+	}
+
+	xSemaphoreGiveFromISR( pI2c->freeSlots, &woken );
+
+	return( pdTRUE == woken );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_master_device (local)
+//--------------------------------------------------------------------------
+//	Add the device with the given address to the bus (if not already
+//	done). The transactions are only queued if the driver accepts the
+//	callback, i.e. the bus has a transaction queue.
+//
+esp_err_t _oled_i2c_master_device( oled_i2c_master_t *pI2c, uint8_t address )
+{
+	i2c_device_config_t				config;
+	i2c_master_event_callbacks_t	callbacks;
+	esp_err_t						result;
+
+	if( (NULL != pI2c->device) && (address == pI2c->address) )
+	{
+		return( ESP_OK );
+	}
+
+	if( NULL != pI2c->device )
+	{
+		oled_i2c_master_wait( pI2c );
+		i2c_master_bus_rm_device( pI2c->device );
+
+		pI2c->device = NULL;
+	}
+
+	memset( &config, 0, sizeof( config ) );
+
+	config.dev_addr_length	= I2C_ADDR_BIT_LEN_7;
+	config.device_address	= address;
+	config.scl_speed_hz		= pI2c->clockHz;
+
+	result = i2c_master_bus_add_device( pI2c->bus, &config, &pI2c->device );
+
+	if( ESP_OK != result )
+	{
+		pI2c->device = NULL;
+
+		return( result );
+	}
+
+	memset( &callbacks, 0, sizeof( callbacks ) );
+
+	callbacks.on_trans_done = _oled_i2c_master_done;
+
+	pI2c->address	= address;
+	pI2c->async		= (ESP_OK == i2c_master_register_event_callbacks( pI2c->device, &callbacks, pI2c ));
+
+	return( ESP_OK );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_master_slot (local)
+//--------------------------------------------------------------------------
+//	Wait for a free buffer and return it (NULL: time out).
+//
+uint8_t *_oled_i2c_master_slot( oled_i2c_master_t *pI2c )
+{
+	if( pdTRUE != xSemaphoreTake( pI2c->freeSlots, I2C_MASTER_TIMEOUT_TICKS ) )
+	{
+		return( NULL );
+	}
+
+	return( pI2c->arBuffer[ pI2c->next ] );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_master_send (local)
+//--------------------------------------------------------------------------
+//	Hand over the buffer taken by _oled_i2c_master_slot() to the driver.
+//	Without a transaction queue it is free again at once.
+//	A buffer the driver did not accept is used for the next transaction,
+//	the following ones can still be on the wire.
+//
+esp_err_t _oled_i2c_master_send( oled_i2c_master_t *pI2c, size_t length )
+{
+	esp_err_t	result;
+
+	result = i2c_master_transmit( pI2c->device, pI2c->arBuffer[ pI2c->next ], length, I2C_MASTER_TIMEOUT_MS );
+
+	if( ESP_OK == result )
+	{
+		pI2c->next = (pI2c->next + 1) % OLED_I2C_QUEUE_DEPTH;
+	}
+
+	if( !pI2c->async || (ESP_OK != result) )
+	{
+		xSemaphoreGive( pI2c->freeSlots );
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_master_probe (local)
+//--------------------------------------------------------------------------
+//	I²C master transport: send only the address byte and report if the
+//	device has acknowledged it.
+//
+esp_err_t _oled_i2c_master_probe( void *pContext, uint8_t address )
+{
+	oled_i2c_master_t	*pI2c = (oled_i2c_master_t *)pContext;
+
+	return( i2c_master_probe( pI2c->bus, address, I2C_MASTER_TIMEOUT_MS ) );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_master_write (local)
+//--------------------------------------------------------------------------
+//	I²C master transport: send the buffer as one transaction.
+//	A buffer that does not fit into a chunk is send directly and the
+//	transport waits for it.
+//
+esp_err_t _oled_i2c_master_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	oled_i2c_master_t	*pI2c		= (oled_i2c_master_t *)pContext;
+	esp_err_t			 result		= pI2c->error;
+	uint8_t				*pSlot;
+
+	if( ESP_OK != result )
+	{
+		pI2c->error = ESP_OK;
+
+		return( result );
+	}
+
+	result = _oled_i2c_master_device( pI2c, address );
+
+	if( ESP_OK != result )
+	{
+		return( result );
+	}
+
+	if( OLED_I2C_CHUNK_SIZE < length )
+	{
+		result = i2c_master_transmit( pI2c->device, pBuffer, length, I2C_MASTER_TIMEOUT_MS );
+
+		if( (ESP_OK == result) && pI2c->async )
+		{
+			result = i2c_master_bus_wait_all_done( pI2c->bus, I2C_MASTER_TIMEOUT_MS );
+		}
+
+		return( result );
+	}
+
+	pSlot = _oled_i2c_master_slot( pI2c );
+
+	if( NULL == pSlot )
+	{
+		return( ESP_ERR_TIMEOUT );
+	}
+
+	memcpy( pSlot, pBuffer, length );
+
+	return( _oled_i2c_master_send( pI2c, length ) );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_master_write_data (local)
+//--------------------------------------------------------------------------
+//	I²C master transport: send PREFIX_DATA followed by the display data.
+//	Longer data is split into several transactions, every one with its
+//	own prefix, the RAM pointer of the display just goes on.
+//
+esp_err_t _oled_i2c_master_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length )
+{
+	oled_i2c_master_t	*pI2c		= (oled_i2c_master_t *)pContext;
+	esp_err_t			 result		= pI2c->error;
+	uint8_t				*pSlot;
+	size_t				 copy;
+
+	if( ESP_OK != result )
+	{
+		pI2c->error = ESP_OK;
+
+		return( result );
+	}
+
+	result = _oled_i2c_master_device( pI2c, address );
+
+	while( (ESP_OK == result) && (0 < length) )
+	{
+		pSlot = _oled_i2c_master_slot( pI2c );
+
+		if( NULL == pSlot )
+		{
+			return( ESP_ERR_TIMEOUT );
+		}
+
+		copy = (OLED_I2C_CHUNK_SIZE - 1 < length) ? (OLED_I2C_CHUNK_SIZE - 1) : length;
+
+		pSlot[ 0 ] = PREFIX_DATA;
+		memcpy( &pSlot[ 1 ], pData, copy );
+
+		result	 = _oled_i2c_master_send( pI2c, copy + 1 );
+		pData	+= copy;
+		length	-= copy;
+	}
+
+	return( result );
+}
+
+#endif
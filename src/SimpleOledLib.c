@@ -5,7 +5,7 @@
 //#-------------------------------------------------------------------------
 //#
 //#	The functions in this library are used to control an OLED display
-//#	with an sh1106 or ssd1306 chipset via the I²C bus.
+//#	with an sh1106, sh1107 or ssd1306 chipset via the I²C bus.
 //#	Supported are only simple text output and some auxiliary functions,
 //#	e.g.: clear display, clear line, position cursor, etc.
 //#	If no display is connected nothing will be send over the I2C bus.
@@ -35,8 +35,20 @@
 //
 //==========================================================================
 
+#include <string.h>
+
 #include "SimpleOledLib.h"
 #include "font.h"
+#include "font_proportional.h"
+
+#if OLED_DISPLAY_STATS
+#include <esp_timer.h>
+#endif
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if OLED_GLYPH_VARIANTS && OLED_GLYPH_VARIANTS_IN_RAM
+#include <esp_attr.h>
+#endif
 
 
 //==========================================================================
@@ -48,15 +60,75 @@
 //#define	PRINT_DEBUG_INFO
 
 
-#define	TEXT_LINES						8
-#define TEXT_COLUMNS					16
+#define TEXT_COLUMNS					OLED_TEXT_COLUMNS
 
 #define PIXELS_CHAR_HEIGHT				8
 #define PIXELS_CHAR_WIDTH				8
 
-#define DISPLAY_COLUMN_OFFSET_MAX		3
-#define DISPLAY_COLUMN_OFFSET_MIN		0
-#define DISPLAY_COLUMN_OFFSET_DEFAULT	2
+#define SH1106_RAM_COLUMNS				132
+#define SSD1306_RAM_COLUMNS				128
+#define SH1107_RAM_COLUMNS				128
+#define SH1106_RAM_PAGES				8
+#define SSD1306_RAM_PAGES				8
+#define SH1107_RAM_PAGES				16
+
+//----------------------------------------------------------------------
+//	chip and geometry of the display, chosen at init or pinned at
+//	compile time (see OLED_FIXED_CHIP_TYPE)
+//
+#ifdef OLED_FIXED_CHIP_TYPE
+#if OLED_CHIP_SH1106 == OLED_FIXED_CHIP_TYPE
+#define FIXED_RAM_COLUMNS					SH1106_RAM_COLUMNS
+#define FIXED_RAM_PAGES						SH1106_RAM_PAGES
+#elif OLED_CHIP_SSD1306 == OLED_FIXED_CHIP_TYPE
+#define FIXED_RAM_COLUMNS					SSD1306_RAM_COLUMNS
+#define FIXED_RAM_PAGES						SSD1306_RAM_PAGES
+#elif OLED_CHIP_SH1107 == OLED_FIXED_CHIP_TYPE
+#define FIXED_RAM_COLUMNS					SH1107_RAM_COLUMNS
+#define FIXED_RAM_PAGES						SH1107_RAM_PAGES
+#else
+#error "OLED_FIXED_CHIP_TYPE is not a chip type"
+#endif
+#if OLED_MAX_PAGES < FIXED_RAM_PAGES
+#error "OLED_MAX_PAGES is too small for OLED_FIXED_CHIP_TYPE"
+#endif
+#define DISPLAY_CHIP_TYPE( pHandle )		((chip_type_t)OLED_FIXED_CHIP_TYPE)
+#define DISPLAY_RAM_PAGES( pHandle )		FIXED_RAM_PAGES
+#define DISPLAY_RAM_COLUMNS( pHandle )		FIXED_RAM_COLUMNS
+#else
+#define DISPLAY_CHIP_TYPE( pHandle )		((pHandle)->chipType)
+#define DISPLAY_RAM_PAGES( pHandle )		((pHandle)->ramPages)
+#define DISPLAY_RAM_COLUMNS( pHandle )		((pHandle)->ramColumns)
+#endif
+
+#ifdef OLED_FIXED_WIDTH
+#if OLED_COLUMN_OFFSET_CENTER == OLED_FIXED_COLUMN_OFFSET
+#define FIXED_COLUMN_OFFSET					((FIXED_RAM_COLUMNS - OLED_FIXED_WIDTH) / 2)
+#else
+#define FIXED_COLUMN_OFFSET					OLED_FIXED_COLUMN_OFFSET
+#endif
+#define DISPLAY_WIDTH( pHandle )			OLED_FIXED_WIDTH
+#define DISPLAY_TEXT_LINES( pHandle )		(OLED_FIXED_HEIGHT / PIXELS_CHAR_HEIGHT)
+#define DISPLAY_TEXT_COLUMNS( pHandle )		(OLED_FIXED_WIDTH / PIXELS_CHAR_WIDTH)
+#define DISPLAY_COLUMN_OFFSET( pHandle )	((pHandle)->flipped ? (DISPLAY_SPARE_COLUMNS( pHandle ) - FIXED_COLUMN_OFFSET) : FIXED_COLUMN_OFFSET)
+#define DISPLAY_COLUMN_OFFSET_ADJUSTABLE	0
+#else
+#define DISPLAY_WIDTH( pHandle )			((pHandle)->geometry.width)
+#define DISPLAY_TEXT_LINES( pHandle )		((pHandle)->textLines)
+#define DISPLAY_TEXT_COLUMNS( pHandle )		((pHandle)->textColumns)
+#define DISPLAY_COLUMN_OFFSET( pHandle )	((pHandle)->displayColumnOffset)
+#define DISPLAY_COLUMN_OFFSET_ADJUSTABLE	1
+#endif
+
+#define DISPLAY_SPARE_COLUMNS( pHandle )	(DISPLAY_RAM_COLUMNS( pHandle ) - DISPLAY_WIDTH( pHandle ))
+
+#if OLED_I2C_LEGACY
+#define I2C_TIMEOUT_TICKS				(50 / portTICK_PERIOD_MS)
+#endif
+
+#if OLED_DISPLAY_ASYNC && (configTASK_NOTIFICATION_ARRAY_ENTRIES <= OLED_NOTIFY_INDEX)
+#error "OLED_NOTIFY_INDEX needs more task notifications (configTASK_NOTIFICATION_ARRAY_ENTRIES)"
+#endif
 
 
 //--------------------------------------------------------------------------
@@ -97,9 +169,21 @@
 
 //----	ssd1306 specific command codes  --------------------------------
 #define OPC_MEMORY_ADR_MODE				0x20
+#define OPC_COLUMN_ADDRESS_RANGE		0x21
+#define OPC_PAGE_ADDRESS_RANGE			0x22
+#define OPC_RIGHT_SCROLL				0x26
+#define OPC_LEFT_SCROLL					0x27
+#define OPC_VERTICAL_RIGHT_SCROLL		0x29
+#define OPC_VERTICAL_LEFT_SCROLL		0x2A
 #define OPC_DEACTIVATE_SCROLL			0x2E
+#define OPC_ACTIVATE_SCROLL				0x2F
+#define OPC_VERTICAL_SCROLL_AREA		0xA3
 #define OPC_CHARGE_PUMP_SETTING			0x8D
 
+//----	sh1107 specific command codes  ---------------------------------
+#define OPC_PAGE_ADR_MODE_SH1107		0x20
+#define OPC_DISPLAY_START_LINE_SH1107	0xDC
+
 //----	prefix codes  --------------------------------------------------
 #define	PREFIX_NEXT_COMMAND				0x80
 #define PREFIX_LAST_COMMAND				0x00
@@ -115,6 +199,72 @@
 #define IDX_COLUMN_ADDRESS_LOW			3
 #define IDX_COLUMN_ADDRESS_HIGH			5
 
+//----	Idx into the geometry part of the init sequence  ---------------
+#define IDX_INIT_MULTIPLEX_RATIO		3
+#define IDX_INIT_COM_PINS				7
+#define INIT_GEOMETRY_SIZE_SH1107		4		//	no COM pins command
+
+//----	Idx into the clear sequence of the ssd1306  --------------------
+#define IDX_CLEAR_FIRST_COLUMN			7
+#define IDX_CLEAR_LAST_COLUMN			9
+#define IDX_CLEAR_LAST_PAGE				15
+
+//----	Bytes on the bus (the address byte included)  ------------------
+#define BUS_BYTES_POSITION				(1 + OLED_POSITION_BUFFER_SIZE)
+#define BUS_BYTES_PARAMETER				(1 + 3)
+#define BUS_BYTES_DATA( length )		(2 + (length))
+
+//----	last step of a smooth scroll  ----------------------------------
+#define SMOOTH_SCROLL_COMMAND_SIZE		6
+
+//----	render commands of the asynchronous output  -------------------
+#define RCMD_PRINT						1
+#define RCMD_CLEAR						2
+#define RCMD_CLEAR_LINE					3
+#define RCMD_CLEAR_ACTUAL_LINE			4
+#define RCMD_SET_CURSOR					5
+#define RCMD_SET_INVERSE				6
+#define RCMD_FLIP						7
+#define RCMD_SET_INVERSE_FONT			8
+#define RCMD_SET_PRINT_MODE				9
+#define RCMD_SET_COLUMN_OFFSET			10
+#define RCMD_SET_FRAME_BUFFER			11
+#define RCMD_FLUSH						12
+#define RCMD_FENCE						13
+#define RCMD_STOP						14
+#define RCMD_SET_GLYPH_VARIANT			15
+#define RCMD_START_MARQUEE				16
+#define RCMD_STOP_MARQUEE				17
+#define RCMD_SET_SMOOTH_SCROLL			18
+#define RCMD_SET_SCROLL_REGION			19
+#define RCMD_PRINT_FONT					20
+#define RCMD_DRAW						21
+
+//----	text shadow  ---------------------------------------------------
+#define SHADOW_UNKNOWN					0x00
+#define SHADOW_BLANK					' '
+
+//----------------------------------------------------------------------
+//	Costs of an additional span in a flush: position command plus the
+//	address byte and prefix of the data transaction. If two changed
+//	spans in a page are separated by less unchanged bytes than that,
+//	it is cheaper to send the unchanged bytes again.
+//
+#define FLUSH_SPAN_OVERHEAD				(BUS_BYTES_POSITION + BUS_BYTES_DATA( 0 ))
+
+//----	shapes of the drawing functions (RCMD_DRAW)  -------------------
+#define DRAW_FILL						1		//	x, y, width, height
+#define DRAW_RECT						2		//	x, y, width, height
+#define DRAW_LINE						3		//	x0, y0, x1, y1
+#define DRAW_CIRCLE						4		//	x, y, radius
+#define DRAW_COORDS						4
+
+//----	marquee (hardware scroll of the ssd1306)  ----------------------
+#define MARQUEE_DUMMY_BYTE				0x00
+#define MARQUEE_LAST_COLUMN				0xFF
+#define MARQUEE_VERTICAL_OFFSET			1
+#define MARQUEE_COMMAND_SIZE			16
+
 //----	memory addressing modes  ---------------------------------------
 #define ADR_MODE_HORIZONTAL				0x00
 #define ADR_MODE_VERTICAL				0x01
@@ -194,6 +344,64 @@
 #define DIS_CHARGE_PERIOD_DCLK_14		0xE0
 #define DIS_CHARGE_PERIOD_DCLK_15		0xF0
 
+//----	glyph variants  ------------------------------------------------
+#define FONT_FIRST_CHAR					' '
+#define FONT_CHARS						(96 + FONT_EXTENDED_CHARS)
+
+//----------------------------------------------------------------------
+//	A character is handled as one byte (glyph code) up to the display:
+//	0x20 ... 0x7F the ASCII characters, from FONT_FIRST_EXTENDED on the
+//	extended characters of the font (at most 128), so the text shadow
+//	keeps one byte per character. Text is decoded as UTF-8, a character
+//	without glyph becomes FONT_NO_GLYPH and is skipped.
+//
+#define FONT_FIRST_EXTENDED				0x80
+#define FONT_NO_GLYPH					0x01
+
+_Static_assert( FONT_EXTENDED_CHARS <= (0x100 - FONT_FIRST_EXTENDED), "font8x8_extended has more characters than glyph codes" );
+
+#define UTF8_INVALID					0xFFFFFFFF
+#define UTF8_MAX_BYTES					3			//	per character of the fonts (16 bit codepoints)
+
+#define GLYPH_REVERSE( b )				(	(((b) & 0x01) << 7) | (((b) & 0x02) << 5)	\
+										|	(((b) & 0x04) << 3) | (((b) & 0x08) << 1)	\
+										|	(((b) & 0x10) >> 1) | (((b) & 0x20) >> 3)	\
+										|	(((b) & 0x40) >> 5) | (((b) & 0x80) >> 7)	)
+
+#if OLED_GLYPH_VARIANTS
+//----------------------------------------------------------------------
+//	one glyph as 64 bit word, the first column is the first byte in RAM
+//
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define GLYPH_COLUMN( b, column )		((uint64_t)(uint8_t)(b) << (56 - ((column) << 3)))
+#else
+#define GLYPH_COLUMN( b, column )		((uint64_t)(uint8_t)(b) << ((column) << 3))
+#endif
+
+#define GLYPH_WORD( c0, c1, c2, c3, c4, c5, c6, c7 )	\
+		(	GLYPH_COLUMN( c0, 0 ) | GLYPH_COLUMN( c1, 1 ) | GLYPH_COLUMN( c2, 2 ) | GLYPH_COLUMN( c3, 3 )	\
+		|	GLYPH_COLUMN( c4, 4 ) | GLYPH_COLUMN( c5, 5 ) | GLYPH_COLUMN( c6, 6 ) | GLYPH_COLUMN( c7, 7 )	)
+
+#define GLYPH_NORMAL_WORD( c0, c1, c2, c3, c4, c5, c6, c7 )		\
+		GLYPH_WORD( c0, c1, c2, c3, c4, c5, c6, c7 ),
+
+#define GLYPH_INVERTED_WORD( c0, c1, c2, c3, c4, c5, c6, c7 )	\
+		~GLYPH_WORD( c0, c1, c2, c3, c4, c5, c6, c7 ),
+
+#define GLYPH_MIRRORED_WORD( c0, c1, c2, c3, c4, c5, c6, c7 )	\
+		GLYPH_WORD( c7, c6, c5, c4, c3, c2, c1, c0 ),
+
+#define GLYPH_ROTATED_WORD( c0, c1, c2, c3, c4, c5, c6, c7 )	\
+		GLYPH_WORD(	GLYPH_REVERSE( c7 ), GLYPH_REVERSE( c6 ), GLYPH_REVERSE( c5 ), GLYPH_REVERSE( c4 ),	\
+					GLYPH_REVERSE( c3 ), GLYPH_REVERSE( c2 ), GLYPH_REVERSE( c1 ), GLYPH_REVERSE( c0 )	),
+
+#if OLED_GLYPH_VARIANTS_IN_RAM
+#define GLYPH_TABLE_ATTR				DRAM_ATTR
+#else
+#define GLYPH_TABLE_ATTR
+#endif
+#endif
+
 
 //==========================================================================
 //
@@ -201,14 +409,17 @@
 //
 //==========================================================================
 
-uint8_t g_displayCommandBuffer[] =
+//----------------------------------------------------------------------
+//	templates for the command buffers of the display handle
+//
+const uint8_t g_displayCommandBuffer[ OLED_COMMAND_BUFFER_SIZE ] =
 	{
 		PREFIX_LAST_COMMAND,
 		0x00,
 		0x00
 	};
 
-uint8_t	g_arusPositionCommandBuffer[] =
+const uint8_t	g_arusPositionCommandBuffer[ OLED_POSITION_BUFFER_SIZE ] =
 	{
 		PREFIX_NEXT_COMMAND,
 		OPC_PAGE_ADDRESS,
@@ -220,6 +431,204 @@ uint8_t	g_arusPositionCommandBuffer[] =
 
 //const uint8_t *gp_CommandBuffer = (const uint8_t *)g_arusPositionCommandBuffer;
 
+//----------------------------------------------------------------------
+//	The init sequences of the chip types.
+//	Every command byte has its own prefix, so the complete sequence
+//	can be send in one transaction. The chip part is followed by the
+//	geometry part (multiplex ratio and COM pins of the panel) and the
+//	settings that are common for all chips:
+//	RAM pointer to page 0 / column 0, display on, no rotation.
+//
+const uint8_t	g_arusInitSequenceSh1106[] =
+	{
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_OFF,
+		PREFIX_NEXT_COMMAND,	OPC_ENTIRE_DISPLAY_NORMAL,
+		PREFIX_NEXT_COMMAND,	OPC_CLK_DIV_OSC_FREQ,
+		PREFIX_NEXT_COMMAND,	(OSC_FREQ_VARIATION_P_M_0 | CLOCK_DIV_RATIO_1),
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_LINE_OFFSET,
+		PREFIX_NEXT_COMMAND,	0,
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_START_LINE,
+		PREFIX_NEXT_COMMAND,	OPC_CHARGE_PUMP_SETTING,
+		PREFIX_NEXT_COMMAND,	0x14,
+		PREFIX_NEXT_COMMAND,	OPC_DC_DC_CONTROL_MODE,
+		PREFIX_NEXT_COMMAND,	DC_DC_ON,
+		PREFIX_NEXT_COMMAND,	OPC_DIS_PRE_CHARGE_PERIOD,
+		PREFIX_NEXT_COMMAND,	(DIS_CHARGE_PERIOD_DCLK_2 | PRE_CHARGE_PERIOD_DCLK_2),
+		PREFIX_NEXT_COMMAND,	OPC_SET_VCOM_DESELECT_LEVEL,
+		PREFIX_NEXT_COMMAND,	0x35,
+		PREFIX_NEXT_COMMAND,	OPC_DC_DC_PUMP_VOLTAGE_8_0,
+		PREFIX_NEXT_COMMAND,	OPC_SET_CONTRAST,
+		PREFIX_NEXT_COMMAND,	0xFF,
+		PREFIX_NEXT_COMMAND,	OPC_MODE_NORMAL
+	};
+
+const uint8_t	g_arusInitSequenceSsd1306[] =
+	{
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_OFF,
+		PREFIX_NEXT_COMMAND,	OPC_CLK_DIV_OSC_FREQ,
+		PREFIX_NEXT_COMMAND,	(OSC_FREQ_VARIATION_P_15 | CLOCK_DIV_RATIO_1),
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_LINE_OFFSET,
+		PREFIX_NEXT_COMMAND,	0,
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_START_LINE,
+		PREFIX_NEXT_COMMAND,	OPC_CHARGE_PUMP_SETTING,
+		PREFIX_NEXT_COMMAND,	0x14,
+		PREFIX_NEXT_COMMAND,	OPC_MEMORY_ADR_MODE,
+		PREFIX_NEXT_COMMAND,	ADR_MODE_PAGE,
+		PREFIX_NEXT_COMMAND,	OPC_SET_CONTRAST,
+		PREFIX_NEXT_COMMAND,	0xCF,
+	//	PREFIX_NEXT_COMMAND,	OPC_DIS_PRE_CHARGE_PERIOD,
+	//	PREFIX_NEXT_COMMAND,	(DIS_CHARGE_PERIOD_DCLK_2 | PRE_CHARGE_PERIOD_DCLK_2),
+		PREFIX_NEXT_COMMAND,	OPC_DIS_PRE_CHARGE_PERIOD,
+		PREFIX_NEXT_COMMAND,	(DIS_CHARGE_PERIOD_DCLK_15 | PRE_CHARGE_PERIOD_DCLK_1),
+		PREFIX_NEXT_COMMAND,	OPC_SET_VCOM_DESELECT_LEVEL,
+		PREFIX_NEXT_COMMAND,	0x40,
+		PREFIX_NEXT_COMMAND,	OPC_DEACTIVATE_SCROLL,	//	a marquee keeps running if only the ESP32 was restarted
+		PREFIX_NEXT_COMMAND,	OPC_ENTIRE_DISPLAY_NORMAL,
+		PREFIX_NEXT_COMMAND,	OPC_MODE_NORMAL
+	};
+
+const uint8_t	g_arusInitSequenceSh1107[] =
+	{
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_OFF,
+		PREFIX_NEXT_COMMAND,	OPC_CLK_DIV_OSC_FREQ,
+		PREFIX_NEXT_COMMAND,	(OSC_FREQ_VARIATION_P_M_0 | CLOCK_DIV_RATIO_2),
+		PREFIX_NEXT_COMMAND,	OPC_PAGE_ADR_MODE_SH1107,
+		PREFIX_NEXT_COMMAND,	OPC_SET_CONTRAST,
+		PREFIX_NEXT_COMMAND,	0x4F,
+		PREFIX_NEXT_COMMAND,	OPC_DC_DC_CONTROL_MODE,
+		PREFIX_NEXT_COMMAND,	DC_DC_OFF,
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_START_LINE_SH1107,
+		PREFIX_NEXT_COMMAND,	0,
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_LINE_OFFSET,
+		PREFIX_NEXT_COMMAND,	0,
+		PREFIX_NEXT_COMMAND,	OPC_DIS_PRE_CHARGE_PERIOD,
+		PREFIX_NEXT_COMMAND,	(DIS_CHARGE_PERIOD_DCLK_2 | PRE_CHARGE_PERIOD_DCLK_2),
+		PREFIX_NEXT_COMMAND,	OPC_SET_VCOM_DESELECT_LEVEL,
+		PREFIX_NEXT_COMMAND,	0x35,
+		PREFIX_NEXT_COMMAND,	OPC_ENTIRE_DISPLAY_NORMAL,
+		PREFIX_NEXT_COMMAND,	OPC_MODE_NORMAL
+	};
+
+//----------------------------------------------------------------------
+//	geometry part, the values are set from the geometry of the display
+//	(the sh1107 gets only the multiplex ratio)
+//
+const uint8_t	g_arusInitGeometry[] =
+	{
+		PREFIX_NEXT_COMMAND,	OPC_SET_MULTIPLEX_RATIO,
+		PREFIX_NEXT_COMMAND,	0x3F,
+		PREFIX_NEXT_COMMAND,	OPC_SET_COM_PINS,
+		PREFIX_NEXT_COMMAND,	0x12
+	};
+
+const uint8_t	g_arusInitCommon[] =
+	{
+		PREFIX_NEXT_COMMAND,	OPC_PAGE_ADDRESS,
+		PREFIX_NEXT_COMMAND,	OPC_COLUMN_ADDRESS_LOW,
+		PREFIX_NEXT_COMMAND,	OPC_COLUMN_ADDRESS_HIGH,
+		PREFIX_NEXT_COMMAND,	OPC_DISPLAY_ON,
+		PREFIX_NEXT_COMMAND,	OPC_SEG_ROTATION_RIGHT,
+		PREFIX_LAST_COMMAND,	OPC_OUTPUT_SCAN_NORMAL
+	};
+
+//----------------------------------------------------------------------
+//	the sh1106 has the longest chip part
+//
+#define INIT_SEQUENCE_SIZE		(sizeof( g_arusInitSequenceSh1106 ) + sizeof( g_arusInitGeometry ) + sizeof( g_arusInitCommon ))
+
+//----------------------------------------------------------------------
+//	ssd1306 only: switch to horizontal addressing over the visible part
+//	of the RAM, so the whole display can be cleared without any position
+//	commands in between, and switch back to page addressing afterwards.
+//	The column and page range are set from the geometry of the display.
+//
+const uint8_t	g_arusClearStartSsd1306[] =
+	{
+		PREFIX_NEXT_COMMAND,	OPC_MEMORY_ADR_MODE,
+		PREFIX_NEXT_COMMAND,	ADR_MODE_HORIZONTAL,
+		PREFIX_NEXT_COMMAND,	OPC_COLUMN_ADDRESS_RANGE,
+		PREFIX_NEXT_COMMAND,	0,
+		PREFIX_NEXT_COMMAND,	SSD1306_RAM_COLUMNS - 1,
+		PREFIX_NEXT_COMMAND,	OPC_PAGE_ADDRESS_RANGE,
+		PREFIX_NEXT_COMMAND,	0,
+		PREFIX_LAST_COMMAND,	SSD1306_RAM_PAGES - 1
+	};
+
+//----------------------------------------------------------------------
+//	the geometries of the supported panels
+//
+const oled_geometry_t	g_oledGeometry128x64	= { 128,  64, OLED_COLUMN_OFFSET_CENTER, 0x12 };
+const oled_geometry_t	g_oledGeometry128x32	= { 128,  32, OLED_COLUMN_OFFSET_CENTER, 0x02 };
+const oled_geometry_t	g_oledGeometry64x48		= {  64,  48, OLED_COLUMN_OFFSET_CENTER, 0x12 };
+const oled_geometry_t	g_oledGeometry72x40		= {  72,  40, OLED_COLUMN_OFFSET_CENTER, 0x12 };
+const oled_geometry_t	g_oledGeometry128x128	= { 128, 128, OLED_COLUMN_OFFSET_CENTER, 0x12 };
+
+#ifdef OLED_FIXED_WIDTH
+const oled_geometry_t	g_oledGeometryFixed		=	{	OLED_FIXED_WIDTH,
+														OLED_FIXED_HEIGHT,
+														OLED_FIXED_COLUMN_OFFSET,
+														OLED_FIXED_COM_PINS			};
+#endif
+
+const uint8_t	g_arusClearEndSsd1306[] =
+	{
+		PREFIX_NEXT_COMMAND,	OPC_MEMORY_ADR_MODE,
+		PREFIX_LAST_COMMAND,	ADR_MODE_PAGE
+	};
+
+//----------------------------------------------------------------------
+//	zero bytes used to clear the display RAM: one page of the sh1106,
+//	the complete RAM of the ssd1306 (cleared with one data transaction)
+//
+#if defined( OLED_FIXED_CHIP_TYPE ) && (OLED_CHIP_SSD1306 != OLED_FIXED_CHIP_TYPE)
+#define CLEAR_BUFFER_SIZE				SH1106_RAM_COLUMNS
+#else
+#define CLEAR_BUFFER_SIZE				(SSD1306_RAM_COLUMNS * SSD1306_RAM_PAGES)
+#endif
+
+const uint8_t	g_arusClearBuffer[ CLEAR_BUFFER_SIZE ] = { 0x00 };
+
+#if OLED_GLYPH_VARIANTS
+//----------------------------------------------------------------------
+//	The variants of the font, generated by the compiler from the font
+//	list (see font.h). Inverse mirrored or rotated characters are
+//	inverted with one 64 bit operation.
+//
+GLYPH_TABLE_ATTR const uint64_t	g_arullGlyphNormal[ FONT_CHARS ]	= { FONT8X8_SIMPLE( GLYPH_NORMAL_WORD ) FONT8X8_EXTENDED( GLYPH_NORMAL_WORD ) };
+GLYPH_TABLE_ATTR const uint64_t	g_arullGlyphInverted[ FONT_CHARS ]	= { FONT8X8_SIMPLE( GLYPH_INVERTED_WORD ) FONT8X8_EXTENDED( GLYPH_INVERTED_WORD ) };
+GLYPH_TABLE_ATTR const uint64_t	g_arullGlyphMirrored[ FONT_CHARS ]	= { FONT8X8_SIMPLE( GLYPH_MIRRORED_WORD ) FONT8X8_EXTENDED( GLYPH_MIRRORED_WORD ) };
+GLYPH_TABLE_ATTR const uint64_t	g_arullGlyphRotated[ FONT_CHARS ]	= { FONT8X8_SIMPLE( GLYPH_ROTATED_WORD ) FONT8X8_EXTENDED( GLYPH_ROTATED_WORD ) };
+
+const uint64_t * const			g_arpGlyphTable[] =
+	{
+		g_arullGlyphNormal,		//	GLYPH_NORMAL
+		g_arullGlyphMirrored,	//	GLYPH_MIRRORED
+		g_arullGlyphRotated		//	GLYPH_ROTATED
+	};
+#endif
+
+//----------------------------------------------------------------------
+//	Every bit of a nibble repeated 'scale' times (index scale - 2), used
+//	to spread a column byte of scaled text over the pages.
+//
+const uint16_t	g_aruiSpreadNibble[ OLED_MAX_SCALE - 1 ][ 16 ] =
+	{
+		{	0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F,
+			0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF	},
+		{	0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF,
+			0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF	},
+		{	0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+			0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF	}
+	};
+
+//----------------------------------------------------------------------
+//	proportional fonts (see font_proportional.h)
+//
+const oled_font_t	g_oledFont5x7	= { g_arusFont5x7Columns, g_arFont5x7Glyphs, ' ', '~', 7, 0, 0,
+										font_extended_codepoints, FONT_EXTENDED_CHARS };
+const oled_font_t	g_oledFont3x5	= { g_arusFont3x5Columns, g_arFont3x5Glyphs, ' ', '~', 6, 1, OLED_FONT_PACKED,
+										font_extended_codepoints, FONT_EXTENDED_CHARS };
+
 
 //==========================================================================
 //
@@ -227,12 +636,90 @@ uint8_t	g_arusPositionCommandBuffer[] =
 //
 //==========================================================================
 
-void _oled_display_init_sh1106(  oled_display_handle_t *pHandle );
-void _oled_display_init_ssd1306( oled_display_handle_t *pHandle );
+bool _oled_display_set_geometry( oled_display_handle_t *pHandle, chip_type_t chipType, const oled_geometry_t *pGeometry );
+void _oled_display_send_init_sequence( oled_display_handle_t *pHandle );
+uint16_t _oled_display_visible_pages( oled_display_handle_t *pHandle );
 void _oled_display_next_line( oled_display_handle_t *pHandle, bool shiftLine );
 void _oled_display_send_opcode( oled_display_handle_t *pHandle, uint8_t opCode );
 void _oled_display_send_parameter( oled_display_handle_t *pHandle, uint8_t opCode, uint8_t parameter );
-void _oled_display_shift_display_one_line( oled_display_handle_t *pHandle );
+bool _oled_display_shift_display_one_line( oled_display_handle_t *pHandle );
+void _oled_display_smooth_scroll( oled_display_handle_t *pHandle );
+void _oled_display_send_start_line( oled_display_handle_t *pHandle, uint8_t startLine );
+void _oled_display_scroll_region( oled_display_handle_t *pHandle );
+uint8_t _oled_display_page_of_line( oled_display_handle_t *pHandle, uint8_t textLine );
+void _oled_display_set_position( oled_display_handle_t *pHandle, uint8_t page, uint8_t column );
+void _oled_display_draw( oled_display_handle_t *pHandle, uint8_t shape, const int16_t *pCoord, pixel_op_t op );
+void _oled_display_apply_op( uint8_t *pColumn, uint8_t columns, uint8_t mask, pixel_op_t op );
+void _oled_display_fill_area( oled_display_handle_t *pHandle, int32_t x0, int32_t y0, int32_t x1, int32_t y1, pixel_op_t op );
+void _oled_display_draw_point( oled_display_handle_t *pHandle, int32_t x, int32_t y, pixel_op_t op );
+void _oled_display_draw_rect( oled_display_handle_t *pHandle, int32_t x, int32_t y, int32_t width, int32_t height, pixel_op_t op );
+void _oled_display_draw_line( oled_display_handle_t *pHandle, int32_t x0, int32_t y0, int32_t x1, int32_t y1, pixel_op_t op );
+void _oled_display_draw_circle( oled_display_handle_t *pHandle, int32_t x, int32_t y, int32_t radius, pixel_op_t op );
+void _oled_display_draw_circle_points( oled_display_handle_t *pHandle, int32_t x, int32_t y, int32_t dx, int32_t dy, pixel_op_t op );
+uint32_t _oled_display_flush_span( oled_display_handle_t *pHandle, uint8_t page, uint8_t firstColumn, uint8_t lastColumn );
+#if OLED_FRAME_BUFFER_SHADOW
+uint32_t _oled_display_flush_page_diff( oled_display_handle_t *pHandle, uint8_t page );
+#endif
+void _oled_display_print_glyph( oled_display_handle_t *pHandle, uint8_t charIdx );
+uint32_t _oled_display_utf8_decode( const uint8_t **ppText, uint8_t lead );
+uint16_t _oled_display_find_codepoint( const uint16_t *pCodepoints, uint16_t count, uint32_t codepoint );
+uint8_t _oled_display_codepoint_glyph( uint32_t codepoint );
+uint8_t _oled_display_encode_glyph( uint8_t charIdx, char *pDest );
+const oled_glyph_t *_oled_display_font_glyph( const oled_font_t *pFont, const uint8_t **ppText );
+void _oled_display_render_glyph( oled_display_handle_t *pHandle, uint8_t charIdx, uint64_t *pDest );
+uint8_t _oled_display_render_font_text( oled_display_handle_t *pHandle, const oled_font_t *pFont, const char *strText, uint8_t *pDest, uint8_t columns );
+void _oled_display_decode_glyph( const oled_font_t *pFont, const oled_glyph_t *pGlyph, uint8_t *pDest, uint8_t columns );
+void _oled_display_spread_columns( const uint8_t *pSource, uint8_t scale, uint8_t pages, uint8_t * const *ppDest, uint8_t columns );
+void _oled_display_sync_cursor( oled_display_handle_t *pHandle );
+bool _oled_display_shadow_update( oled_display_handle_t *pHandle, uint8_t charIdx );
+void _oled_display_shadow_fill( oled_display_handle_t *pHandle, uint8_t page, uint8_t charIdx );
+void _oled_display_shadow_invalidate( oled_display_handle_t *pHandle );
+void _oled_display_shadow_clear_span( oled_display_handle_t *pHandle, uint8_t page, uint8_t *pFirstColumn, uint8_t *pColumns );
+void _oled_display_shadow_forget( oled_display_handle_t *pHandle, uint8_t page, uint8_t firstPixel, uint8_t endPixel );
+bool _oled_display_shadow_scroll_region( oled_display_handle_t *pHandle );
+void _oled_display_write_run( oled_display_handle_t *pHandle, const uint8_t *pRun, uint8_t *pRunLength );
+void _oled_display_write( oled_display_handle_t *pHandle, const uint8_t *pBuffer, size_t length );
+void _oled_display_write_data( oled_display_handle_t *pHandle, const uint8_t *pData, size_t length );
+void _oled_display_lost( oled_display_handle_t *pHandle );
+
+bool _oled_display_post( oled_display_handle_t *pHandle, uint8_t type, uint8_t parameter1, uint8_t parameter2, const void *pData, uint8_t length );
+bool _oled_display_post_text( oled_display_handle_t *pHandle, const char *strText, bool bNewLine );
+bool _oled_display_post_font_text( oled_display_handle_t *pHandle, const oled_font_t *pFont, uint8_t scale, uint8_t textLine, uint8_t x, const char *strText );
+bool _oled_display_in_render_task( oled_display_handle_t *pHandle );
+uint8_t _oled_display_begin( oled_display_handle_t *pHandle, uint8_t entry );
+void _oled_display_end( oled_display_handle_t *pHandle, uint8_t previousEntry );
+#if OLED_DISPLAY_STATS
+void _oled_display_count( oled_display_handle_t *pHandle, esp_err_t result, uint32_t busBytes, int64_t startTime );
+#endif
+#if OLED_DISPLAY_ASYNC
+bool _oled_display_is_async( oled_display_handle_t *pHandle );
+uint32_t _oled_display_post_fence( oled_display_handle_t *pHandle, uint8_t type, TaskHandle_t waiter, TickType_t ticksToWait );
+void _oled_display_render_task( void *pParameter );
+void _oled_display_execute( oled_display_handle_t *pHandle, const oled_render_cmd_t *pCmd );
+uint8_t _oled_display_text_chunk( const char *strText, size_t length, uint8_t size );
+#endif
+
+#if OLED_I2C_LEGACY
+esp_err_t _oled_i2c_probe( void *pContext, uint8_t address );
+esp_err_t _oled_i2c_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length );
+esp_err_t _oled_i2c_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length );
+#endif
+
+
+//==========================================================================
+//
+//		T R A N S P O R T S
+//
+//==========================================================================
+
+#if OLED_I2C_LEGACY
+const oled_transport_t	g_oledI2cTransport =
+	{
+		.probe		= _oled_i2c_probe,
+		.write		= _oled_i2c_write,
+		.write_data	= _oled_i2c_write_data
+	};
+#endif
 
 
 //==========================================================================
@@ -246,11 +733,13 @@ void _oled_display_shift_display_one_line( oled_display_handle_t *pHandle );
 //	oled_display_max_text_lines
 //--------------------------------------------------------------------------
 //	The Function will return the number of text lines that the display
-//	can handle
+//	can handle (depends on the geometry of the panel)
 //
-uint8_t oled_display_max_text_lines( void )
+uint8_t oled_display_max_text_lines( oled_display_handle_t *pHandle )
 {
-	return( TEXT_LINES );
+	(void)pHandle;
+
+	return( DISPLAY_TEXT_LINES( pHandle ) );
 }
 
 
@@ -258,27 +747,99 @@ uint8_t oled_display_max_text_lines( void )
 //	oled_display_max_column_lines
 //--------------------------------------------------------------------------
 //	The Function will return the number of text columns that the display
-//	can handle
+//	can handle (depends on the geometry of the panel)
 //
-uint8_t oled_display_max_column_lines( void )
+uint8_t oled_display_max_column_lines( oled_display_handle_t *pHandle )
 {
-	return( TEXT_COLUMNS );
+	(void)pHandle;
+
+	return( DISPLAY_TEXT_COLUMNS( pHandle ) );
 }
 
 
+#if OLED_I2C_LEGACY
 //**************************************************************************
 //	oled_display_init
 //--------------------------------------------------------------------------
 //	The Function initializes the class, sets the display in default
 //	operation mode, switches the display 'on', clears the display and
 //	sets the cursor to home position (top left corner).
+//	The display is controlled with the legacy I²C driver on the given port.
+//	The panel has the default geometry of the chip
+//	(see oled_display_init_panel).
 //
 uint8_t oled_display_init( oled_display_handle_t *pHandle, i2c_port_t port, chip_type_t chipType, uint8_t address )
+{
+	pHandle->port = port;
+
+	return( oled_display_init_panel( pHandle, &g_oledI2cTransport, pHandle, chipType, address, NULL ) );
+}
+#endif
+
+
+//**************************************************************************
+//	oled_display_init_transport
+//--------------------------------------------------------------------------
+//	Same as oled_display_init() but all bytes for the display are send
+//	through the given transport. pContext will be handed over to every
+//	function of the transport.
+//
+uint8_t oled_display_init_transport(	oled_display_handle_t	*pHandle,
+										const oled_transport_t	*pTransport,
+										void					*pContext,
+										chip_type_t				 chipType,
+										uint8_t					 address		)
+{
+	return( oled_display_init_panel( pHandle, pTransport, pContext, chipType, address, NULL ) );
+}
+
+
+//**************************************************************************
+//	oled_display_init_panel
+//--------------------------------------------------------------------------
+//	Same as oled_display_init_transport() for a panel with the given
+//	geometry (see oled_geometry_t). With NULL the default geometry of
+//	the chip is used: 128x128 for the sh1107, 128x64 for the others.
+//	To use the legacy I²C driver set the port of the handle and give
+//	g_oledI2cTransport with the handle as context.
+//
+//	return values:
+//		0	display is initialized
+//		1	no valid address
+//		2	no display connected
+//		3	the geometry is not supported by the chip
+//			(or needs a bigger OLED_MAX_PAGES, or is not the chip and
+//			geometry of a specialized build)
+//
+uint8_t oled_display_init_panel(	oled_display_handle_t	*pHandle,
+									const oled_transport_t	*pTransport,
+									void					*pContext,
+									chip_type_t				 chipType,
+									uint8_t					 address,
+									const oled_geometry_t	*pGeometry		)
 {
 	//------------------------------------------------------------------
 	//	set initial values for internal variables
 	//
-	pHandle->port					= port;
+	pHandle->pTransport				= pTransport;
+	pHandle->pTransportContext		= pContext;
+	pHandle->pFrameBuffer			= NULL;
+#if OLED_DISPLAY_ASYNC
+	pHandle->pAsync					= NULL;
+#endif
+#if OLED_DISPLAY_LOCK
+	pHandle->lock					= NULL;
+#endif
+#if OLED_DISPLAY_STATS
+	pHandle->statsEntry				= OLED_STATS_ENTRIES;
+	pHandle->positionEntry			= OLED_STATS_ENTRIES;
+	memset( &pHandle->stats, 0, sizeof( pHandle->stats ) );
+#endif
+
+	_oled_display_shadow_invalidate( pHandle );
+
+	memcpy( pHandle->commandBuffer, g_displayCommandBuffer, sizeof( pHandle->commandBuffer ) );
+	memcpy( pHandle->positionCommandBuffer, g_arusPositionCommandBuffer, sizeof( pHandle->positionCommandBuffer ) );
 	pHandle->chipType				= chipType;
 	pHandle->address				= address;
 	pHandle->printMode				= PM_SCROLL_LINE;
@@ -288,6 +849,19 @@ uint8_t oled_display_init( oled_display_handle_t *pHandle, i2c_port_t port, chip
 	pHandle->displayColumnOffset	= 0;
 	pHandle->displayConnected		= false;
 	pHandle->inverse				= false;
+	pHandle->flipped				= false;
+	pHandle->positionPending		= true;
+	pHandle->glyphVariant			= GLYPH_NORMAL;
+	pHandle->marqueePages			= 0;
+	pHandle->smoothScrollMs			= 0;
+
+	if( !_oled_display_set_geometry( pHandle, chipType, pGeometry ) )
+	{
+		return( 3 );
+	}
+
+	pHandle->scrollFirstLine		= 0;
+	pHandle->scrollLastLine			= DISPLAY_TEXT_LINES( pHandle ) - 1;
 
 
 	//------------------------------------------------------------------
@@ -305,11 +879,11 @@ uint8_t oled_display_init( oled_display_handle_t *pHandle, i2c_port_t port, chip
 
 	if( DISPLAY_ADDRESS_DEFAULT == address )
 	{
-		if( ESP_OK == i2c_master_write_to_device( port, DISPLAY_ADDRESS_ONE, g_arusPositionCommandBuffer, 0, 50 / portTICK_PERIOD_MS ) )
+		if( ESP_OK == pTransport->probe( pContext, DISPLAY_ADDRESS_ONE ) )
 		{
 			address	=	DISPLAY_ADDRESS_ONE;
 		}
-		else if( ESP_OK == i2c_master_write_to_device( port, DISPLAY_ADDRESS_TWO, g_arusPositionCommandBuffer, 0, 50 / portTICK_PERIOD_MS ) )
+		else if( ESP_OK == pTransport->probe( pContext, DISPLAY_ADDRESS_TWO ) )
 		{
 			address	=	DISPLAY_ADDRESS_TWO;
 		}
@@ -325,7 +899,7 @@ uint8_t oled_display_init( oled_display_handle_t *pHandle, i2c_port_t port, chip
 	//------------------------------------------------------------------
 	//	Check if Display can be connected under the given address
 	//
-	if( ESP_OK == i2c_master_write_to_device( port, address, g_arusPositionCommandBuffer, 0, 50 / portTICK_PERIOD_MS ) )
+	if( ESP_OK == pTransport->probe( pContext, address ) )
 	{
 		//----------------------------------------------------------
 		//	YES the display can be connected with the given address
@@ -334,23 +908,7 @@ uint8_t oled_display_init( oled_display_handle_t *pHandle, i2c_port_t port, chip
 		pHandle->address			= address;
 		pHandle->displayConnected	= true;
 
-		if( CHIP_TYPE_SSD1306 == chipType )
-		{
-			_oled_display_init_ssd1306( pHandle );
-		}
-		else
-		{
-			pHandle->displayColumnOffset = DISPLAY_COLUMN_OFFSET_DEFAULT;
-
-			_oled_display_init_sh1106( pHandle );
-		}
-
-		_oled_display_send_opcode( pHandle, OPC_PAGE_ADDRESS );
-		_oled_display_send_opcode( pHandle, OPC_COLUMN_ADDRESS_LOW );
-		_oled_display_send_opcode( pHandle, OPC_COLUMN_ADDRESS_HIGH );
-		_oled_display_send_opcode( pHandle, OPC_DISPLAY_ON );
-		_oled_display_send_opcode( pHandle, OPC_SEG_ROTATION_RIGHT );
-		_oled_display_send_opcode( pHandle, OPC_OUTPUT_SCAN_NORMAL );
+		_oled_display_send_init_sequence( pHandle );
 
 		oled_display_clear( pHandle );
 
@@ -372,79 +930,36 @@ uint8_t oled_display_init( oled_display_handle_t *pHandle, i2c_port_t port, chip
 //	PrintMode the cursor will be set to the beginning of the (next) line
 //	and the text output will continue there.
 //
+//	Characters from 0x80 on are taken as Latin-1 (ISO 8859-1, the first
+//	256 codepoints of Unicode), e.g. 0xB0 for the degree sign.
+//
 void oled_display_print_char( oled_display_handle_t *pHandle, uint8_t charIdx )
 {
-	i2c_cmd_handle_t	cmd;
-	uint16_t			uiHelper;
-	uint8_t				usLetterColumn;
+	uint8_t				usStatsEntry;
+	char				strText[ 3 ]	= { (char)charIdx, 0x00, 0x00 };
 
-	if( pHandle->displayConnected )
+	if( 0x80 <= charIdx )
 	{
-		if( '\n' == charIdx )
-		{
-			_oled_display_next_line( pHandle, true );
-		}
-		else if( (' ' <= charIdx) && (128 > charIdx) )
-		{
-			//--------------------------------------------------------------
-			//	if we reached the end of the line then depending of the
-			//	PrintMode continue in the 'next line'
-			//
-			if( TEXT_COLUMNS <= pHandle->textColumn )
-			{
-				_oled_display_next_line( pHandle, false );
-			}
-
-			//--------------------------------------------------------------
-			//	this is a printable character, so calculate the pointer
-			//	into the font array to that position where the bitmap of
-			//	this character starts
-			//
-			uiHelper   = charIdx - 32;
-			uiHelper <<= 3;	//	mit 8 multiplizieren
-
-#ifdef PRINT_DEBUG_INFO
-			printf( "PrintChar( %c ): Idx: %d => ", charIdx, uiHelper );
-#endif
-
-			//--------------------------------------------------------------
-			//	transmit the bitmap of the character to the display
-			//
-			cmd = i2c_cmd_link_create();
-			i2c_master_start( cmd );
-			i2c_master_write_byte( cmd, (pHandle->address << 1) | I2C_MASTER_WRITE, true );
-			i2c_master_write_byte( cmd, PREFIX_DATA, true );
-
-			for( uint8_t idx = 0 ; PIXELS_CHAR_WIDTH > idx ; idx++ )
-			{
-				usLetterColumn = (uint8_t)font8x8_simple[ uiHelper ];
-				uiHelper++;
-
-#ifdef PRINT_DEBUG_INFO
-				printf( " %02X ", usLetterColumn );
-#endif
-
-				if( pHandle->inverse )
-				{
-					usLetterColumn = ~usLetterColumn;
-				}
-
-				i2c_master_write_byte( cmd, usLetterColumn, true );
-			}
+		strText[ 0 ] = (char)(0xC0 | (charIdx >> 6));
+		strText[ 1 ] = (char)(0x80 | (charIdx & 0x3F));
+	}
 
-			i2c_master_stop( cmd );
-			i2c_master_cmd_begin( pHandle->port, cmd, 50 / portTICK_PERIOD_MS );
-			i2c_cmd_link_delete( cmd );
+	if( _oled_display_post_text( pHandle, strText, false ) )
+	{
+		return;
+	}
 
-#ifdef PRINT_DEBUG_INFO
-			printf( "\n" );
-#endif
+	if( pHandle->displayConnected )
+	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_PRINT );
 
-			//--------------------------------------------------------------
-			//	one character printed, so move cursor
-			//
-			pHandle->textColumn++;
+		if( 0x80 <= charIdx )
+		{
+			charIdx = _oled_display_codepoint_glyph( charIdx );
 		}
+
+		_oled_display_print_glyph( pHandle, charIdx );
+		_oled_display_end( pHandle, usStatsEntry );
 	}
 }
 
@@ -460,20 +975,139 @@ void oled_display_print_char( oled_display_handle_t *pHandle, uint8_t charIdx )
 //	PrintMode the cursor will be set to the beginning of the (next) line
 //	and the text output will continue there.
 //
+//	The text is UTF-8, characters without glyph in the font are skipped
+//	(see font.h for the characters beyond ASCII).
+//
+//	All characters that will be printed into the same line one after the
+//	other are collected and send to the display as one transaction.
+//	With the text shadow characters that are already shown on the display
+//	are skipped, so only the runs of changed characters are send.
+//
 void oled_display_print( oled_display_handle_t *pHandle, const char* strText )
 {
-	uint8_t *pText = (uint8_t *)strText;
+	uint64_t		 arullRun[ TEXT_COLUMNS ];
+	uint8_t			*pRun			= (uint8_t *)arullRun;
+	uint8_t			 usRunLength	= 0;
+	uint8_t			 usGapLength	= 0;
+	uint8_t			 usStatsEntry;
+	const uint8_t	*pText			= (const uint8_t *)strText;
+
+	if( _oled_display_post_text( pHandle, strText, false ) )
+	{
+		return;
+	}
 
 	if( pHandle->displayConnected )
 	{
 		uint8_t	charIdx	= *pText++;
 
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_PRINT );
+
+		if( NULL != pHandle->pFrameBuffer )
+		{
+			//--------------------------------------------------------------
+			//	frame buffer mode: nothing will be send,
+			//	so print character by character into the RAM copy
+			//
+			while( 0x00 != charIdx )
+			{
+				if( 0x80 <= charIdx )
+				{
+					charIdx = _oled_display_codepoint_glyph( _oled_display_utf8_decode( &pText, charIdx ) );
+				}
+
+				_oled_display_print_glyph( pHandle, charIdx );
+
+				charIdx = *pText++;
+			}
+		}
+
 		while( 0x00 != charIdx )
 		{
-			oled_display_print_char( pHandle, charIdx );
+			//--------------------------------------------------------------
+			//	ASCII is printed as it is, only the other characters
+			//	are decoded and looked up in the extended characters
+			//
+			if( 0x80 <= charIdx )
+			{
+				charIdx = _oled_display_codepoint_glyph( _oled_display_utf8_decode( &pText, charIdx ) );
+			}
+
+			if( '\n' == charIdx )
+			{
+				_oled_display_write_run( pHandle, pRun, &usRunLength );
+				_oled_display_next_line( pHandle, true );
+
+				usGapLength = 0;
+			}
+			else if( ' ' <= charIdx )
+			{
+				//----------------------------------------------------------
+				//	the line is full: send the characters collected so far
+				//	and then depending of the PrintMode continue in the
+				//	'next line'
+				//
+				if( DISPLAY_TEXT_COLUMNS( pHandle ) <= pHandle->textColumn )
+				{
+					_oled_display_write_run( pHandle, pRun, &usRunLength );
+					_oled_display_next_line( pHandle, false );
+
+					usGapLength = 0;
+				}
+
+				if( _oled_display_shadow_update( pHandle, charIdx ) )
+				{
+					//------------------------------------------------------
+					//	the character is already shown: a short gap between
+					//	two changed characters is cheaper to send again than
+					//	a new position (same rule as for the frame buffer),
+					//	otherwise send the characters collected so far
+					//
+					if( (0 < usRunLength) && (FLUSH_SPAN_OVERHEAD > (usGapLength + PIXELS_CHAR_WIDTH)) )
+					{
+						_oled_display_render_glyph( pHandle, charIdx, &arullRun[ (usRunLength + usGapLength) >> 3 ] );
+
+						usGapLength += PIXELS_CHAR_WIDTH;
+					}
+					else
+					{
+						_oled_display_write_run( pHandle, pRun, &usRunLength );
+
+						usGapLength = 0;
+					}
+
+					pHandle->positionPending = true;
+				}
+				else
+				{
+					if( 0 == usRunLength )
+					{
+						_oled_display_sync_cursor( pHandle );
+					}
+					else
+					{
+						//--------------------------------------------------
+						//	the gap becomes part of the run, so the RAM
+						//	pointer follows the cursor again
+						//
+						usRunLength				+= usGapLength;
+						usGapLength				 = 0;
+						pHandle->positionPending = false;
+					}
+
+					_oled_display_render_glyph( pHandle, charIdx, &arullRun[ usRunLength >> 3 ] );
+
+					usRunLength += PIXELS_CHAR_WIDTH;
+				}
+
+				pHandle->textColumn++;
+			}
 
 			charIdx = *pText++;
 		}
+
+		_oled_display_write_run( pHandle, pRun, &usRunLength );
+		_oled_display_end( pHandle, usStatsEntry );
 	}
 }
 
@@ -492,137 +1126,379 @@ void oled_display_print( oled_display_handle_t *pHandle, const char* strText )
 //
 void oled_display_println( oled_display_handle_t *pHandle, const char* strText )
 {
+	uint8_t	usStatsEntry;
+
+	if( _oled_display_post_text( pHandle, strText, true ) )
+	{
+		return;
+	}
+
 	if( pHandle->displayConnected )
 	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_PRINT );
+
 		oled_display_print( pHandle, strText );
 		_oled_display_next_line( pHandle, true );
+
+		_oled_display_end( pHandle, usStatsEntry );
 	}
 }
 
 
 //**************************************************************************
-//	oled_display_clear
+//	oled_display_print_font
 //--------------------------------------------------------------------------
-//	The function deletes all text shown on the display.
+//	This function prints the given text with a proportional font into
+//	the given text line, starting at the pixel column x. The columns of
+//	the text are overwritten completely (all eight rows), the text is
+//	cut at the end of the line. The text is UTF-8, characters without
+//	glyph are skipped.
+//	The cursor is not moved, the inverse font is used, the glyph
+//	variant not.
 //
-void oled_display_clear( oled_display_handle_t *pHandle )
+//	The text is rendered into a buffer for the whole line and send as
+//	one transaction (with a frame buffer it is drawn into the RAM copy).
+//	Returns the pixel column after the text, e.g. to print the next
+//	part of a line.
+//
+uint8_t oled_display_print_font(	oled_display_handle_t	*pHandle,
+									const oled_font_t		*pFont,
+									uint8_t					 textLine,
+									uint8_t					 x,
+									const char				*strText	)
 {
-	if( pHandle->displayConnected )
-	{
-		for( uint8_t usTextLine = 0 ; usTextLine < TEXT_LINES ; usTextLine++ )
-		{
-			oled_display_clear_line( pHandle, usTextLine );
-		}
-
-		//------------------------------------------------------------------
-		//	Set the display line offset back to the default value '0'.
-		//	That means beginn to display the display with the top line.
-		//
-		pHandle->lineOffset = 0;
-
-		_oled_display_send_parameter( pHandle, OPC_DISPLAY_LINE_OFFSET, 0 );
-
-		//------------------------------------------------------------------
-		//	set the cursor to home position
-		//
-		oled_display_set_cursor( pHandle, 0, 0 );
-	}
+	return( oled_display_print_scaled( pHandle, pFont, 1, textLine, x, strText ) );
 }
 
 
 //**************************************************************************
-//	oled_display_clear_line
+//	oled_display_print_scaled
 //--------------------------------------------------------------------------
-//	The function deletes the text line at the given cursor position and
-//	sets the cursor to the bginning of that line.
+//	Same as oled_display_print_font() with every pixel enlarged to
+//	scale x scale pixels (1 ... OLED_MAX_SCALE), e.g. for values that
+//	must be readable at a distance. The text covers 'scale' text lines
+//	from textLine on, the lines below the display are cut.
+//	With pFont NULL the 8x8 font of oled_display_print() is used (with
+//	the glyph variant).
 //
-void oled_display_clear_line( oled_display_handle_t *pHandle, uint8_t lineToClear )
+//	The text is rendered once in its normal size, then every column
+//	byte is spread to 'scale' bytes (one per page) with a table per
+//	nibble. Every page is send as one transaction.
+//	Returns the pixel column after the text.
+//
+uint8_t oled_display_print_scaled(	oled_display_handle_t	*pHandle,
+									const oled_font_t		*pFont,
+									uint8_t					 scale,
+									uint8_t					 textLine,
+									uint8_t					 x,
+									const char				*strText	)
 {
-	i2c_cmd_handle_t	cmd;
-	uint8_t				usLoop1End;
-	uint8_t				usLoop2End;
+	uint64_t	 arullSource[ TEXT_COLUMNS ];
+	uint8_t		 arusPages[ OLED_MAX_SCALE ][ OLED_FRAME_BUFFER_COLUMNS ];
+	uint8_t		*arpDest[ OLED_MAX_SCALE ];
+	uint8_t		 arusPage[ OLED_MAX_SCALE ];
+	uint16_t	 uiEnd;
+	uint8_t		 usColumns;
+	uint8_t		 usPages;
+	uint8_t		 usStatsEntry;
 
+	if( (1 > scale) || (OLED_MAX_SCALE < scale) )
+	{
+		return( x );
+	}
 
-	if( pHandle->displayConnected )
+	uiEnd = x + scale * oled_font_text_width( pFont, strText );
+
+	if( DISPLAY_WIDTH( pHandle ) < uiEnd )
 	{
-		//--------------------------------------------------------------
-		//	at the end of the function the cursor will be positioned to
-		//	the beginning of the line that will be cleared
+		uiEnd = (DISPLAY_WIDTH( pHandle ) > x) ? DISPLAY_WIDTH( pHandle ) : x;
+	}
+
+	if( _oled_display_post_font_text( pHandle, pFont, scale, textLine, x, strText ) )
+	{
+		return( (uint8_t)uiEnd );
+	}
+
+	if( pHandle->displayConnected && (DISPLAY_TEXT_LINES( pHandle ) > textLine) && (uiEnd > x) )
+	{
+		usStatsEntry	= _oled_display_begin( pHandle, OLED_STATS_PRINT );
+		usColumns		= (uint8_t)(uiEnd - x);
+		usPages			= (DISPLAY_TEXT_LINES( pHandle ) - textLine < scale) ? (DISPLAY_TEXT_LINES( pHandle ) - textLine) : scale;
+
+		for( uint8_t idx = 0 ; usPages > idx ; idx++ )
+		{
+			arusPage[ idx ]	= _oled_display_page_of_line( pHandle, textLine + idx );
+			arpDest[ idx ]	= (NULL != pHandle->pFrameBuffer)	? &pHandle->pFrameBuffer->image[ arusPage[ idx ] ][ x ]
+																: arusPages[ idx ];
+		}
+
+		//------------------------------------------------------------------
+		//	the text in its normal size, then into the pages
 		//
-		pHandle->textLine	= lineToClear;
-		pHandle->textColumn	= 0;
+		_oled_display_render_font_text( pHandle, pFont, strText, (uint8_t *)arullSource, (usColumns + scale - 1) / scale );
 
-		//--------------------------------------------------------------
-		//	take care of the display line shift
-		//	and correct the line to clear accordingly
+		if( 1 == scale )
+		{
+			memcpy( arpDest[ 0 ], arullSource, usColumns );
+		}
+		else
+		{
+			_oled_display_spread_columns( (const uint8_t *)arullSource, scale, usPages, arpDest, usColumns );
+		}
+
+		for( uint8_t idx = 0 ; usPages > idx ; idx++ )
+		{
+			if( NULL != pHandle->pFrameBuffer )
+			{
+				pHandle->pFrameBuffer->dirtyPages |= (1 << arusPage[ idx ]);
+			}
+			else
+			{
+				_oled_display_shadow_forget( pHandle, arusPage[ idx ], x, x + usColumns );
+				_oled_display_set_position( pHandle, arusPage[ idx ], x + DISPLAY_COLUMN_OFFSET( pHandle ) );
+				_oled_display_write_data( pHandle, arpDest[ idx ], usColumns );
+
+				pHandle->positionPending = true;
+			}
+		}
+
+		_oled_display_end( pHandle, usStatsEntry );
+	}
+
+	return( (uint8_t)uiEnd );
+}
+
+
+//**************************************************************************
+//	oled_font_text_width
+//--------------------------------------------------------------------------
+//	The width of the given text in pixel columns if it is printed with
+//	the proportional font (pFont NULL: the 8x8 font).
+//
+uint16_t oled_font_text_width( const oled_font_t *pFont, const char *strText )
+{
+	const uint8_t		*pText		= (const uint8_t *)strText;
+	const oled_glyph_t	*pGlyph;
+	uint16_t			 uiWidth	= 0;
+	uint8_t				 charIdx;
+
+	while( (NULL == pFont) && (0x00 != *pText) )
+	{
+		charIdx = *pText++;
+
+		if( 0x80 <= charIdx )
+		{
+			charIdx = _oled_display_codepoint_glyph( _oled_display_utf8_decode( &pText, charIdx ) );
+		}
+
+		if( ' ' <= charIdx )
+		{
+			uiWidth += PIXELS_CHAR_WIDTH;
+		}
+	}
+
+	while( (NULL != pFont) && (0x00 != *pText) )
+	{
+		pGlyph = _oled_display_font_glyph( pFont, &pText );
+
+		if( NULL != pGlyph )
+		{
+			uiWidth += pGlyph->advance;
+		}
+	}
+
+	return( uiWidth );
+}
+
+
+//**************************************************************************
+//	oled_display_clear
+//--------------------------------------------------------------------------
+//	The function deletes all text shown on the display.
+//	Only the pages that are visible after the clear are cleared.
+//
+//	ssd1306: the visible part of the RAM is cleared in horizontal
+//	addressing mode, so the zero bytes for all pages are send as one
+//	data transaction without position commands.
+//	sh1106 / sh1107: every page is cleared with one transaction over
+//	the complete RAM width (132 / 128 bytes).
+//
+void oled_display_clear( oled_display_handle_t *pHandle )
+{
+	uint8_t	arusClearStart[ sizeof( g_arusClearStartSsd1306 ) ];
+	uint8_t	usStatsEntry;
+
+	if( _oled_display_post( pHandle, RCMD_CLEAR, 0, 0, NULL, 0 ) )
+	{
+		return;
+	}
+
+	if( pHandle->displayConnected )
+	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_CLEAR );
+
+		if( NULL != pHandle->pFrameBuffer )
+		{
+			for( uint8_t usTextLine = 0 ; usTextLine < DISPLAY_TEXT_LINES( pHandle ) ; usTextLine++ )
+			{
+				oled_display_clear_line( pHandle, usTextLine );
+			}
+		}
+		else if( CHIP_TYPE_SSD1306 == DISPLAY_CHIP_TYPE( pHandle ) )
+		{
+			memcpy( arusClearStart, g_arusClearStartSsd1306, sizeof( arusClearStart ) );
+
+			arusClearStart[ IDX_CLEAR_FIRST_COLUMN ]	= DISPLAY_COLUMN_OFFSET( pHandle );
+			arusClearStart[ IDX_CLEAR_LAST_COLUMN ]		= DISPLAY_COLUMN_OFFSET( pHandle ) + DISPLAY_WIDTH( pHandle ) - 1;
+			arusClearStart[ IDX_CLEAR_LAST_PAGE ]		= DISPLAY_TEXT_LINES( pHandle ) - 1;
+
+			_oled_display_write( pHandle, arusClearStart, sizeof( arusClearStart ) );
+
+			for( uint8_t usPage = 0 ; usPage < DISPLAY_TEXT_LINES( pHandle ) ; usPage++ )
+			{
+				_oled_display_shadow_fill( pHandle, usPage, SHADOW_BLANK );
+			}
+
+			_oled_display_write_data( pHandle, g_arusClearBuffer, DISPLAY_WIDTH( pHandle ) * DISPLAY_TEXT_LINES( pHandle ) );
+			_oled_display_write( pHandle, g_arusClearEndSsd1306, sizeof( g_arusClearEndSsd1306 ) );
+		}
+		else
+		{
+			for( uint8_t usPage = 0 ; usPage < DISPLAY_TEXT_LINES( pHandle ) ; usPage++ )
+			{
+				_oled_display_shadow_fill( pHandle, usPage, SHADOW_BLANK );
+				_oled_display_set_position( pHandle, usPage, 0 );
+				_oled_display_write_data( pHandle, g_arusClearBuffer, DISPLAY_RAM_COLUMNS( pHandle ) );
+			}
+		}
+
+		//------------------------------------------------------------------
+		//	Set the display line offset back to the default value '0'.
+		//	That means beginn to display the display with the top line.
 		//
-		lineToClear += pHandle->lineOffset;
+		pHandle->lineOffset = 0;
 
-		if( TEXT_LINES <= lineToClear )
+		if( NULL != pHandle->pFrameBuffer )
+		{
+			pHandle->pFrameBuffer->lineOffsetDirty = true;
+		}
+		else
 		{
-			lineToClear -= TEXT_LINES;
+			_oled_display_send_parameter( pHandle, OPC_DISPLAY_LINE_OFFSET, 0 );
 		}
 
-		//--------------------------------------------------------------
-		//	preparation for the command that will be send to the
-		//	display: set cursor to actual line first column
+		//------------------------------------------------------------------
+		//	set the cursor to home position
 		//
-		lineToClear &= MASK_PAGE_ADDRESS;
-		g_arusPositionCommandBuffer[ IDX_PAGE_ADDRESS ] = OPC_PAGE_ADDRESS | lineToClear;
-		g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_LOW  ] = OPC_COLUMN_ADDRESS_LOW;
-		g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_HIGH ] = OPC_COLUMN_ADDRESS_HIGH;
+		oled_display_set_cursor( pHandle, 0, 0 );
+
+		_oled_display_end( pHandle, usStatsEntry );
+	}
+}
+
+
+//**************************************************************************
+//	oled_display_clear_line
+//--------------------------------------------------------------------------
+//	The function deletes the text line at the given cursor position and
+//	sets the cursor to the bginning of that line.
+//
+void oled_display_clear_line( oled_display_handle_t *pHandle, uint8_t lineToClear )
+{
+	uint8_t	usStatsEntry;
+	uint8_t	usFirstColumn;
+	uint8_t	usColumns;
+
+	if( _oled_display_post( pHandle, RCMD_CLEAR_LINE, lineToClear, 0, NULL, 0 ) )
+	{
+		return;
+	}
+
+	if( pHandle->displayConnected )
+	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_CLEAR_LINE );
 
 		//--------------------------------------------------------------
-		//	now send the commands to position the cursor to the display
+		//	at the end of the function the cursor will be positioned to
+		//	the beginning of the line that will be cleared
 		//
-		i2c_master_write_to_device( pHandle->port, pHandle->address, g_arusPositionCommandBuffer, sizeof( g_arusPositionCommandBuffer ), 50 / portTICK_PERIOD_MS );
+		pHandle->textLine	= lineToClear;
+		pHandle->textColumn	= 0;
 
 		//--------------------------------------------------------------
-		//	split the number of bytes to be send to clear the display
-		//	to less than 31 ?? (I2C buffer size)
+		//	take care of the display line shift
+		//	and correct the line to clear accordingly
 		//
-		if( CHIP_TYPE_SSD1306 == pHandle->chipType )
+		lineToClear = _oled_display_page_of_line( pHandle, lineToClear );
+
+		if( NULL != pHandle->pFrameBuffer )
 		{
-			//------------------------------------------------------
-			//	ssd1306 has 128 pixel columns (8 x 16 = 128)
+			//----------------------------------------------------------
+			//	frame buffer mode: only clear the RAM copy
 			//
-			usLoop1End	= 8;
-			usLoop2End	= 16;
+			memset( pHandle->pFrameBuffer->image[ lineToClear ], 0x00, OLED_FRAME_BUFFER_COLUMNS );
+
+			pHandle->pFrameBuffer->dirtyPages |= (1 << lineToClear);
 		}
 		else
 		{
-			//------------------------------------------------------
-			//	sh1106 has 132 pixel columns (6 x 22 = 132)
+			//----------------------------------------------------------
+			//	clear the page with one transaction: the visible part
+			//	on the ssd1306, the complete RAM width (with the spare
+			//	columns) on the sh1106 / sh1107.
+			//	with the text shadow only the part of the page that
+			//	shows characters must be cleared (perhaps nothing)
 			//
-			usLoop1End	= 6;
-			usLoop2End	= 22;
-		}
+			if( CHIP_TYPE_SSD1306 == DISPLAY_CHIP_TYPE( pHandle ) )
+			{
+				usFirstColumn	= DISPLAY_COLUMN_OFFSET( pHandle );
+				usColumns		= DISPLAY_WIDTH( pHandle );
+			}
+			else
+			{
+				usFirstColumn	= 0;
+				usColumns		= DISPLAY_RAM_COLUMNS( pHandle );
+			}
 
-		for( uint8_t idx1 = 0 ; idx1 < usLoop1End ; idx1++ )
-		{
-			cmd = i2c_cmd_link_create();
-			i2c_master_start( cmd );
-			i2c_master_write_byte( cmd, (pHandle->address << 1) | I2C_MASTER_WRITE, true );
-			i2c_master_write_byte( cmd, PREFIX_DATA, true );
+			_oled_display_shadow_clear_span( pHandle, lineToClear, &usFirstColumn, &usColumns );
+			_oled_display_shadow_fill( pHandle, lineToClear, SHADOW_BLANK );
 
-			for( uint8_t idx2 = 0 ; idx2 < usLoop2End ; idx2++ )
+			if( 0 < usColumns )
 			{
-				i2c_master_write_byte( cmd, 0x00, true );
+				_oled_display_set_position( pHandle, lineToClear, usFirstColumn );
+				_oled_display_write_data( pHandle, g_arusClearBuffer, usColumns );
 			}
 
-			i2c_master_stop( cmd );
-			i2c_master_cmd_begin( pHandle->port, cmd, 50 / portTICK_PERIOD_MS );
-			i2c_cmd_link_delete( cmd );
+			//----------------------------------------------------------
+			//	the cursor is at the first text position of this line,
+			//	the RAM pointer will be set with the next output
+			//
+			pHandle->positionPending = true;
 		}
 
-		//--------------------------------------------------------------
-		//	set cursor to first text position of this line
-		//
-		g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_LOW  ] =	  OPC_COLUMN_ADDRESS_LOW
-																	| pHandle->displayColumnOffset;
+		_oled_display_end( pHandle, usStatsEntry );
+	}
+}
+
+
+//**************************************************************************
+//	oled_display_clear_actual_line
+//--------------------------------------------------------------------------
+//	The function deletes the text line of the actual cursor position and
+//	sets the cursor to the beginning of that line.
+//
+void oled_display_clear_actual_line( oled_display_handle_t *pHandle )
+{
+	uint8_t	usStatsEntry;
 
-		i2c_master_write_to_device( pHandle->port, pHandle->address, g_arusPositionCommandBuffer, sizeof( g_arusPositionCommandBuffer ), 50 / portTICK_PERIOD_MS );
+	if( _oled_display_post( pHandle, RCMD_CLEAR_ACTUAL_LINE, 0, 0, NULL, 0 ) )
+	{
+		return;
 	}
+
+	usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_CLEAR_LINE );
+	oled_display_clear_line( pHandle, pHandle->textLine );
+	_oled_display_end( pHandle, usStatsEntry );
 }
 
 
@@ -630,18 +1506,24 @@ void oled_display_clear_line( oled_display_handle_t *pHandle, uint8_t lineToClea
 //	oled_display_set_cursor
 //--------------------------------------------------------------------------
 //	The function sets the cursor to the given line and column
-//	valid values are:
+//	valid values are (128x64):
 //		line:	0 -  7
 //		column:	0 - 15
+//	see oled_display_max_text_lines() / oled_display_max_column_lines()
 //
 void oled_display_set_cursor( oled_display_handle_t *pHandle, uint8_t textLine, uint8_t textColumn )
 {
-	uint8_t		usAddressLow;
-	uint8_t		usAddressHigh;
+	uint8_t	usStatsEntry;
 
+	if( _oled_display_post( pHandle, RCMD_SET_CURSOR, textLine, textColumn, NULL, 0 ) )
+	{
+		return;
+	}
 
-	if( pHandle->displayConnected && (TEXT_LINES > textLine) && (TEXT_COLUMNS > textColumn) )
+	if( pHandle->displayConnected && (DISPLAY_TEXT_LINES( pHandle ) > textLine) && (DISPLAY_TEXT_COLUMNS( pHandle ) > textColumn) )
 	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_SET_CURSOR );
+
 		//------------------------------------------------------------------
 		//	store the new cursor position
 		//
@@ -649,43 +1531,19 @@ void oled_display_set_cursor( oled_display_handle_t *pHandle, uint8_t textLine,
 		pHandle->textColumn	= textColumn;
 
 		//------------------------------------------------------------------
-		//	take care of the display line shift
-		//	and correct the text line accordingly
-		//
-		textLine += pHandle->lineOffset;
-
-		if( TEXT_LINES <= textLine )
-		{
-			textLine -= TEXT_LINES;
-		}
-
-		//------------------------------------------------------------------
-		//	preparation for the command that will be send to the display
-		//
-		textLine &= MASK_PAGE_ADDRESS;
-		g_arusPositionCommandBuffer[ IDX_PAGE_ADDRESS ] = OPC_PAGE_ADDRESS | textLine;
-
-		//------------------------------------------------------------------
-		//	calculate bit column
-		//	the calculated bit column is the start column of a character
+		//	the RAM pointer of the display is set with the next output
+		//	(see _oled_display_sync_cursor), so setting the cursor to
+		//	characters that are not changed sends nothing.
+		//	In frame buffer mode the characters are drawn into the RAM
+		//	copy at the stored cursor position anyway.
 		//
-		textColumn <<= 3;		//	multiply by 8
-		textColumn  += pHandle->displayColumnOffset;
+		pHandle->positionPending = true;
 
-		//------------------------------------------------------------------
-		//	preparation for the commands that will be send to the display
-		//
-		usAddressLow	 = textColumn & MASK_COLUMN_ADDRESS_LOW;
-		g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_LOW  ] = OPC_COLUMN_ADDRESS_LOW | usAddressLow;
-
-		usAddressHigh	 = textColumn & MASK_COLUMN_ADDRESS_HIGH;
-		usAddressHigh >>= 4;
-		g_arusPositionCommandBuffer[ IDX_COLUMN_ADDRESS_HIGH ] = OPC_COLUMN_ADDRESS_HIGH | usAddressHigh;
+#if OLED_DISPLAY_STATS
+		pHandle->positionEntry = pHandle->statsEntry;
+#endif
 
-		//------------------------------------------------------------------
-		//	now send the commands to position the cursor to the display
-		//
-		i2c_master_write_to_device( pHandle->port, pHandle->address, g_arusPositionCommandBuffer, sizeof( g_arusPositionCommandBuffer ), 50 / portTICK_PERIOD_MS );
+		_oled_display_end( pHandle, usStatsEntry );
 	}
 }
 
@@ -698,8 +1556,17 @@ void oled_display_set_cursor( oled_display_handle_t *pHandle, uint8_t textLine,
 //
 void oled_display_set_inverse( oled_display_handle_t *pHandle, bool inverse )
 {
+	uint8_t	usStatsEntry;
+
+	if( _oled_display_post( pHandle, RCMD_SET_INVERSE, inverse, 0, NULL, 0 ) )
+	{
+		return;
+	}
+
 	if( pHandle->displayConnected )
 	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_OTHER );
+
 		if( inverse )
 		{
 			_oled_display_send_opcode( pHandle, OPC_MODE_INVERSE );
@@ -708,6 +1575,8 @@ void oled_display_set_inverse( oled_display_handle_t *pHandle, bool inverse )
 		{
 			_oled_display_send_opcode( pHandle, OPC_MODE_NORMAL );
 		}
+
+		_oled_display_end( pHandle, usStatsEntry );
 	}
 }
 
@@ -715,13 +1584,33 @@ void oled_display_set_inverse( oled_display_handle_t *pHandle, bool inverse )
 //**************************************************************************
 //	oled_display_flip
 //--------------------------------------------------------------------------
-//	This function will turn the output on the display by 180 degree
-//	and clears the display.
+//	This function will turn the output on the display by 180 degree.
+//
+//	The segment remap and the COM scan direction turn the whole RAM
+//	(together with the line offset used for scrolling), so the content
+//	of the display is kept and nothing has to be send again.
+//	If the panel is smaller than the RAM (e.g. the sh1106 with 132
+//	columns), the column offset is counted from the other end of the
+//	RAM with the segment remap. If the offset changes by this (i.e. the
+//	panel is not centered) the content must be moved:
+//	-	with a frame buffer all pages are send again at once
+//	-	without a frame buffer the display is cleared
 //
 void oled_display_flip( oled_display_handle_t *pHandle, bool flip )
 {
-	if( pHandle->displayConnected )
+	uint8_t	usStatsEntry;
+	uint8_t	usOldOffset;
+	uint8_t	usOffset;
+
+	if( _oled_display_post( pHandle, RCMD_FLIP, flip, 0, NULL, 0 ) )
+	{
+		return;
+	}
+
+	if( pHandle->displayConnected && (flip != pHandle->flipped) )
 	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_OTHER );
+
 		if( flip )
 		{
 			_oled_display_send_opcode( pHandle, OPC_SEG_ROTATION_LEFT );
@@ -732,204 +1621,3111 @@ void oled_display_flip( oled_display_handle_t *pHandle, bool flip )
 			_oled_display_send_opcode( pHandle, OPC_SEG_ROTATION_RIGHT );
 			_oled_display_send_opcode( pHandle, OPC_OUTPUT_SCAN_NORMAL );
 		}
-		
-		oled_display_clear( pHandle );
+
+		usOldOffset			= DISPLAY_COLUMN_OFFSET( pHandle );
+		usOffset			= DISPLAY_SPARE_COLUMNS( pHandle ) - usOldOffset;
+		pHandle->flipped	= flip;
+
+		if( usOffset != usOldOffset )
+		{
+			pHandle->displayColumnOffset = usOffset;
+
+			if( NULL != pHandle->pFrameBuffer )
+			{
+				pHandle->pFrameBuffer->dirtyPages = _oled_display_visible_pages( pHandle );
+#if OLED_FRAME_BUFFER_SHADOW
+				pHandle->pFrameBuffer->validPages = 0;
+#endif
+				oled_display_flush( pHandle );
+			}
+			else
+			{
+				oled_display_clear( pHandle );
+			}
+		}
+
+		_oled_display_end( pHandle, usStatsEntry );
 	}
 }
 
 
 //**************************************************************************
-//	SetDisplayColumnOffset
+//	oled_display_start_marquee
 //--------------------------------------------------------------------------
-//	With this function it is possible to adjust the display in left right
-//	direction in a small range.
-//
-//	Background:
-//	The OLED display with sh1106 chip has 132 columns of OLED pixels.
-//	The font I use has 8 pixels per character.
-//	So 128 pixels are used for one text line. This leads to a left over
-//	of 4 pixels that can be used to adjust the text output on the display.
+//	The text lines firstLine ... lastLine are scrolled by the controller
+//	one column every interval frames (see scroll_interval_t), the
+//	columns that leave the display on one side come in on the other.
+//	While the marquee runs nothing is send over the bus.
+//	With MARQUEE_UP_LEFT and MARQUEE_UP_RIGHT the whole panel is also
+//	scrolled up one row with every step.
 //
-//	The OLED disable with ssd1306 chip has 128 columns of OLED pixels.
-//	So the column offset is allways '0'.
+//	Only the ssd1306 has a scroll engine, for the other chips and for
+//	lines that are not in one piece of the RAM (after PM_SCROLL_LINE has
+//	scrolled the display) nothing is done.
+//	With a frame buffer it is flushed before the marquee starts.
+//	The controller scrolls all columns of its RAM: on a panel narrower
+//	than the RAM the columns beside the panel in the marquee lines are
+//	cleared before, so they come in dark.
+//	Text that is printed into the lines of a running marquee ends up at
+//	the actual scroll position.
 //
-void oled_display_set_display_column_offset( oled_display_handle_t *pHandle, uint8_t offset )
+void oled_display_start_marquee(	oled_display_handle_t	*pHandle,
+									uint8_t					 firstLine,
+									uint8_t					 lastLine,
+									marquee_direction_t		 direction,
+									scroll_interval_t		 interval	)
 {
-//-----------------------------------------------------------------------
-//	suppress compiler warning
-//
-//	if( (DISPLAY_COLUMN_OFFSET_MIN <= usOffset) && (DISPLAY_COLUMN_OFFSET_MAX >= usOffset) )
-//
-	if( DISPLAY_COLUMN_OFFSET_MAX >= offset )
+	uint8_t		arusParameter[ 2 ]	= { (uint8_t)direction, (uint8_t)interval };
+	uint8_t		arusCommand[ MARQUEE_COMMAND_SIZE ];
+	uint8_t		usStatsEntry;
+	uint8_t		usFirstPage;
+	uint8_t		usLastPage;
+	uint8_t		usEndColumn;
+	size_t		length				= 0;
+	bool		bLeft;
+
+	if( _oled_display_post( pHandle, RCMD_START_MARQUEE, firstLine, lastLine, arusParameter, sizeof( arusParameter ) ) )
+	{
+		return;
+	}
+
+	if(		!pHandle->displayConnected
+		||	(CHIP_TYPE_SSD1306 != DISPLAY_CHIP_TYPE( pHandle ))
+		||	(firstLine > lastLine)
+		||	(DISPLAY_TEXT_LINES( pHandle ) <= lastLine)
+		||	(MARQUEE_UP_RIGHT < direction)
+		||	(SCROLL_INTERVAL_2_FRAMES < interval) )
+	{
+		return;
+	}
+
+	usFirstPage	= _oled_display_page_of_line( pHandle, firstLine );
+	usLastPage	= _oled_display_page_of_line( pHandle, lastLine );
+
+	if( usFirstPage > usLastPage )
+	{
+		return;
+	}
+
+	usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_OTHER );
+
+	if( 0 != pHandle->marqueePages )
+	{
+		oled_display_stop_marquee( pHandle );
+	}
+
+	if( NULL != pHandle->pFrameBuffer )
+	{
+		oled_display_flush( pHandle );
+	}
+
+	//----------------------------------------------------------------------
+	//	clear the RAM columns left and right of a narrow panel, otherwise
+	//	what they hold (since power on) moves through the panel
+	//
+	usEndColumn = DISPLAY_COLUMN_OFFSET( pHandle ) + DISPLAY_WIDTH( pHandle );
+
+	for( uint8_t usPage = usFirstPage ; usLastPage >= usPage ; usPage++ )
 	{
-		if( CHIP_TYPE_SSD1306 == pHandle->chipType )
+		if( 0 < DISPLAY_COLUMN_OFFSET( pHandle ) )
 		{
-			pHandle->displayColumnOffset = 0;
+			_oled_display_set_position( pHandle, usPage, 0 );
+			_oled_display_write_data( pHandle, g_arusClearBuffer, DISPLAY_COLUMN_OFFSET( pHandle ) );
 		}
-		else
+
+		if( DISPLAY_RAM_COLUMNS( pHandle ) > usEndColumn )
 		{
-			pHandle->displayColumnOffset = offset;
+			_oled_display_set_position( pHandle, usPage, usEndColumn );
+			_oled_display_write_data( pHandle, g_arusClearBuffer, DISPLAY_RAM_COLUMNS( pHandle ) - usEndColumn );
 		}
+
+		pHandle->positionPending = true;
 	}
-}
 
+	//----------------------------------------------------------------------
+	//	the segment remap of a flipped display mirrors the direction
+	//
+	bLeft = (MARQUEE_LEFT == direction) || (MARQUEE_UP_LEFT == direction);
+	bLeft = bLeft != pHandle->flipped;
 
-//**************************************************************************
-//	_oled_display_init_sh1106 (local)
-//--------------------------------------------------------------------------
-//	This function will send the initialize sequence to a display with
-//	a ssd1306 chip type.
-//
-void _oled_display_init_sh1106(  oled_display_handle_t *pHandle )
-{
-	_oled_display_send_opcode( pHandle, OPC_DISPLAY_OFF );
-	_oled_display_send_opcode( pHandle, OPC_ENTIRE_DISPLAY_NORMAL );
-	_oled_display_send_parameter( pHandle, OPC_CLK_DIV_OSC_FREQ, (OSC_FREQ_VARIATION_P_M_0 | CLOCK_DIV_RATIO_1) );
-	_oled_display_send_parameter( pHandle, OPC_SET_MULTIPLEX_RATIO, 0x3F );
-	_oled_display_send_parameter( pHandle, OPC_DISPLAY_LINE_OFFSET, 0 );
-	_oled_display_send_opcode( pHandle, OPC_DISPLAY_START_LINE );
-	_oled_display_send_parameter( pHandle, OPC_CHARGE_PUMP_SETTING, 0x14 );
-	_oled_display_send_parameter( pHandle, OPC_DC_DC_CONTROL_MODE, DC_DC_ON );
-	_oled_display_send_parameter( pHandle, OPC_DIS_PRE_CHARGE_PERIOD, (DIS_CHARGE_PERIOD_DCLK_2 | PRE_CHARGE_PERIOD_DCLK_2) );
-	_oled_display_send_parameter( pHandle, OPC_SET_VCOM_DESELECT_LEVEL, 0x35 );
-	_oled_display_send_opcode( pHandle, OPC_DC_DC_PUMP_VOLTAGE_8_0 );
-	_oled_display_send_parameter( pHandle, OPC_SET_CONTRAST, 0xFF );
-	_oled_display_send_opcode( pHandle, OPC_MODE_NORMAL );
-	_oled_display_send_parameter( pHandle, OPC_SET_COM_PINS, 0x12 );
+	//----------------------------------------------------------------------
+	//	the scroll setup must not be changed while a scroll is active,
+	//	so deactivate, setup and activate are send in one transaction
+	//
+	arusCommand[ length++ ] = PREFIX_LAST_COMMAND;
+	arusCommand[ length++ ] = OPC_DEACTIVATE_SCROLL;
+
+	if( MARQUEE_UP_LEFT <= direction )
+	{
+		arusCommand[ length++ ] = OPC_VERTICAL_SCROLL_AREA;
+		arusCommand[ length++ ] = 0;
+		arusCommand[ length++ ] = DISPLAY_TEXT_LINES( pHandle ) * PIXELS_CHAR_HEIGHT;
+		arusCommand[ length++ ] = bLeft ? OPC_VERTICAL_LEFT_SCROLL : OPC_VERTICAL_RIGHT_SCROLL;
+		arusCommand[ length++ ] = MARQUEE_DUMMY_BYTE;
+		arusCommand[ length++ ] = usFirstPage;
+		arusCommand[ length++ ] = (uint8_t)interval;
+		arusCommand[ length++ ] = usLastPage;
+		arusCommand[ length++ ] = MARQUEE_VERTICAL_OFFSET;
+	}
+	else
+	{
+		arusCommand[ length++ ] = bLeft ? OPC_LEFT_SCROLL : OPC_RIGHT_SCROLL;
+		arusCommand[ length++ ] = MARQUEE_DUMMY_BYTE;
+		arusCommand[ length++ ] = usFirstPage;
+		arusCommand[ length++ ] = (uint8_t)interval;
+		arusCommand[ length++ ] = usLastPage;
+		arusCommand[ length++ ] = MARQUEE_DUMMY_BYTE;
+		arusCommand[ length++ ] = MARQUEE_LAST_COLUMN;
+	}
+
+	arusCommand[ length++ ] = OPC_ACTIVATE_SCROLL;
+
+	_oled_display_write( pHandle, arusCommand, length );
+
+	pHandle->marqueePages = ((2 << usLastPage) - 1) & ~((1 << usFirstPage) - 1);
+
+	_oled_display_end( pHandle, usStatsEntry );
 }
 
 
 //**************************************************************************
-//	_oled_display_init_ssd1306 (local)
+//	oled_display_stop_marquee
 //--------------------------------------------------------------------------
-//	This function will send the initialize sequence to a display with
-//	a ssd1306 chip type.
+//	Stop the marquee. The controller has moved the content of the RAM,
+//	so the scrolled lines are not at their places any longer:
+//	-	with a frame buffer these lines are send again at once
+//	-	without a frame buffer they keep the scrolled content until
+//		they are printed again
 //
-void _oled_display_init_ssd1306( oled_display_handle_t *pHandle )
+void oled_display_stop_marquee( oled_display_handle_t *pHandle )
 {
-	_oled_display_send_opcode( pHandle, OPC_DISPLAY_OFF );
-	_oled_display_send_parameter( pHandle, OPC_CLK_DIV_OSC_FREQ, (OSC_FREQ_VARIATION_P_15 | CLOCK_DIV_RATIO_1) );
-	_oled_display_send_parameter( pHandle, OPC_SET_MULTIPLEX_RATIO, 0x3F );
-	_oled_display_send_parameter( pHandle, OPC_DISPLAY_LINE_OFFSET, 0 );
-	_oled_display_send_opcode( pHandle, OPC_DISPLAY_START_LINE );
-	_oled_display_send_parameter( pHandle, OPC_CHARGE_PUMP_SETTING, 0x14 );
-	_oled_display_send_parameter( pHandle, OPC_MEMORY_ADR_MODE, ADR_MODE_PAGE );
-	_oled_display_send_parameter( pHandle, OPC_SET_COM_PINS, 0x12 );
-	_oled_display_send_parameter( pHandle, OPC_SET_CONTRAST, 0xCF );
-//	_oled_display_send_parameter( pHandle, OPC_DIS_PRE_CHARGE_PERIOD, (DIS_CHARGE_PERIOD_DCLK_2 | PRE_CHARGE_PERIOD_DCLK_2) );
-	_oled_display_send_parameter( pHandle, OPC_DIS_PRE_CHARGE_PERIOD, (DIS_CHARGE_PERIOD_DCLK_15 | PRE_CHARGE_PERIOD_DCLK_1) );
-	_oled_display_send_parameter( pHandle, OPC_SET_VCOM_DESELECT_LEVEL, 0x40 );
-//	_oled_display_send_opcode( pHandle, OPC_DEACTIVATE_SCROLL );	//	I think this is not needed, because we are in Page mode
-	_oled_display_send_opcode( pHandle, OPC_ENTIRE_DISPLAY_NORMAL );
-	_oled_display_send_opcode( pHandle, OPC_MODE_NORMAL );
-}
-
+	uint8_t	usStatsEntry;
+
+	if( _oled_display_post( pHandle, RCMD_STOP_MARQUEE, 0, 0, NULL, 0 ) )
+	{
+		return;
+	}
+
+	if( pHandle->displayConnected && (0 != pHandle->marqueePages) )
+	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_OTHER );
+
+		_oled_display_send_opcode( pHandle, OPC_DEACTIVATE_SCROLL );
+
+		for( uint8_t usPage = 0 ; DISPLAY_RAM_PAGES( pHandle ) > usPage ; usPage++ )
+		{
+			if( pHandle->marqueePages & (1 << usPage) )
+			{
+				_oled_display_shadow_fill( pHandle, usPage, SHADOW_UNKNOWN );
+			}
+		}
+
+		if( NULL != pHandle->pFrameBuffer )
+		{
+			pHandle->pFrameBuffer->dirtyPages |= pHandle->marqueePages;
+#if OLED_FRAME_BUFFER_SHADOW
+			pHandle->pFrameBuffer->validPages &= ~pHandle->marqueePages;
+#endif
+			oled_display_flush( pHandle );
+		}
+
+		pHandle->marqueePages = 0;
+
+		_oled_display_end( pHandle, usStatsEntry );
+	}
+}
+
 
 //**************************************************************************
-//	_oled_display_send_opcode (local)
+//	oled_display_set_inverse_font
 //--------------------------------------------------------------------------
-//	This function will send a one byte command to the display.
-//	A one byte command exists of
-//		-	1 byte prefix
-//		-	1 byte command code
+//	All following characters will be printed inverse (or normal again).
 //
-void _oled_display_send_opcode( oled_display_handle_t *pHandle, uint8_t opCode )
+void oled_display_set_inverse_font( oled_display_handle_t *pHandle, bool bInverse )
 {
-	g_displayCommandBuffer[ 1 ] = opCode;
+	if( _oled_display_post( pHandle, RCMD_SET_INVERSE_FONT, bInverse, 0, NULL, 0 ) )
+	{
+		return;
+	}
 
-	i2c_master_write_to_device( pHandle->port, pHandle->address, g_displayCommandBuffer, 2, 50 / portTICK_PERIOD_MS );
+	pHandle->inverse = bInverse;
 }
 
 
 //**************************************************************************
-//	_oled_display_send_parameter (local)
+//	oled_display_set_glyph_variant
 //--------------------------------------------------------------------------
-//	This function will send a two byte command to the display.
-//	A two byte command exists of
-//		-	1 byte prefix
-//		-	1 byte command code
-//		-	1 byte parameter
+//	All following characters will be printed with the given variant of
+//	the font (see glyph_variant_t). The inverse font can be used together
+//	with every variant.
 //
-void _oled_display_send_parameter( oled_display_handle_t *pHandle, uint8_t opCode, uint8_t parameter )
+void oled_display_set_glyph_variant( oled_display_handle_t *pHandle, glyph_variant_t glyphVariant )
 {
-	g_displayCommandBuffer[ 1 ] = opCode;
-	g_displayCommandBuffer[ 2 ] = parameter;
+	if( _oled_display_post( pHandle, RCMD_SET_GLYPH_VARIANT, (uint8_t)glyphVariant, 0, NULL, 0 ) )
+	{
+		return;
+	}
 
-	i2c_master_write_to_device( pHandle->port, pHandle->address, g_displayCommandBuffer, 3, 50 / portTICK_PERIOD_MS );
+	if( GLYPH_ROTATED >= glyphVariant )
+	{
+		pHandle->glyphVariant = glyphVariant;
+	}
 }
 
 
 //**************************************************************************
-//	_oled_display_next_line (local)
+//	oled_display_set_print_mode
 //--------------------------------------------------------------------------
-//	The function will set the cursor to the beginning of the 'next print
-//	line'. Which will be the 'next print line' depends on the print mode
-//	and the function parameter.
+//	Set the print mode for all following text output (see print_mode_t).
 //
-void _oled_display_next_line( oled_display_handle_t *pHandle, bool shiftLine )
+void oled_display_set_print_mode( oled_display_handle_t *pHandle, print_mode_t printMode )
 {
-	pHandle->textColumn	= 0;
+	if( _oled_display_post( pHandle, RCMD_SET_PRINT_MODE, (uint8_t)printMode, 0, NULL, 0 ) )
+	{
+		return;
+	}
 
-	if( PM_SCROLL_LINE == pHandle->printMode )
+	pHandle->printMode = printMode;
+}
+
+
+//**************************************************************************
+//	oled_display_set_smooth_scroll
+//--------------------------------------------------------------------------
+//	With stepMs > 0 the display scrolls smoothly in the print mode
+//	PM_SCROLL_LINE: one pixel row every stepMs milliseconds (a step
+//	should last at least one frame of the display, about 10 ms).
+//	Per scrolled line only the new last line is cleared (one page),
+//	the steps are single commands.
+//	The print function waits 8 * stepMs for every scrolled line, so
+//	the asynchronous output (see oled_display_start_async) should be
+//	used to not block the caller.
+//	With a frame buffer the display still scrolls by whole lines.
+//	With 0 the display scrolls by whole lines again.
+//
+void oled_display_set_smooth_scroll( oled_display_handle_t *pHandle, uint8_t stepMs )
+{
+	if( _oled_display_post( pHandle, RCMD_SET_SMOOTH_SCROLL, stepMs, 0, NULL, 0 ) )
 	{
-		//------------------------------------------------------------------
-		//	PrintMode is scroll line
-		//	if		the cursor is in the last line of the display,
-		//	then	stay there and shift all other lines one up
-		//	else	set cursor to the next line
-		//
-		if( (TEXT_LINES - 1) == pHandle->textLine )
+		return;
+	}
+
+	pHandle->smoothScrollMs = stepMs;
+}
+
+
+//**************************************************************************
+//	oled_display_set_scroll_region
+//--------------------------------------------------------------------------
+//	In the print mode PM_SCROLL_LINE only the lines firstLine ...
+//	lastLine are scrolled, e.g. to keep a title line and a status line.
+//	A new line in the last line of the region scrolls the region, a new
+//	line outside of the region just goes to the next line.
+//	The complete display (the default) is scrolled by the controller,
+//	the lines of a smaller region must be send again (see
+//	_oled_display_scroll_region), this needs a frame buffer or the text
+//	shadow. The smooth scroll is only done for the complete display.
+//	Invalid regions are ignored.
+//
+void oled_display_set_scroll_region( oled_display_handle_t *pHandle, uint8_t firstLine, uint8_t lastLine )
+{
+	if( _oled_display_post( pHandle, RCMD_SET_SCROLL_REGION, firstLine, lastLine, NULL, 0 ) )
+	{
+		return;
+	}
+
+	if( (firstLine <= lastLine) && (DISPLAY_TEXT_LINES( pHandle ) > lastLine) )
+	{
+		pHandle->scrollFirstLine	= firstLine;
+		pHandle->scrollLastLine		= lastLine;
+	}
+}
+
+
+//**************************************************************************
+//	SetDisplayColumnOffset
+//--------------------------------------------------------------------------
+//	With this function it is possible to adjust the display in left right
+//	direction in a small range.
+//
+//	Background:
+//	The OLED display with sh1106 chip has 132 columns of OLED pixels.
+//	The font I use has 8 pixels per character.
+//	So 128 pixels are used for one text line. This leads to a left over
+//	of 4 pixels that can be used to adjust the text output on the display.
+//
+//	In general the offset can be 0 ... (RAM columns - panel width),
+//	so the ssd1306 with a 128 pixel panel has allways the offset '0'.
+//	Offsets out of this range are ignored.
+//
+void oled_display_set_display_column_offset( oled_display_handle_t *pHandle, uint8_t offset )
+{
+	uint8_t	usStatsEntry;
+
+	if( _oled_display_post( pHandle, RCMD_SET_COLUMN_OFFSET, offset, 0, NULL, 0 ) )
+	{
+		return;
+	}
+
+	if( DISPLAY_COLUMN_OFFSET_ADJUSTABLE && (DISPLAY_SPARE_COLUMNS( pHandle ) >= offset) )
+	{
+		usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_OTHER );
+
+		if( pHandle->flipped )
 		{
-			_oled_display_shift_display_one_line( pHandle );
+			//--------------------------------------------------------------
+			//	mirrored RAM: count the offset from the other end
+			//
+			pHandle->displayColumnOffset = DISPLAY_SPARE_COLUMNS( pHandle ) - offset;
 		}
 		else
 		{
-			pHandle->textLine++;
+			pHandle->displayColumnOffset = offset;
 		}
-	}
-	else if( shiftLine || (PM_OVERWRITE_NEXT_LINE == pHandle->printMode) )
-	{
+
 		//------------------------------------------------------------------
-		//	if PrintMode is overwrite next line or bShiftLine is 'true'
-		//	set cursor to the next line
+		//	the image has moved, so the display does not show the image
+		//	of the frame buffer or the text shadow any longer
 		//
-		pHandle->textLine++;
+		_oled_display_shadow_invalidate( pHandle );
+
+		pHandle->positionPending = true;
+
+		if( NULL != pHandle->pFrameBuffer )
+		{
+			pHandle->pFrameBuffer->dirtyPages = _oled_display_visible_pages( pHandle );
+#if OLED_FRAME_BUFFER_SHADOW
+			pHandle->pFrameBuffer->validPages = 0;
+#endif
+		}
+
+		_oled_display_end( pHandle, usStatsEntry );
 	}
+}
 
-	//----------------------------------------------------------------------
-	//	check if the cursor is set to the allowed line range
-	//
-	if( TEXT_LINES <= pHandle->textLine )
+
+//**************************************************************************
+//	oled_display_set_frame_buffer
+//--------------------------------------------------------------------------
+//	With a frame buffer all drawing functions (print, clear, clear line,
+//	scroll) only change the RAM copy of the display. Nothing is send to
+//	the display until oled_display_flush() is called, which will send
+//	only the pages that have been changed.
+//	The frame buffer is cleared and all visible pages are marked as
+//	changed, so the first flush will show its content on the display.
+//	With NULL the frame buffer will be flushed one last time and then
+//	removed, all following functions will send directly to the display.
+//
+void oled_display_set_frame_buffer( oled_display_handle_t *pHandle, oled_frame_buffer_t *pFrameBuffer )
+{
+	uint8_t	usStatsEntry;
+
+	if( _oled_display_post( pHandle, RCMD_SET_FRAME_BUFFER, 0, 0, &pFrameBuffer, sizeof( pFrameBuffer ) ) )
 	{
-		pHandle->textLine = 0;
+		return;
 	}
 
+	usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_OTHER );
+
 	//----------------------------------------------------------------------
-	//	now set the cursor to the new position and
-	//	if required clear the line
+	//	the frame buffer will overwrite the text on the display
 	//
-	oled_display_set_cursor( pHandle, pHandle->textLine, pHandle->textColumn );
+	_oled_display_shadow_invalidate( pHandle );
 
-	if( PM_OVERWRITE_NEXT_LINE < pHandle->printMode )
+	if( NULL != pFrameBuffer )
 	{
-		oled_display_clear_actual_line( pHandle );
+		memset( pFrameBuffer->image, 0x00, sizeof( pFrameBuffer->image ) );
+
+		pFrameBuffer->dirtyPages		= _oled_display_visible_pages( pHandle );
+		pFrameBuffer->lineOffsetDirty	= true;
+#if OLED_FRAME_BUFFER_SHADOW
+		pFrameBuffer->validPages		= 0;
+#endif
+		pHandle->pFrameBuffer			= pFrameBuffer;
+	}
+	else if( NULL != pHandle->pFrameBuffer )
+	{
+		oled_display_flush( pHandle );
+
+		pHandle->pFrameBuffer = NULL;
+
+		//------------------------------------------------------------------
+		//	the RAM pointer of the display is somewhere,
+		//	so set it back to the cursor position with the next output
+		//
+		pHandle->positionPending = true;
 	}
+
+	_oled_display_end( pHandle, usStatsEntry );
 }
 
 
 //**************************************************************************
-//	_oled_display_shift_display_one_line (local)
+//	oled_display_flush
 //--------------------------------------------------------------------------
-//	Die Funktion
+//	Send all pages of the frame buffer that have been changed since the
+//	last flush.
+//	With OLED_FRAME_BUFFER_SHADOW only the changed column spans of a page
+//	are send, otherwise the complete page is send as one transaction.
+//	The function returns the number of bytes that have been send over
+//	the bus (address bytes included). With asynchronous output the flush
+//	is only queued and the function returns 0.
 //
-void _oled_display_shift_display_one_line( oled_display_handle_t *pHandle )
+uint32_t oled_display_flush( oled_display_handle_t *pHandle )
 {
-	pHandle->lineOffset++;
-	
-	if( TEXT_LINES <= pHandle->lineOffset )
+	oled_frame_buffer_t	*pFrameBuffer;
+	uint32_t			 ulBytes		= 0;
+	uint8_t				 usStatsEntry;
+
+
+	if( _oled_display_post( pHandle, RCMD_FLUSH, 0, 0, NULL, 0 ) )
 	{
-		pHandle->lineOffset = 0;
+		return( 0 );
+	}
+
+	usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_FLUSH );
+
+	pFrameBuffer = pHandle->pFrameBuffer;
+
+	if( pHandle->displayConnected && (NULL != pFrameBuffer) )
+	{
+		for( uint8_t usPage = 0 ; OLED_FRAME_BUFFER_PAGES > usPage ; usPage++ )
+		{
+			if( 0 == (pFrameBuffer->dirtyPages & (1 << usPage)) )
+			{
+				continue;
+			}
+
+#if OLED_FRAME_BUFFER_SHADOW
+			if( pFrameBuffer->validPages & (1 << usPage) )
+			{
+				ulBytes += _oled_display_flush_page_diff( pHandle, usPage );
+
+				continue;
+			}
+
+			pFrameBuffer->validPages |= (1 << usPage);
+#endif
+
+			ulBytes += _oled_display_flush_span( pHandle, usPage, 0, DISPLAY_WIDTH( pHandle ) - 1 );
+		}
+
+		pFrameBuffer->dirtyPages = 0;
+
+		//------------------------------------------------------------------
+		//	the line offset is send after the data, so a scrolled display
+		//	will show the new content at once
+		//
+		if( pFrameBuffer->lineOffsetDirty )
+		{
+			_oled_display_send_parameter( pHandle, OPC_DISPLAY_LINE_OFFSET, (pHandle->lineOffset << 3) );
+
+			pFrameBuffer->lineOffsetDirty	 = false;
+			ulBytes							+= BUS_BYTES_PARAMETER;
+		}
+	}
+
+	_oled_display_end( pHandle, usStatsEntry );
+
+	return( ulBytes );
+}
+
+
+//**************************************************************************
+//	oled_display_draw_pixel
+//--------------------------------------------------------------------------
+//	The drawing functions change the pixels in the frame buffer, the
+//	next oled_display_flush() sends the changed pages (with
+//	OLED_FRAME_BUFFER_SHADOW only the changed columns).
+//	Without frame buffer nothing is drawn: the display RAM can not be
+//	read, so a single pixel of a page byte can not be changed.
+//	The coordinates are the pixels of the panel, 0 / 0 is the top left
+//	pixel. Everything outside of the panel is cut, a shape may start
+//	left of or above the panel.
+//	op sets, clears or inverts the pixels of the shape.
+//
+void oled_display_draw_pixel( oled_display_handle_t *pHandle, int16_t x, int16_t y, pixel_op_t op )
+{
+	const int16_t	arCoord[ DRAW_COORDS ] = { x, y, 1, 1 };
+
+	_oled_display_draw( pHandle, DRAW_FILL, arCoord, op );
+}
+
+
+//**************************************************************************
+//	oled_display_draw_hline
+//--------------------------------------------------------------------------
+//	Draw a horizontal line of 'width' pixels from x / y to the right.
+//
+void oled_display_draw_hline( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t width, pixel_op_t op )
+{
+	const int16_t	arCoord[ DRAW_COORDS ] = { x, y, width, 1 };
+
+	_oled_display_draw( pHandle, DRAW_FILL, arCoord, op );
+}
+
+
+//**************************************************************************
+//	oled_display_draw_vline
+//--------------------------------------------------------------------------
+//	Draw a vertical line of 'height' pixels from x / y down.
+//
+void oled_display_draw_vline( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t height, pixel_op_t op )
+{
+	const int16_t	arCoord[ DRAW_COORDS ] = { x, y, 1, height };
+
+	_oled_display_draw( pHandle, DRAW_FILL, arCoord, op );
+}
+
+
+//**************************************************************************
+//	oled_display_draw_line
+//--------------------------------------------------------------------------
+//	Draw a line from x0 / y0 to x1 / y1 (both ends included) with the
+//	Bresenham algorithm.
+//
+void oled_display_draw_line( oled_display_handle_t *pHandle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, pixel_op_t op )
+{
+	const int16_t	arCoord[ DRAW_COORDS ] = { x0, y0, x1, y1 };
+
+	_oled_display_draw( pHandle, DRAW_LINE, arCoord, op );
+}
+
+
+//**************************************************************************
+//	oled_display_draw_rect
+//--------------------------------------------------------------------------
+//	Draw the border of a rectangle, x / y is the top left pixel.
+//	Every pixel of the border is drawn once, so PIXEL_XOR can be used
+//	to remove it again.
+//
+void oled_display_draw_rect( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t width, int16_t height, pixel_op_t op )
+{
+	const int16_t	arCoord[ DRAW_COORDS ] = { x, y, width, height };
+
+	_oled_display_draw( pHandle, DRAW_RECT, arCoord, op );
+}
+
+
+//**************************************************************************
+//	oled_display_fill_rect
+//--------------------------------------------------------------------------
+//	Draw a filled rectangle, x / y is the top left pixel.
+//
+void oled_display_fill_rect( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t width, int16_t height, pixel_op_t op )
+{
+	const int16_t	arCoord[ DRAW_COORDS ] = { x, y, width, height };
+
+	_oled_display_draw( pHandle, DRAW_FILL, arCoord, op );
+}
+
+
+//**************************************************************************
+//	oled_display_draw_circle
+//--------------------------------------------------------------------------
+//	Draw a circle around x / y (midpoint algorithm), every pixel of it
+//	is drawn once.
+//
+void oled_display_draw_circle( oled_display_handle_t *pHandle, int16_t x, int16_t y, int16_t radius, pixel_op_t op )
+{
+	const int16_t	arCoord[ DRAW_COORDS ] = { x, y, radius, 0 };
+
+	_oled_display_draw( pHandle, DRAW_CIRCLE, arCoord, op );
+}
+
+
+#if OLED_DISPLAY_LOCK
+//**************************************************************************
+//	oled_display_enable_lock
+//--------------------------------------------------------------------------
+//	Create the lock of the display, so the display can be used from
+//	different tasks. Every function of the display will then take the
+//	lock for its complete output. Without the lock the display must only
+//	be used by one task at a time (different displays can always be
+//	used by different tasks).
+//	The lock uses memory of the handle, no heap is needed.
+//	Call this function after oled_display_init().
+//
+void oled_display_enable_lock( oled_display_handle_t *pHandle )
+{
+	if( NULL == pHandle->lock )
+	{
+		pHandle->lock = xSemaphoreCreateRecursiveMutexStatic( &pHandle->lockBuffer );
+	}
+}
+#endif
+
+
+//**************************************************************************
+//	oled_display_lock
+//--------------------------------------------------------------------------
+//	Take the lock of the display (if the lock is enabled).
+//	The lock is recursive, so a task can take the lock around several
+//	calls, e.g. oled_display_set_cursor() and oled_display_print(),
+//	and no other task can print between these calls.
+//	With asynchronous output the lock keeps the queued commands of these
+//	calls together. The render task is the only one that sends to the
+//	display, so it does not use the lock.
+//
+void oled_display_lock( oled_display_handle_t *pHandle )
+{
+#if OLED_DISPLAY_LOCK
+	if( (NULL != pHandle->lock) && !_oled_display_in_render_task( pHandle ) )
+	{
+		xSemaphoreTakeRecursive( pHandle->lock, portMAX_DELAY );
 	}
+#else
+	(void)pHandle;
+#endif
+}
+
 
-	_oled_display_send_parameter( pHandle, OPC_DISPLAY_LINE_OFFSET, (pHandle->lineOffset << 3) );
+//**************************************************************************
+//	oled_display_unlock
+//--------------------------------------------------------------------------
+//	Give the lock of the display back (if the lock is enabled).
+//
+void oled_display_unlock( oled_display_handle_t *pHandle )
+{
+#if OLED_DISPLAY_LOCK
+	if( (NULL != pHandle->lock) && !_oled_display_in_render_task( pHandle ) )
+	{
+		xSemaphoreGiveRecursive( pHandle->lock );
+	}
+#else
+	(void)pHandle;
+#endif
 }
+
+
+#if OLED_DISPLAY_STATS
+//**************************************************************************
+//	oled_display_get_stats
+//--------------------------------------------------------------------------
+//	Copy the bus statistics of the display and, with bReset, set them
+//	to zero, so the next call delivers the traffic since this call.
+//	With asynchronous output the render task may count while the copy
+//	is made.
+//
+void oled_display_get_stats( oled_display_handle_t *pHandle, oled_display_stats_t *pStats, bool bReset )
+{
+	oled_display_lock( pHandle );
+
+	if( NULL != pStats )
+	{
+		memcpy( pStats, &pHandle->stats, sizeof( oled_display_stats_t ) );
+	}
+
+	if( bReset )
+	{
+		memset( &pHandle->stats, 0, sizeof( oled_display_stats_t ) );
+	}
+
+	oled_display_unlock( pHandle );
+}
+
+
+//**************************************************************************
+//	oled_display_reset_stats
+//--------------------------------------------------------------------------
+//
+void oled_display_reset_stats( oled_display_handle_t *pHandle )
+{
+	oled_display_get_stats( pHandle, NULL, true );
+}
+#endif
+
+
+#if OLED_DISPLAY_ASYNC
+//**************************************************************************
+//	oled_display_start_async
+//--------------------------------------------------------------------------
+//	Start the asynchronous output of the display.
+//	From now on all functions of the display only queue a render command
+//	and a render task with the given priority does the output.
+//	pAsync holds the queue, the task and its stack, so no heap is needed.
+//	It must stay valid until oled_display_stop_async() is called.
+//	pDoneCallback (may be NULL) is called for every fence that the
+//	render task reaches.
+//	If more than one task uses the display, enable the lock as well.
+//
+//	return values:
+//		0	render task is running
+//		1	asynchronous output is already running
+//		2	the queue or the task could not be created
+//
+uint8_t oled_display_start_async(	oled_display_handle_t	*pHandle,
+									oled_async_t			*pAsync,
+									UBaseType_t				 priority,
+									oled_display_done_cb_t	 pDoneCallback,
+									void					*pUser			)
+{
+	if( NULL != pHandle->pAsync )
+	{
+		return( 1 );
+	}
+
+	pAsync->pDoneCallback	= pDoneCallback;
+	pAsync->pUser			= pUser;
+	pAsync->fenceIssued		= 0;
+	pAsync->fenceDone		= 0;
+	pAsync->task			= NULL;
+	pAsync->queue			= xQueueCreateStatic(	OLED_ASYNC_QUEUE_LENGTH,
+													sizeof( oled_render_cmd_t ),
+													pAsync->queueStorage,
+													&pAsync->queueBuffer		);
+
+	if( NULL == pAsync->queue )
+	{
+		return( 2 );
+	}
+
+	pHandle->pAsync = pAsync;
+	pAsync->task	= xTaskCreateStatic(	_oled_display_render_task,
+											"oled_render",
+											OLED_ASYNC_STACK_SIZE,
+											pHandle,
+											priority,
+											pAsync->stack,
+											&pAsync->taskBuffer			);
+
+	if( NULL == pAsync->task )
+	{
+		pHandle->pAsync = NULL;
+
+		return( 2 );
+	}
+
+	return( 0 );
+}
+
+
+//**************************************************************************
+//	oled_display_stop_async
+//--------------------------------------------------------------------------
+//	Wait until all queued commands are done, then stop the render task.
+//	All following functions of the display will send directly again.
+//
+void oled_display_stop_async( oled_display_handle_t *pHandle )
+{
+	oled_async_t	*pAsync = pHandle->pAsync;
+	uint32_t		 fence;
+
+	if( _oled_display_is_async( pHandle ) )
+	{
+		fence = _oled_display_post_fence( pHandle, RCMD_STOP, xTaskGetCurrentTaskHandle(), portMAX_DELAY );
+
+		while( (int32_t)(pAsync->fenceDone - fence) < 0 )
+		{
+			ulTaskNotifyTakeIndexed( OLED_NOTIFY_INDEX, pdTRUE, portMAX_DELAY );
+		}
+
+		vTaskDelete( pAsync->task );
+
+		pHandle->pAsync = NULL;
+	}
+}
+
+
+//**************************************************************************
+//	oled_display_fence
+//--------------------------------------------------------------------------
+//	Put a fence into the queue and return its number at once.
+//	When the render task reaches the fence the done callback is called
+//	with this number.
+//	Without asynchronous output all is done already and 0 is returned.
+//
+uint32_t oled_display_fence( oled_display_handle_t *pHandle )
+{
+	if( !_oled_display_is_async( pHandle ) )
+	{
+		return( 0 );
+	}
+
+	return( _oled_display_post_fence( pHandle, RCMD_FENCE, NULL, portMAX_DELAY ) );
+}
+
+
+//**************************************************************************
+//	oled_display_wait
+//--------------------------------------------------------------------------
+//	Wait until all output queued so far has been send to the display
+//	(flush and wait), at most ticksToWait in total. The waiting uses the
+//	task notification OLED_NOTIFY_INDEX of the calling task.
+//	Returns 'false' if the time ran out before. The render task will
+//	still notify the calling task when it reaches the fence: with the
+//	default index 0 the next ulTaskNotifyTake() of that task can return
+//	at once then.
+//
+bool oled_display_wait( oled_display_handle_t *pHandle, TickType_t ticksToWait )
+{
+	oled_async_t	*pAsync = pHandle->pAsync;
+	TimeOut_t		 timeOut;
+	uint32_t		 fence;
+
+	if( !_oled_display_is_async( pHandle ) )
+	{
+		return( true );
+	}
+
+	vTaskSetTimeOutState( &timeOut );
+
+	fence = _oled_display_post_fence( pHandle, RCMD_FENCE, xTaskGetCurrentTaskHandle(), ticksToWait );
+
+	if( 0 == fence )
+	{
+		return( false );
+	}
+
+	//----------------------------------------------------------------------
+	//	a notification of an earlier fence (or of the application) wakes
+	//	up too early, the wait goes on with the remaining time only
+	//
+	while( (int32_t)(pAsync->fenceDone - fence) < 0 )
+	{
+		if(		(pdFALSE != xTaskCheckForTimeOut( &timeOut, &ticksToWait ))
+			||	(0 == ulTaskNotifyTakeIndexed( OLED_NOTIFY_INDEX, pdTRUE, ticksToWait )) )
+		{
+			return( false );
+		}
+	}
+
+	return( true );
+}
+#endif
+
+
+//**************************************************************************
+//	_oled_display_set_geometry (local)
+//--------------------------------------------------------------------------
+//	Take over the geometry of the panel (NULL: default geometry of the
+//	chip) and calculate the values that depend on it.
+//	Returns false if the chip or the handle can not drive such a panel.
+//	A specialized build (OLED_FIXED_CHIP_TYPE, OLED_FIXED_WIDTH) takes
+//	only its own chip and geometry, NULL is the fixed geometry then.
+//
+bool _oled_display_set_geometry( oled_display_handle_t *pHandle, chip_type_t chipType, const oled_geometry_t *pGeometry )
+{
+#ifdef OLED_FIXED_CHIP_TYPE
+	if( OLED_FIXED_CHIP_TYPE != chipType )
+	{
+		return( false );
+	}
+#endif
+
+#ifdef OLED_FIXED_WIDTH
+	if( NULL == pGeometry )
+	{
+		pGeometry = &g_oledGeometryFixed;
+	}
+	else if(	(OLED_FIXED_WIDTH != pGeometry->width)
+			||	(OLED_FIXED_HEIGHT != pGeometry->height)
+			||	(OLED_FIXED_COM_PINS != pGeometry->comPins)
+			||	(		(OLED_FIXED_COLUMN_OFFSET != pGeometry->columnOffset)
+					&&	(FIXED_COLUMN_OFFSET != pGeometry->columnOffset)	) )
+	{
+		return( false );
+	}
+#endif
+
+	switch( chipType )
+	{
+		case CHIP_TYPE_SH1106:
+			pHandle->ramColumns	= SH1106_RAM_COLUMNS;
+			pHandle->ramPages	= SH1106_RAM_PAGES;
+			break;
+
+		case CHIP_TYPE_SSD1306:
+			pHandle->ramColumns	= SSD1306_RAM_COLUMNS;
+			pHandle->ramPages	= SSD1306_RAM_PAGES;
+			break;
+
+		case CHIP_TYPE_SH1107:
+			pHandle->ramColumns	= SH1107_RAM_COLUMNS;
+			pHandle->ramPages	= SH1107_RAM_PAGES;
+			break;
+
+		default:
+			return( false );
+	}
+
+	if( NULL == pGeometry )
+	{
+		pGeometry = (CHIP_TYPE_SH1107 == chipType) ? &g_oledGeometry128x128 : &g_oledGeometry128x64;
+	}
+
+	pHandle->geometry		= *pGeometry;
+	pHandle->textLines		= pGeometry->height / PIXELS_CHAR_HEIGHT;
+	pHandle->textColumns	= pGeometry->width / PIXELS_CHAR_WIDTH;
+
+	//------------------------------------------------------------------
+	//	every character must be complete, the scrolling uses all pages
+	//	of the RAM, so the frame buffer and the text shadow must hold
+	//	all of them
+	//
+	if(		(0 == pHandle->textLines)
+		||	(0 == pHandle->textColumns)
+		||	(0 != (pGeometry->height % PIXELS_CHAR_HEIGHT))
+		||	(0 != (pGeometry->width % PIXELS_CHAR_WIDTH))
+		||	(pHandle->ramPages < pHandle->textLines)
+		||	(pHandle->ramColumns < pGeometry->width)
+		||	(OLED_MAX_PAGES < pHandle->ramPages) )
+	{
+		return( false );
+	}
+
+	if( OLED_COLUMN_OFFSET_CENTER == pGeometry->columnOffset )
+	{
+		pHandle->geometry.columnOffset = DISPLAY_SPARE_COLUMNS( pHandle ) / 2;
+	}
+	else if( DISPLAY_SPARE_COLUMNS( pHandle ) < pGeometry->columnOffset )
+	{
+		return( false );
+	}
+
+	pHandle->displayColumnOffset = pHandle->geometry.columnOffset;
+
+	return( true );
+}
+
+
+//**************************************************************************
+//	_oled_display_send_init_sequence (local)
+//--------------------------------------------------------------------------
+//	Send the init sequence of the chip together with the geometry of
+//	the panel as one transaction.
+//
+void _oled_display_send_init_sequence( oled_display_handle_t *pHandle )
+{
+	uint8_t			 arusInit[ INIT_SEQUENCE_SIZE ];
+	const uint8_t	*pChipPart;
+	size_t			 chipPartSize;
+	size_t			 geometrySize	= sizeof( g_arusInitGeometry );
+	size_t			 length;
+
+	if( CHIP_TYPE_SSD1306 == DISPLAY_CHIP_TYPE( pHandle ) )
+	{
+		pChipPart		= g_arusInitSequenceSsd1306;
+		chipPartSize	= sizeof( g_arusInitSequenceSsd1306 );
+	}
+	else if( CHIP_TYPE_SH1107 == DISPLAY_CHIP_TYPE( pHandle ) )
+	{
+		pChipPart		= g_arusInitSequenceSh1107;
+		chipPartSize	= sizeof( g_arusInitSequenceSh1107 );
+		geometrySize	= INIT_GEOMETRY_SIZE_SH1107;
+	}
+	else
+	{
+		pChipPart		= g_arusInitSequenceSh1106;
+		chipPartSize	= sizeof( g_arusInitSequenceSh1106 );
+	}
+
+	memcpy( arusInit, pChipPart, chipPartSize );
+	length = chipPartSize;
+
+	memcpy( &arusInit[ length ], g_arusInitGeometry, geometrySize );
+	arusInit[ length + IDX_INIT_MULTIPLEX_RATIO ] = DISPLAY_TEXT_LINES( pHandle ) * PIXELS_CHAR_HEIGHT - 1;
+
+	if( INIT_GEOMETRY_SIZE_SH1107 < geometrySize )
+	{
+		arusInit[ length + IDX_INIT_COM_PINS ] = pHandle->geometry.comPins;
+	}
+
+	length += geometrySize;
+
+	memcpy( &arusInit[ length ], g_arusInitCommon, sizeof( g_arusInitCommon ) );
+	length += sizeof( g_arusInitCommon );
+
+	_oled_display_write( pHandle, arusInit, length );
+}
+
+
+//**************************************************************************
+//	_oled_display_visible_pages (local)
+//--------------------------------------------------------------------------
+//	The function returns the RAM pages that are shown on the panel
+//	(one bit per page), taking care of the display line shift.
+//
+uint16_t _oled_display_visible_pages( oled_display_handle_t *pHandle )
+{
+	uint16_t	uiPages = 0;
+
+	for( uint8_t usTextLine = 0 ; DISPLAY_TEXT_LINES( pHandle ) > usTextLine ; usTextLine++ )
+	{
+		uiPages |= (1 << _oled_display_page_of_line( pHandle, usTextLine ));
+	}
+
+	return( uiPages );
+}
+
+
+//**************************************************************************
+//	_oled_display_send_opcode (local)
+//--------------------------------------------------------------------------
+//	This function will send a one byte command to the display.
+//	A one byte command exists of
+//		-	1 byte prefix
+//		-	1 byte command code
+//
+void _oled_display_send_opcode( oled_display_handle_t *pHandle, uint8_t opCode )
+{
+	pHandle->commandBuffer[ 1 ] = opCode;
+
+	_oled_display_write( pHandle, pHandle->commandBuffer, 2 );
+}
+
+
+//**************************************************************************
+//	_oled_display_send_parameter (local)
+//--------------------------------------------------------------------------
+//	This function will send a two byte command to the display.
+//	A two byte command exists of
+//		-	1 byte prefix
+//		-	1 byte command code
+//		-	1 byte parameter
+//
+void _oled_display_send_parameter( oled_display_handle_t *pHandle, uint8_t opCode, uint8_t parameter )
+{
+	pHandle->commandBuffer[ 1 ] = opCode;
+	pHandle->commandBuffer[ 2 ] = parameter;
+
+	_oled_display_write( pHandle, pHandle->commandBuffer, 3 );
+}
+
+
+//**************************************************************************
+//	_oled_display_next_line (local)
+//--------------------------------------------------------------------------
+//	The function will set the cursor to the beginning of the 'next print
+//	line'. Which will be the 'next print line' depends on the print mode
+//	and the function parameter.
+//
+void _oled_display_next_line( oled_display_handle_t *pHandle, bool shiftLine )
+{
+	uint8_t	usStatsEntry	= OLED_STATS_ENTRIES;
+	bool	bScroll			= false;
+	bool	bCleared		= false;
+
+	pHandle->textColumn	= 0;
+
+	if( PM_SCROLL_LINE == pHandle->printMode )
+	{
+		//------------------------------------------------------------------
+		//	PrintMode is scroll line
+		//	if		the cursor is in the last line of the scroll region
+		//			(default: the last line of the display),
+		//	then	stay there and shift the other lines of the region
+		//			one up
+		//	else	set cursor to the next line
+		//
+		if( pHandle->scrollLastLine == pHandle->textLine )
+		{
+			//--------------------------------------------------------------
+			//	all bus traffic up to the end of this function is
+			//	counted for scrolling
+			//
+			usStatsEntry	= _oled_display_begin( pHandle, OLED_STATS_SCROLL );
+			bScroll			= true;
+
+			if(		(0 == pHandle->scrollFirstLine)
+				&&	((DISPLAY_TEXT_LINES( pHandle ) - 1) == pHandle->scrollLastLine) )
+			{
+				bCleared = _oled_display_shift_display_one_line( pHandle );
+			}
+			else
+			{
+				_oled_display_scroll_region( pHandle );
+			}
+		}
+		else
+		{
+			pHandle->textLine = (pHandle->textLine + 1) % DISPLAY_TEXT_LINES( pHandle );
+		}
+	}
+	else if( shiftLine || (PM_OVERWRITE_NEXT_LINE == pHandle->printMode) )
+	{
+		//------------------------------------------------------------------
+		//	if PrintMode is overwrite next line or bShiftLine is 'true'
+		//	set cursor to the next line
+		//
+		pHandle->textLine++;
+	}
+
+	//----------------------------------------------------------------------
+	//	check if the cursor is set to the allowed line range
+	//
+	if( DISPLAY_TEXT_LINES( pHandle ) <= pHandle->textLine )
+	{
+		pHandle->textLine = 0;
+	}
+
+	//----------------------------------------------------------------------
+	//	now set the cursor to the new position and
+	//	if required clear the line
+	//
+	oled_display_set_cursor( pHandle, pHandle->textLine, pHandle->textColumn );
+
+	if( (PM_OVERWRITE_NEXT_LINE < pHandle->printMode) && !bCleared )
+	{
+		oled_display_clear_actual_line( pHandle );
+	}
+
+	if( bScroll )
+	{
+		_oled_display_end( pHandle, usStatsEntry );
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_shift_display_one_line (local)
+//--------------------------------------------------------------------------
+//	The function scrolls the display up one line.
+//	The line offset runs over all pages of the RAM, so on a panel with
+//	less rows the lines that have been scrolled out are not overwritten
+//	before the last visible line.
+//	Returns 'true' if the new last line is already cleared (smooth
+//	scroll).
+//
+bool _oled_display_shift_display_one_line( oled_display_handle_t *pHandle )
+{
+	pHandle->lineOffset++;
+	
+	if( DISPLAY_RAM_PAGES( pHandle ) <= pHandle->lineOffset )
+	{
+		pHandle->lineOffset = 0;
+	}
+
+	if( NULL != pHandle->pFrameBuffer )
+	{
+		pHandle->pFrameBuffer->lineOffsetDirty = true;
+	}
+	else if( 0 < pHandle->smoothScrollMs )
+	{
+		_oled_display_smooth_scroll( pHandle );
+
+		return( true );
+	}
+	else
+	{
+		_oled_display_send_parameter( pHandle, OPC_DISPLAY_LINE_OFFSET, (pHandle->lineOffset << 3) );
+	}
+
+	return( false );
+}
+
+
+//**************************************************************************
+//	_oled_display_smooth_scroll (local)
+//--------------------------------------------------------------------------
+//	Move the display to the new line offset one pixel row at a time.
+//	The new last line is cleared before the first step. On a panel with
+//	less rows than the RAM its page is not shown at that time, otherwise
+//	it is the first line, which is about to be scrolled out.
+//	The rows 1 ... 7 are stepped with the display start line, the last
+//	step sets the line offset of the new line and the start line back
+//	to 0 in one transaction.
+//
+void _oled_display_smooth_scroll( oled_display_handle_t *pHandle )
+{
+	uint8_t	arusCommand[ SMOOTH_SCROLL_COMMAND_SIZE ];
+	size_t	length = 0;
+
+	oled_display_clear_line( pHandle, DISPLAY_TEXT_LINES( pHandle ) - 1 );
+
+	for( uint8_t usRow = 1 ; PIXELS_CHAR_HEIGHT > usRow ; usRow++ )
+	{
+		vTaskDelay( pdMS_TO_TICKS( pHandle->smoothScrollMs ) );
+
+		_oled_display_send_start_line( pHandle, usRow );
+	}
+
+	vTaskDelay( pdMS_TO_TICKS( pHandle->smoothScrollMs ) );
+
+	arusCommand[ length++ ] = PREFIX_LAST_COMMAND;
+	arusCommand[ length++ ] = OPC_DISPLAY_LINE_OFFSET;
+	arusCommand[ length++ ] = pHandle->lineOffset << 3;
+
+	if( CHIP_TYPE_SH1107 == DISPLAY_CHIP_TYPE( pHandle ) )
+	{
+		arusCommand[ length++ ] = OPC_DISPLAY_START_LINE_SH1107;
+		arusCommand[ length++ ] = 0;
+	}
+	else
+	{
+		arusCommand[ length++ ] = OPC_DISPLAY_START_LINE;
+	}
+
+	_oled_display_write( pHandle, arusCommand, length );
+}
+
+
+//**************************************************************************
+//	_oled_display_send_start_line (local)
+//--------------------------------------------------------------------------
+//	Set the display start line, it is added to the line offset.
+//
+void _oled_display_send_start_line( oled_display_handle_t *pHandle, uint8_t startLine )
+{
+	if( CHIP_TYPE_SH1107 == DISPLAY_CHIP_TYPE( pHandle ) )
+	{
+		_oled_display_send_parameter( pHandle, OPC_DISPLAY_START_LINE_SH1107, startLine );
+	}
+	else
+	{
+		_oled_display_send_opcode( pHandle, OPC_DISPLAY_START_LINE | startLine );
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_scroll_region (local)
+//--------------------------------------------------------------------------
+//	The function scrolls the lines of the scroll region up one line,
+//	the lines outside of the region are not changed. The controller can
+//	only shift all lines, so the text is moved:
+//	-	with a frame buffer the pages are copied in the RAM copy, the
+//		flush sends only the changed columns
+//	-	without frame buffer the lines are printed again from the text
+//		shadow, only the characters that differ from the line below
+//		are send
+//	If the text shadow does not know all characters of the region, the
+//	lines are cleared instead.
+//	The last line of the region is cleared by the caller.
+//
+void _oled_display_scroll_region( oled_display_handle_t *pHandle )
+{
+	uint8_t	usTextLine = pHandle->textLine;
+	uint8_t	usDestination;
+	uint8_t	usSource;
+
+	if( NULL != pHandle->pFrameBuffer )
+	{
+		for( uint8_t usLine = pHandle->scrollFirstLine ; pHandle->scrollLastLine > usLine ; usLine++ )
+		{
+			usDestination	= _oled_display_page_of_line( pHandle, usLine );
+			usSource		= _oled_display_page_of_line( pHandle, usLine + 1 );
+
+			memcpy( pHandle->pFrameBuffer->image[ usDestination ], pHandle->pFrameBuffer->image[ usSource ], OLED_FRAME_BUFFER_COLUMNS );
+
+			pHandle->pFrameBuffer->dirtyPages |= (1 << usDestination);
+		}
+	}
+	else if( !_oled_display_shadow_scroll_region( pHandle ) )
+	{
+		for( uint8_t usLine = pHandle->scrollFirstLine ; pHandle->scrollLastLine > usLine ; usLine++ )
+		{
+			oled_display_clear_line( pHandle, usLine );
+		}
+	}
+
+	pHandle->textLine = usTextLine;
+}
+
+
+//**************************************************************************
+//	_oled_display_page_of_line (local)
+//--------------------------------------------------------------------------
+//	The function returns the RAM page of the display that is shown in
+//	the given text line, taking care of the display line shift.
+//
+uint8_t _oled_display_page_of_line( oled_display_handle_t *pHandle, uint8_t textLine )
+{
+	textLine += pHandle->lineOffset;
+
+	if( DISPLAY_RAM_PAGES( pHandle ) <= textLine )
+	{
+		textLine -= DISPLAY_RAM_PAGES( pHandle );
+	}
+
+	return( textLine & MASK_PAGE_ADDRESS );
+}
+
+
+//**************************************************************************
+//	_oled_display_flush_span (local)
+//--------------------------------------------------------------------------
+//	Send the columns firstColumn ... lastColumn of one page of the frame
+//	buffer to the display and return the number of bytes on the bus.
+//
+uint32_t _oled_display_flush_span( oled_display_handle_t *pHandle, uint8_t page, uint8_t firstColumn, uint8_t lastColumn )
+{
+	uint8_t	*pData		= &pHandle->pFrameBuffer->image[ page ][ firstColumn ];
+	uint8_t	 usLength	= lastColumn - firstColumn + 1;
+
+	_oled_display_set_position( pHandle, page, DISPLAY_COLUMN_OFFSET( pHandle ) + firstColumn );
+	_oled_display_write_data( pHandle, pData, usLength );
+
+#if OLED_FRAME_BUFFER_SHADOW
+	memcpy( &pHandle->pFrameBuffer->shadow[ page ][ firstColumn ], pData, usLength );
+#endif
+
+	return( BUS_BYTES_POSITION + BUS_BYTES_DATA( usLength ) );
+}
+
+
+#if OLED_FRAME_BUFFER_SHADOW
+//**************************************************************************
+//	_oled_display_flush_page_diff (local)
+//--------------------------------------------------------------------------
+//	Compare one page of the frame buffer with the image that was send
+//	to the display and send only the changed column spans.
+//	Two spans will be merged if the unchanged gap between them is not
+//	bigger than the overhead of an additional span.
+//
+uint32_t _oled_display_flush_page_diff( oled_display_handle_t *pHandle, uint8_t page )
+{
+	const uint8_t	*pImage		= pHandle->pFrameBuffer->image[ page ];
+	const uint8_t	*pShadow	= pHandle->pFrameBuffer->shadow[ page ];
+	uint32_t		 ulBytes	= 0;
+	uint8_t			 usColumn	= 0;
+	uint8_t			 usFirst;
+	uint8_t			 usLast;
+
+
+	while( DISPLAY_WIDTH( pHandle ) > usColumn )
+	{
+		//------------------------------------------------------------------
+		//	search the beginning of the next changed span
+		//
+		if( pImage[ usColumn ] == pShadow[ usColumn ] )
+		{
+			usColumn++;
+
+			continue;
+		}
+
+		usFirst = usColumn;
+		usLast	= usColumn;
+
+		//------------------------------------------------------------------
+		//	extend the span as long as the gaps are small enough
+		//
+		for( usColumn++ ; DISPLAY_WIDTH( pHandle ) > usColumn ; usColumn++ )
+		{
+			if( pImage[ usColumn ] != pShadow[ usColumn ] )
+			{
+				usLast = usColumn;
+			}
+			else if( FLUSH_SPAN_OVERHEAD <= (usColumn - usLast) )
+			{
+				break;
+			}
+		}
+
+		ulBytes	 += _oled_display_flush_span( pHandle, page, usFirst, usLast );
+		usColumn  = usLast + 1;
+	}
+
+	return( ulBytes );
+}
+#endif
+
+
+//**************************************************************************
+//	_oled_display_set_position (local)
+//--------------------------------------------------------------------------
+//	This function will set the RAM pointer of the display to the given
+//	page and pixel column.
+//
+void _oled_display_set_position( oled_display_handle_t *pHandle, uint8_t page, uint8_t column )
+{
+	uint8_t	*pBuffer = pHandle->positionCommandBuffer;
+
+	pBuffer[ IDX_PAGE_ADDRESS ]			= OPC_PAGE_ADDRESS | (page & MASK_PAGE_ADDRESS);
+	pBuffer[ IDX_COLUMN_ADDRESS_LOW  ]	= OPC_COLUMN_ADDRESS_LOW | (column & MASK_COLUMN_ADDRESS_LOW);
+	pBuffer[ IDX_COLUMN_ADDRESS_HIGH ]	= OPC_COLUMN_ADDRESS_HIGH | ((column & MASK_COLUMN_ADDRESS_HIGH) >> 4);
+
+#if OLED_DISPLAY_STATS
+	pHandle->stats.entry[ (OLED_STATS_ENTRIES > pHandle->statsEntry) ? pHandle->statsEntry : OLED_STATS_OTHER ].cursorWrites++;
+#endif
+
+	_oled_display_write( pHandle, pBuffer, OLED_POSITION_BUFFER_SIZE );
+}
+
+
+//**************************************************************************
+//	_oled_display_draw (local)
+//--------------------------------------------------------------------------
+//	Draw one shape (DRAW_xxx) into the frame buffer, the meaning of the
+//	coordinates depends on the shape.
+//
+void _oled_display_draw( oled_display_handle_t *pHandle, uint8_t shape, const int16_t *pCoord, pixel_op_t op )
+{
+	uint8_t	usStatsEntry;
+
+	if( _oled_display_post( pHandle, RCMD_DRAW, shape, op, pCoord, DRAW_COORDS * sizeof( int16_t ) ) )
+	{
+		return;
+	}
+
+	usStatsEntry = _oled_display_begin( pHandle, OLED_STATS_OTHER );
+
+	if( NULL != pHandle->pFrameBuffer )
+	{
+		switch( shape )
+		{
+			case DRAW_FILL:
+				_oled_display_fill_area(	pHandle, pCoord[ 0 ], pCoord[ 1 ],
+											(int32_t)pCoord[ 0 ] + pCoord[ 2 ] - 1, (int32_t)pCoord[ 1 ] + pCoord[ 3 ] - 1, op );
+				break;
+
+			case DRAW_RECT:
+				_oled_display_draw_rect( pHandle, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pCoord[ 3 ], op );
+				break;
+
+			case DRAW_LINE:
+				_oled_display_draw_line( pHandle, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], pCoord[ 3 ], op );
+				break;
+
+			case DRAW_CIRCLE:
+				_oled_display_draw_circle( pHandle, pCoord[ 0 ], pCoord[ 1 ], pCoord[ 2 ], op );
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	_oled_display_end( pHandle, usStatsEntry );
+}
+
+
+//**************************************************************************
+//	_oled_display_apply_op (local)
+//--------------------------------------------------------------------------
+//	Set, clear or invert the pixels of the mask in some columns of a
+//	page. Every operation is done as 'keep the bits, then flip bits',
+//	so all columns use the same loop. If no bit is kept the columns get
+//	a constant byte (memset).
+//
+void _oled_display_apply_op( uint8_t *pColumn, uint8_t columns, uint8_t mask, pixel_op_t op )
+{
+	uint8_t	usKeep;
+	uint8_t	usFlip;
+
+	switch( op )
+	{
+		case PIXEL_SET:
+			usKeep = ~mask;
+			usFlip = mask;
+			break;
+
+		case PIXEL_CLEAR:
+			usKeep = ~mask;
+			usFlip = 0x00;
+			break;
+
+		case PIXEL_XOR:
+			usKeep = 0xFF;
+			usFlip = mask;
+			break;
+
+		default:
+			return;
+	}
+
+	if( 0x00 == usKeep )
+	{
+		memset( pColumn, usFlip, columns );
+
+		return;
+	}
+
+	for( uint8_t idx = 0 ; columns > idx ; idx++ )
+	{
+		pColumn[ idx ] = (pColumn[ idx ] & usKeep) ^ usFlip;
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_fill_area (local)
+//--------------------------------------------------------------------------
+//	Draw the pixels x0 ... x1 / y0 ... y1 (cut at the panel). Each page
+//	of the area is one mask for all its columns: whole bytes in the
+//	middle, the pixels below y0 / above y1 in the first / last page.
+//
+void _oled_display_fill_area( oled_display_handle_t *pHandle, int32_t x0, int32_t y0, int32_t x1, int32_t y1, pixel_op_t op )
+{
+	oled_frame_buffer_t	*pFrameBuffer	= pHandle->pFrameBuffer;
+	int32_t				 height			= DISPLAY_TEXT_LINES( pHandle ) * PIXELS_CHAR_HEIGHT;
+	uint8_t				 usMask;
+	uint8_t				 usPage;
+
+	x0 = (0 > x0) ? 0 : x0;
+	y0 = (0 > y0) ? 0 : y0;
+	x1 = (DISPLAY_WIDTH( pHandle ) <= x1) ? (DISPLAY_WIDTH( pHandle ) - 1) : x1;
+	y1 = (height <= y1) ? (height - 1) : y1;
+
+	if( (x0 > x1) || (y0 > y1) )
+	{
+		return;
+	}
+
+	for( int32_t line = y0 / PIXELS_CHAR_HEIGHT ; (y1 / PIXELS_CHAR_HEIGHT) >= line ; line++ )
+	{
+		usMask = 0xFF;
+
+		if( (y0 / PIXELS_CHAR_HEIGHT) == line )
+		{
+			usMask &= 0xFF << (y0 % PIXELS_CHAR_HEIGHT);
+		}
+
+		if( (y1 / PIXELS_CHAR_HEIGHT) == line )
+		{
+			usMask &= 0xFF >> (PIXELS_CHAR_HEIGHT - 1 - (y1 % PIXELS_CHAR_HEIGHT));
+		}
+
+		usPage = _oled_display_page_of_line( pHandle, (uint8_t)line );
+
+		_oled_display_apply_op( &pFrameBuffer->image[ usPage ][ x0 ], (uint8_t)(x1 - x0 + 1), usMask, op );
+
+		pFrameBuffer->dirtyPages |= (1 << usPage);
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_draw_point (local)
+//--------------------------------------------------------------------------
+//	Draw one pixel of a line or circle, pixels outside of the panel are
+//	skipped.
+//
+void _oled_display_draw_point( oled_display_handle_t *pHandle, int32_t x, int32_t y, pixel_op_t op )
+{
+	uint8_t	usPage;
+
+	if(		(0 > x) || (DISPLAY_WIDTH( pHandle ) <= x)
+		||	(0 > y) || ((DISPLAY_TEXT_LINES( pHandle ) * PIXELS_CHAR_HEIGHT) <= y) )
+	{
+		return;
+	}
+
+	usPage = _oled_display_page_of_line( pHandle, (uint8_t)(y / PIXELS_CHAR_HEIGHT) );
+
+	_oled_display_apply_op( &pHandle->pFrameBuffer->image[ usPage ][ x ], 1, 1 << (y % PIXELS_CHAR_HEIGHT), op );
+
+	pHandle->pFrameBuffer->dirtyPages |= (1 << usPage);
+}
+
+
+//**************************************************************************
+//	_oled_display_draw_rect (local)
+//--------------------------------------------------------------------------
+//	The border as four spans, the left and right one without the
+//	corners.
+//
+void _oled_display_draw_rect( oled_display_handle_t *pHandle, int32_t x, int32_t y, int32_t width, int32_t height, pixel_op_t op )
+{
+	int32_t	x1 = x + width - 1;
+	int32_t	y1 = y + height - 1;
+
+	if( (0 >= width) || (0 >= height) )
+	{
+		return;
+	}
+
+	_oled_display_fill_area( pHandle, x, y, x1, y, op );
+
+	if( 1 < height )
+	{
+		_oled_display_fill_area( pHandle, x, y1, x1, y1, op );
+	}
+
+	if( 2 < height )
+	{
+		_oled_display_fill_area( pHandle, x, y + 1, x, y1 - 1, op );
+
+		if( 1 < width )
+		{
+			_oled_display_fill_area( pHandle, x1, y + 1, x1, y1 - 1, op );
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_draw_line (local)
+//--------------------------------------------------------------------------
+//	Horizontal and vertical lines are spans, all others are drawn pixel
+//	by pixel with the Bresenham algorithm (all octants, integer only).
+//
+void _oled_display_draw_line( oled_display_handle_t *pHandle, int32_t x0, int32_t y0, int32_t x1, int32_t y1, pixel_op_t op )
+{
+	int32_t	dx		= (x0 < x1) ? (x1 - x0) : (x0 - x1);
+	int32_t	dy		= (y0 < y1) ? (y0 - y1) : (y1 - y0);
+	int32_t	sx		= (x0 < x1) ? 1 : -1;
+	int32_t	sy		= (y0 < y1) ? 1 : -1;
+	int32_t	error	= dx + dy;
+	int32_t	error2;
+
+	if( (0 == dx) || (0 == dy) )
+	{
+		_oled_display_fill_area(	pHandle, (x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1,
+									(x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0, op			);
+		return;
+	}
+
+	for( ;; )
+	{
+		_oled_display_draw_point( pHandle, x0, y0, op );
+
+		if( (x0 == x1) && (y0 == y1) )
+		{
+			break;
+		}
+
+		error2 = 2 * error;
+
+		if( error2 >= dy )
+		{
+			error	+= dy;
+			x0		+= sx;
+		}
+
+		if( error2 <= dx )
+		{
+			error	+= dx;
+			y0		+= sy;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_draw_circle (local)
+//--------------------------------------------------------------------------
+//	Midpoint algorithm: the pixels of one octant are calculated, the
+//	other octants are mirrored. On the diagonal both octants meet, the
+//	pixels there are drawn only once.
+//
+void _oled_display_draw_circle( oled_display_handle_t *pHandle, int32_t x, int32_t y, int32_t radius, pixel_op_t op )
+{
+	int32_t	dx		= radius;
+	int32_t	dy		= 0;
+	int32_t	error	= 1 - radius;
+
+	while( dx >= dy )
+	{
+		_oled_display_draw_circle_points( pHandle, x, y, dx, dy, op );
+
+		if( dx != dy )
+		{
+			_oled_display_draw_circle_points( pHandle, x, y, dy, dx, op );
+		}
+
+		dy++;
+
+		if( 0 > error )
+		{
+			error += 2 * dy + 1;
+		}
+		else
+		{
+			dx--;
+			error += 2 * (dy - dx) + 1;
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_draw_circle_points (local)
+//--------------------------------------------------------------------------
+//	The pixel dx / dy from the center mirrored into all quadrants, on
+//	the axes (dx or dy is 0) the mirrored pixels are the same.
+//
+void _oled_display_draw_circle_points( oled_display_handle_t *pHandle, int32_t x, int32_t y, int32_t dx, int32_t dy, pixel_op_t op )
+{
+	_oled_display_draw_point( pHandle, x + dx, y + dy, op );
+
+	if( 0 != dx )
+	{
+		_oled_display_draw_point( pHandle, x - dx, y + dy, op );
+	}
+
+	if( 0 != dy )
+	{
+		_oled_display_draw_point( pHandle, x + dx, y - dy, op );
+
+		if( 0 != dx )
+		{
+			_oled_display_draw_point( pHandle, x - dx, y - dy, op );
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_print_glyph (local)
+//--------------------------------------------------------------------------
+//	Print one character (glyph code, see FONT_FIRST_EXTENDED) at the
+//	cursor position, a new line character moves the cursor to the next
+//	line, the other characters below a space are skipped.
+//
+void _oled_display_print_glyph( oled_display_handle_t *pHandle, uint8_t charIdx )
+{
+	uint64_t	ullGlyph;
+	uint8_t		usPage;
+
+	if( '\n' == charIdx )
+	{
+		_oled_display_next_line( pHandle, true );
+	}
+	else if( ' ' <= charIdx )
+	{
+		//------------------------------------------------------------------
+		//	if we reached the end of the line then depending of the
+		//	PrintMode continue in the 'next line'
+		//
+		if( DISPLAY_TEXT_COLUMNS( pHandle ) <= pHandle->textColumn )
+		{
+			_oled_display_next_line( pHandle, false );
+		}
+
+		if( NULL != pHandle->pFrameBuffer )
+		{
+			//--------------------------------------------------------------
+			//	frame buffer mode: only draw into the RAM copy,
+			//	oled_display_flush() will send it
+			//
+			usPage = _oled_display_page_of_line( pHandle, pHandle->textLine );
+
+			_oled_display_render_glyph(	pHandle,
+										charIdx,
+										(uint64_t *)&pHandle->pFrameBuffer->image[ usPage ][ pHandle->textColumn << 3 ]	);
+
+			pHandle->pFrameBuffer->dirtyPages |= (1 << usPage);
+		}
+		else
+		{
+			//--------------------------------------------------------------
+			//	transmit the bitmap of the character to the display,
+			//	if it is not already shown there
+			//
+			if( _oled_display_shadow_update( pHandle, charIdx ) )
+			{
+				pHandle->positionPending = true;
+			}
+			else
+			{
+				_oled_display_sync_cursor( pHandle );
+				_oled_display_render_glyph( pHandle, charIdx, &ullGlyph );
+				_oled_display_write_data( pHandle, (const uint8_t *)&ullGlyph, PIXELS_CHAR_WIDTH );
+			}
+		}
+
+		//------------------------------------------------------------------
+		//	one character printed, so move cursor
+		//
+		pHandle->textColumn++;
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_utf8_decode (local)
+//--------------------------------------------------------------------------
+//	Decode the UTF-8 sequence that starts with the given byte (0x80 or
+//	above), *ppText points to the byte after it and is moved behind the
+//	sequence. A broken sequence gives UTF8_INVALID, the text goes on
+//	with the first byte that does not belong to it (e.g. the end of the
+//	text).
+//
+uint32_t _oled_display_utf8_decode( const uint8_t **ppText, uint8_t lead )
+{
+	const uint8_t	*pText	= *ppText;
+	uint32_t		 ulCodepoint;
+	uint8_t			 usFollow;
+
+	if( 0xC0 > lead )
+	{
+		return( UTF8_INVALID );
+	}
+	else if( 0xE0 > lead )
+	{
+		ulCodepoint	= lead & 0x1F;
+		usFollow	= 1;
+	}
+	else if( 0xF0 > lead )
+	{
+		ulCodepoint	= lead & 0x0F;
+		usFollow	= 2;
+	}
+	else
+	{
+		ulCodepoint	= lead & 0x07;
+		usFollow	= 3;
+	}
+
+	for( ; 0 < usFollow ; usFollow-- )
+	{
+		if( 0x80 != (*pText & 0xC0) )
+		{
+			*ppText = pText;
+
+			return( UTF8_INVALID );
+		}
+
+		ulCodepoint = (ulCodepoint << 6) | (*pText++ & 0x3F);
+	}
+
+	*ppText = pText;
+
+	return( ulCodepoint );
+}
+
+
+//**************************************************************************
+//	_oled_display_find_codepoint (local)
+//--------------------------------------------------------------------------
+//	Binary search of the codepoint in the sorted table.
+//	Returns its index or 'count' if it is not in the table.
+//
+uint16_t _oled_display_find_codepoint( const uint16_t *pCodepoints, uint16_t count, uint32_t codepoint )
+{
+	uint16_t	uiLow	= 0;
+	uint16_t	uiHigh	= count;
+	uint16_t	uiMiddle;
+
+	if( 0xFFFF < codepoint )
+	{
+		return( count );
+	}
+
+	while( uiLow < uiHigh )
+	{
+		uiMiddle = (uiLow + uiHigh) >> 1;
+
+		if( pCodepoints[ uiMiddle ] < codepoint )
+		{
+			uiLow = uiMiddle + 1;
+		}
+		else
+		{
+			uiHigh = uiMiddle;
+		}
+	}
+
+	return( ((count > uiLow) && (pCodepoints[ uiLow ] == codepoint)) ? uiLow : count );
+}
+
+
+//**************************************************************************
+//	_oled_display_codepoint_glyph (local)
+//--------------------------------------------------------------------------
+//	The glyph code of the 8x8 font for a codepoint from 0x80 on
+//	(FONT_NO_GLYPH if the font does not have it).
+//
+uint8_t _oled_display_codepoint_glyph( uint32_t codepoint )
+{
+	uint16_t	uiIndex = _oled_display_find_codepoint( font_extended_codepoints, FONT_EXTENDED_CHARS, codepoint );
+
+	return( (FONT_EXTENDED_CHARS > uiIndex) ? (uint8_t)(FONT_FIRST_EXTENDED + uiIndex) : FONT_NO_GLYPH );
+}
+
+
+//**************************************************************************
+//	_oled_display_encode_glyph (local)
+//--------------------------------------------------------------------------
+//	The character of the glyph code as UTF-8 (at most UTF8_MAX_BYTES),
+//	returns the number of bytes.
+//
+uint8_t _oled_display_encode_glyph( uint8_t charIdx, char *pDest )
+{
+	uint16_t	uiCodepoint;
+
+	if( FONT_FIRST_EXTENDED > charIdx )
+	{
+		pDest[ 0 ] = (char)charIdx;
+
+		return( 1 );
+	}
+
+	uiCodepoint = font_extended_codepoints[ charIdx - FONT_FIRST_EXTENDED ];
+
+	if( 0x0800 > uiCodepoint )
+	{
+		pDest[ 0 ] = (char)(0xC0 | (uiCodepoint >> 6));
+		pDest[ 1 ] = (char)(0x80 | (uiCodepoint & 0x3F));
+
+		return( 2 );
+	}
+
+	pDest[ 0 ] = (char)(0xE0 | (uiCodepoint >> 12));
+	pDest[ 1 ] = (char)(0x80 | ((uiCodepoint >> 6) & 0x3F));
+	pDest[ 2 ] = (char)(0x80 | (uiCodepoint & 0x3F));
+
+	return( 3 );
+}
+
+
+//**************************************************************************
+//	_oled_display_font_glyph (local)
+//--------------------------------------------------------------------------
+//	The glyph of the proportional font for the next character of the
+//	UTF-8 text, *ppText is moved behind the character.
+//	Returns NULL if the font does not have the character.
+//
+const oled_glyph_t *_oled_display_font_glyph( const oled_font_t *pFont, const uint8_t **ppText )
+{
+	uint8_t		usChar	= *(*ppText)++;
+	uint16_t	uiIndex;
+
+	if( 0x80 > usChar )
+	{
+		return( ((pFont->firstChar <= usChar) && (pFont->lastChar >= usChar)) ? &pFont->pGlyphs[ usChar - pFont->firstChar ] : NULL );
+	}
+
+	uiIndex = _oled_display_find_codepoint( pFont->pCodepoints, pFont->extendedChars, _oled_display_utf8_decode( ppText, usChar ) );
+
+	if( pFont->extendedChars <= uiIndex )
+	{
+		return( NULL );
+	}
+
+	return( &pFont->pGlyphs[ pFont->lastChar - pFont->firstChar + 1 + uiIndex ] );
+}
+
+
+//**************************************************************************
+//	_oled_display_render_glyph (local)
+//--------------------------------------------------------------------------
+//	This function will copy the bitmap of the given printable character
+//	into the destination (8 bytes, one per pixel column) in the selected
+//	glyph variant and inverse it if the inverse font is selected.
+//	The destination must be aligned to 64 bit.
+//
+//	With OLED_GLYPH_VARIANTS the bitmap is taken from the precalculated
+//	tables with one 64 bit load and store.
+//
+void _oled_display_render_glyph( oled_display_handle_t *pHandle, uint8_t charIdx, uint64_t *pDest )
+{
+#if OLED_GLYPH_VARIANTS
+	uint64_t	ullGlyph;
+
+	charIdx -= FONT_FIRST_CHAR;
+
+	if( GLYPH_NORMAL == pHandle->glyphVariant )
+	{
+		ullGlyph = pHandle->inverse ? g_arullGlyphInverted[ charIdx ] : g_arullGlyphNormal[ charIdx ];
+	}
+	else
+	{
+		ullGlyph = g_arpGlyphTable[ pHandle->glyphVariant ][ charIdx ];
+
+		if( pHandle->inverse )
+		{
+			ullGlyph = ~ullGlyph;
+		}
+	}
+
+#ifdef PRINT_DEBUG_INFO
+	printf( "PrintChar( %c ): %016llX\n", charIdx + FONT_FIRST_CHAR, (unsigned long long)ullGlyph );
+#endif
+
+	*pDest = ullGlyph;
+
+#else
+	uint8_t		*pColumn	= (uint8_t *)pDest;
+	uint16_t	uiHelper;
+	uint8_t		usLetterColumn;
+
+	//----------------------------------------------------------------------
+	//	calculate the pointer into the font array to that position where
+	//	the bitmap of this character starts
+	//
+	uiHelper   = charIdx - FONT_FIRST_CHAR;
+	uiHelper <<= 3;	//	mit 8 multiplizieren
+
+#ifdef PRINT_DEBUG_INFO
+	printf( "PrintChar( %c ): Idx: %d => ", charIdx, uiHelper );
+#endif
+
+	for( uint8_t idx = 0 ; PIXELS_CHAR_WIDTH > idx ; idx++ )
+	{
+		//------------------------------------------------------------------
+		//	mirrored and rotated glyphs start with the last column
+		//
+		if( GLYPH_NORMAL == pHandle->glyphVariant )
+		{
+			usLetterColumn = (uint8_t)font8x8_simple[ uiHelper + idx ];
+		}
+		else
+		{
+			usLetterColumn = (uint8_t)font8x8_simple[ uiHelper + PIXELS_CHAR_WIDTH - 1 - idx ];
+		}
+
+#ifdef PRINT_DEBUG_INFO
+		printf( " %02X ", usLetterColumn );
+#endif
+
+		if( GLYPH_ROTATED == pHandle->glyphVariant )
+		{
+			usLetterColumn = GLYPH_REVERSE( usLetterColumn );
+		}
+
+		if( pHandle->inverse )
+		{
+			usLetterColumn = ~usLetterColumn;
+		}
+
+		pColumn[ idx ] = usLetterColumn;
+	}
+
+#ifdef PRINT_DEBUG_INFO
+	printf( "\n" );
+#endif
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_render_font_text (local)
+//--------------------------------------------------------------------------
+//	Render the text with the proportional font into the destination,
+//	one byte per pixel column, at most 'columns' bytes.
+//	With pFont NULL the 8x8 font is used, then the destination must be
+//	aligned to 64 bit.
+//	Returns the number of rendered columns.
+//
+uint8_t _oled_display_render_font_text( oled_display_handle_t *pHandle, const oled_font_t *pFont, const char *strText, uint8_t *pDest, uint8_t columns )
+{
+	const uint8_t		*pText		= (const uint8_t *)strText;
+	const oled_glyph_t	*pGlyph;
+	uint64_t			 ullGlyph;
+	uint8_t				 usInverse	= pHandle->inverse ? 0xFF : 0x00;
+	uint8_t				 usColumn	= 0;
+	uint8_t				 usWidth;
+	uint8_t				 charIdx;
+
+	//----------------------------------------------------------------------
+	//	8x8 font: whole glyphs directly, the last one cut
+	//
+	while( (NULL == pFont) && (0x00 != *pText) && (columns > usColumn) )
+	{
+		charIdx = *pText++;
+
+		if( 0x80 <= charIdx )
+		{
+			charIdx = _oled_display_codepoint_glyph( _oled_display_utf8_decode( &pText, charIdx ) );
+		}
+
+		if( ' ' > charIdx )
+		{
+			continue;
+		}
+
+		if( PIXELS_CHAR_WIDTH <= (columns - usColumn) )
+		{
+			_oled_display_render_glyph( pHandle, charIdx, (uint64_t *)&pDest[ usColumn ] );
+
+			usColumn += PIXELS_CHAR_WIDTH;
+		}
+		else
+		{
+			_oled_display_render_glyph( pHandle, charIdx, &ullGlyph );
+			memcpy( &pDest[ usColumn ], &ullGlyph, columns - usColumn );
+
+			usColumn = columns;
+		}
+	}
+
+	while( (NULL != pFont) && (0x00 != *pText) && (columns > usColumn) )
+	{
+		pGlyph = _oled_display_font_glyph( pFont, &pText );
+
+		if( NULL == pGlyph )
+		{
+			continue;
+		}
+
+		usWidth	= (pGlyph->advance < (columns - usColumn)) ? pGlyph->advance : (columns - usColumn);
+
+		//------------------------------------------------------------------
+		//	the glyph, then the empty columns up to the next one
+		//
+		_oled_display_decode_glyph( pFont, pGlyph, &pDest[ usColumn ], (pGlyph->width < usWidth) ? pGlyph->width : usWidth );
+
+		for( uint8_t idx = pGlyph->width ; usWidth > idx ; idx++ )
+		{
+			pDest[ usColumn + idx ] = 0x00;
+		}
+
+		if( 0x00 != usInverse )
+		{
+			for( uint8_t idx = 0 ; usWidth > idx ; idx++ )
+			{
+				pDest[ usColumn + idx ] ^= usInverse;
+			}
+		}
+
+		usColumn += usWidth;
+	}
+
+	return( usColumn );
+}
+
+
+//**************************************************************************
+//	_oled_display_decode_glyph (local)
+//--------------------------------------------------------------------------
+//	Copy the first columns of the glyph into the destination and move
+//	them down to the top row of the font.
+//	Packed columns are taken out of a 16 bit window that starts at the
+//	byte of their first bit.
+//
+void _oled_display_decode_glyph( const oled_font_t *pFont, const oled_glyph_t *pGlyph, uint8_t *pDest, uint8_t columns )
+{
+	const uint8_t	*pColumns;
+	uint32_t		 ulBit;
+	uint16_t		 uiWindow;
+	uint8_t			 usMask;
+
+	if( 0 == (OLED_FONT_PACKED & pFont->flags) )
+	{
+		pColumns = &pFont->pColumns[ pGlyph->offset ];
+
+		for( uint8_t idx = 0 ; columns > idx ; idx++ )
+		{
+			pDest[ idx ] = pColumns[ idx ] << pFont->top;
+		}
+
+		return;
+	}
+
+	ulBit	= (uint32_t)pGlyph->offset * pFont->height;
+	usMask	= (uint8_t)((1 << pFont->height) - 1);
+
+	for( uint8_t idx = 0 ; columns > idx ; idx++ )
+	{
+		pColumns	= &pFont->pColumns[ ulBit >> 3 ];
+		uiWindow	= pColumns[ 0 ] | (pColumns[ 1 ] << 8);
+
+		pDest[ idx ] = ((uiWindow >> (ulBit & 0x07)) & usMask) << pFont->top;
+
+		ulBit += pFont->height;
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_spread_columns (local)
+//--------------------------------------------------------------------------
+//	Enlarge the source columns by 'scale' (2 ... OLED_MAX_SCALE) into the
+//	destination pages, at most 'columns' destination bytes per page.
+//	Both nibbles of a column byte are spread with a table lookup into
+//	one word of 8 * scale bits, every page gets the next byte of it,
+//	'scale' times side by side.
+//
+void _oled_display_spread_columns( const uint8_t *pSource, uint8_t scale, uint8_t pages, uint8_t * const *ppDest, uint8_t columns )
+{
+	const uint16_t	*pTable	= g_aruiSpreadNibble[ scale - 2 ];
+	uint32_t		 ulSpread;
+	uint8_t			 usByte;
+	uint8_t			 usColumn;
+	uint8_t			 usWidth;
+
+	for( usColumn = 0 ; columns > usColumn ; usColumn += scale )
+	{
+		ulSpread	= pTable[ *pSource & 0x0F ] | ((uint32_t)pTable[ *pSource >> 4 ] << (4 * scale));
+		usWidth		= (scale < (columns - usColumn)) ? scale : (columns - usColumn);
+
+		pSource++;
+
+		for( uint8_t page = 0 ; pages > page ; page++ )
+		{
+			usByte = (uint8_t)(ulSpread >> (8 * page));
+
+			memset( &ppDest[ page ][ usColumn ], usByte, usWidth );
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_sync_cursor (local)
+//--------------------------------------------------------------------------
+//	If the RAM pointer of the display is not at the cursor position then
+//	send the position commands now. If the cursor was moved by
+//	set_cursor, they are counted for it.
+//
+void _oled_display_sync_cursor( oled_display_handle_t *pHandle )
+{
+	uint8_t	usPage;
+	uint8_t	usColumn;
+#if OLED_DISPLAY_STATS
+	uint8_t	usStatsEntry;
+#endif
+
+	if( pHandle->positionPending )
+	{
+		//------------------------------------------------------------------
+		//	take care of the display line shift and calculate the pixel
+		//	column where the character at the cursor starts
+		//
+		usPage		= _oled_display_page_of_line( pHandle, pHandle->textLine );
+		usColumn	= (pHandle->textColumn << 3) + DISPLAY_COLUMN_OFFSET( pHandle );
+
+		pHandle->positionPending = false;
+
+#if OLED_DISPLAY_STATS
+		usStatsEntry			= pHandle->statsEntry;
+		pHandle->statsEntry		= (OLED_STATS_ENTRIES > pHandle->positionEntry) ? pHandle->positionEntry : usStatsEntry;
+		pHandle->positionEntry	= OLED_STATS_ENTRIES;
+#endif
+
+		_oled_display_set_position( pHandle, usPage, usColumn );
+
+#if OLED_DISPLAY_STATS
+		pHandle->statsEntry		= usStatsEntry;
+#endif
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_shadow_update (local)
+//--------------------------------------------------------------------------
+//	Store the given character (and the inverse font state) for the cursor
+//	position in the text shadow.
+//	Returns true if exactly this character is already shown there, so
+//	nothing has to be send.
+//	Characters of the other glyph variants are stored as unknown.
+//
+bool _oled_display_shadow_update( oled_display_handle_t *pHandle, uint8_t charIdx )
+{
+#if OLED_TEXT_SHADOW
+	uint8_t		 usPage		= _oled_display_page_of_line( pHandle, pHandle->textLine );
+	uint8_t		*pShadow	= &pHandle->textShadow[ usPage ][ pHandle->textColumn ];
+	uint16_t	 uiMask		= 1 << pHandle->textColumn;
+	uint16_t	 uiInverse	= pHandle->inverse ? uiMask : 0;
+
+	if( GLYPH_NORMAL != pHandle->glyphVariant )
+	{
+		charIdx = SHADOW_UNKNOWN;
+	}
+	else if( (charIdx == *pShadow) && (uiInverse == (pHandle->textShadowInverse[ usPage ] & uiMask)) )
+	{
+		return( true );
+	}
+
+	*pShadow								 = charIdx;
+	pHandle->textShadowInverse[ usPage ]	&= ~uiMask;
+	pHandle->textShadowInverse[ usPage ]	|= uiInverse;
+#else
+	(void)pHandle;
+	(void)charIdx;
+#endif
+
+	return( false );
+}
+
+
+//**************************************************************************
+//	_oled_display_shadow_fill (local)
+//--------------------------------------------------------------------------
+//	Set all characters of the given page in the text shadow to the given
+//	character (normal font).
+//
+void _oled_display_shadow_fill( oled_display_handle_t *pHandle, uint8_t page, uint8_t charIdx )
+{
+#if OLED_TEXT_SHADOW
+	memset( pHandle->textShadow[ page ], charIdx, TEXT_COLUMNS );
+
+	pHandle->textShadowInverse[ page ] = 0;
+#else
+	(void)pHandle;
+	(void)page;
+	(void)charIdx;
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_shadow_invalidate (local)
+//--------------------------------------------------------------------------
+//	The content of the display is unknown, so all characters must be
+//	send again.
+//
+void _oled_display_shadow_invalidate( oled_display_handle_t *pHandle )
+{
+#if OLED_TEXT_SHADOW
+	for( uint8_t usPage = 0 ; OLED_TEXT_LINES > usPage ; usPage++ )
+	{
+		_oled_display_shadow_fill( pHandle, usPage, SHADOW_UNKNOWN );
+	}
+#else
+	(void)pHandle;
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_shadow_clear_span (local)
+//--------------------------------------------------------------------------
+//	Reduce the RAM columns that must be cleared to clear the given page
+//	to the columns of the characters that are not blank.
+//	If one character of the page is unknown the columns are not changed.
+//
+void _oled_display_shadow_clear_span( oled_display_handle_t *pHandle, uint8_t page, uint8_t *pFirstColumn, uint8_t *pColumns )
+{
+#if OLED_TEXT_SHADOW
+	const uint8_t	*pShadow	= pHandle->textShadow[ page ];
+	uint16_t		 uiInverse	= pHandle->textShadowInverse[ page ];
+	int8_t			 sFirst		= -1;
+	int8_t			 sLast		= -1;
+
+	if( NULL != memchr( pShadow, SHADOW_UNKNOWN, DISPLAY_TEXT_COLUMNS( pHandle ) ) )
+	{
+		return;
+	}
+
+	for( int8_t idx = 0 ; DISPLAY_TEXT_COLUMNS( pHandle ) > idx ; idx++ )
+	{
+		if( (SHADOW_BLANK != pShadow[ idx ]) || (uiInverse & (1 << idx)) )
+		{
+			if( 0 > sFirst )
+			{
+				sFirst = idx;
+			}
+
+			sLast = idx;
+		}
+	}
+
+	if( 0 > sFirst )
+	{
+		*pColumns = 0;
+	}
+	else
+	{
+		*pFirstColumn	= DISPLAY_COLUMN_OFFSET( pHandle ) + (sFirst << 3);
+		*pColumns		= (sLast - sFirst + 1) << 3;
+	}
+#else
+	(void)pHandle;
+	(void)page;
+	(void)pFirstColumn;
+	(void)pColumns;
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_shadow_forget (local)
+//--------------------------------------------------------------------------
+//	The pixel columns firstPixel ... endPixel - 1 of the page were
+//	overwritten with something else than characters: the characters
+//	there are unknown now.
+//
+void _oled_display_shadow_forget( oled_display_handle_t *pHandle, uint8_t page, uint8_t firstPixel, uint8_t endPixel )
+{
+#if OLED_TEXT_SHADOW
+	for( uint8_t usColumn = firstPixel >> 3 ; ((endPixel + 7) >> 3) > usColumn ; usColumn++ )
+	{
+		pHandle->textShadow[ page ][ usColumn ] = SHADOW_UNKNOWN;
+	}
+#else
+	(void)pHandle;
+	(void)page;
+	(void)firstPixel;
+	(void)endPixel;
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_shadow_scroll_region (local)
+//--------------------------------------------------------------------------
+//	Print the characters of the next line from the text shadow into
+//	every line of the scroll region except the last one. The text is
+//	printed in pieces of the same inverse state, characters that are
+//	already shown are skipped by the print.
+//	Returns 'false' (nothing printed) if a character of the lines is
+//	unknown.
+//
+bool _oled_display_shadow_scroll_region( oled_display_handle_t *pHandle )
+{
+#if OLED_TEXT_SHADOW
+	char			 strPiece[ TEXT_COLUMNS * UTF8_MAX_BYTES + 1 ];
+	const uint8_t	*pSource;
+	uint16_t		 uiInverse;
+	uint8_t			 usLength;
+	uint8_t			 usColumn;
+	bool			 bInverse		= pHandle->inverse;
+	glyph_variant_t	 glyphVariant	= pHandle->glyphVariant;
+
+	for( uint8_t usLine = pHandle->scrollFirstLine + 1 ; pHandle->scrollLastLine >= usLine ; usLine++ )
+	{
+		pSource = pHandle->textShadow[ _oled_display_page_of_line( pHandle, usLine ) ];
+
+		if( NULL != memchr( pSource, SHADOW_UNKNOWN, DISPLAY_TEXT_COLUMNS( pHandle ) ) )
+		{
+			return( false );
+		}
+	}
+
+	pHandle->glyphVariant = GLYPH_NORMAL;
+
+	for( uint8_t usLine = pHandle->scrollFirstLine ; pHandle->scrollLastLine > usLine ; usLine++ )
+	{
+		pSource		= pHandle->textShadow[ _oled_display_page_of_line( pHandle, usLine + 1 ) ];
+		uiInverse	= pHandle->textShadowInverse[ _oled_display_page_of_line( pHandle, usLine + 1 ) ];
+		usColumn	= 0;
+
+		while( DISPLAY_TEXT_COLUMNS( pHandle ) > usColumn )
+		{
+			pHandle->inverse			= (0 != (uiInverse & (1 << usColumn)));
+			pHandle->textLine			= usLine;
+			pHandle->textColumn			= usColumn;
+			pHandle->positionPending	= true;
+
+			usLength = 0;
+
+			do
+			{
+				usLength += _oled_display_encode_glyph( pSource[ usColumn++ ], &strPiece[ usLength ] );
+			}
+			while(		(DISPLAY_TEXT_COLUMNS( pHandle ) > usColumn)
+					&&	(pHandle->inverse == (0 != (uiInverse & (1 << usColumn)))) );
+
+			strPiece[ usLength ] = 0x00;
+
+			oled_display_print( pHandle, strPiece );
+		}
+	}
+
+	pHandle->inverse		= bInverse;
+	pHandle->glyphVariant	= glyphVariant;
+
+	return( true );
+#else
+	(void)pHandle;
+
+	return( false );
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_write_run (local)
+//--------------------------------------------------------------------------
+//	Send the collected character bitmaps of one line as one transaction
+//	and reset the length of the run.
+//
+void _oled_display_write_run( oled_display_handle_t *pHandle, const uint8_t *pRun, uint8_t *pRunLength )
+{
+	if( 0 < *pRunLength )
+	{
+		_oled_display_write_data( pHandle, pRun, *pRunLength );
+
+		*pRunLength = 0;
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_write (local)
+//--------------------------------------------------------------------------
+//	This function will send the given buffer (prefix byte included)
+//	through the transport of the display.
+//
+void _oled_display_write( oled_display_handle_t *pHandle, const uint8_t *pBuffer, size_t length )
+{
+	esp_err_t	result;
+#if OLED_DISPLAY_STATS
+	int64_t		startTime	= esp_timer_get_time();
+#endif
+
+	result = pHandle->pTransport->write( pHandle->pTransportContext, pHandle->address, pBuffer, length );
+
+#if OLED_DISPLAY_STATS
+	_oled_display_count( pHandle, result, 1 + length, startTime );
+#endif
+
+	if( ESP_OK != result )
+	{
+		_oled_display_lost( pHandle );
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_write_data (local)
+//--------------------------------------------------------------------------
+//	This function will send the given display data through the transport
+//	of the display. The transport will put PREFIX_DATA in front.
+//
+void _oled_display_write_data( oled_display_handle_t *pHandle, const uint8_t *pData, size_t length )
+{
+	esp_err_t	result;
+#if OLED_DISPLAY_STATS
+	int64_t		startTime	= esp_timer_get_time();
+#endif
+
+	result = pHandle->pTransport->write_data( pHandle->pTransportContext, pHandle->address, pData, length );
+
+#if OLED_DISPLAY_STATS
+	_oled_display_count( pHandle, result, BUS_BYTES_DATA( length ), startTime );
+#endif
+
+	if( ESP_OK != result )
+	{
+		_oled_display_lost( pHandle );
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_lost (local)
+//--------------------------------------------------------------------------
+//	A transaction failed, so it is not known what the display shows and
+//	where its RAM pointer is. Everything will be send again.
+//
+void _oled_display_lost( oled_display_handle_t *pHandle )
+{
+	_oled_display_shadow_invalidate( pHandle );
+
+	pHandle->positionPending = true;
+}
+
+
+//**************************************************************************
+//	_oled_display_begin (local)
+//--------------------------------------------------------------------------
+//	Take the lock and, if no other function of the display is running,
+//	count all following bus traffic for the given entry of the statistics.
+//	Scrolling is always counted for itself.
+//	Returns the entry that was active before.
+//
+uint8_t _oled_display_begin( oled_display_handle_t *pHandle, uint8_t entry )
+{
+	uint8_t	previousEntry = OLED_STATS_ENTRIES;
+
+	oled_display_lock( pHandle );
+
+#if OLED_DISPLAY_STATS
+	previousEntry = pHandle->statsEntry;
+
+	if( (OLED_STATS_ENTRIES == previousEntry) || (OLED_STATS_SCROLL == entry) )
+	{
+		pHandle->statsEntry = entry;
+		pHandle->stats.entry[ entry ].calls++;
+	}
+#else
+	(void)entry;
+#endif
+
+	return( previousEntry );
+}
+
+
+//**************************************************************************
+//	_oled_display_end (local)
+//--------------------------------------------------------------------------
+//	Counterpart of _oled_display_begin().
+//
+void _oled_display_end( oled_display_handle_t *pHandle, uint8_t previousEntry )
+{
+#if OLED_DISPLAY_STATS
+	pHandle->statsEntry = previousEntry;
+#else
+	(void)previousEntry;
+#endif
+
+	oled_display_unlock( pHandle );
+}
+
+
+#if OLED_DISPLAY_STATS
+//**************************************************************************
+//	_oled_display_count (local)
+//--------------------------------------------------------------------------
+//	Count one transaction for the active entry of the statistics.
+//	Outside of the display functions (e.g. init) it is counted as other.
+//
+void _oled_display_count( oled_display_handle_t *pHandle, esp_err_t result, uint32_t busBytes, int64_t startTime )
+{
+	oled_stats_counter_t	*pCounter;
+
+	if( OLED_STATS_ENTRIES > pHandle->statsEntry )
+	{
+		pCounter = &pHandle->stats.entry[ pHandle->statsEntry ];
+	}
+	else
+	{
+		pCounter = &pHandle->stats.entry[ OLED_STATS_OTHER ];
+	}
+
+	pCounter->transactions++;
+	pCounter->bytes		+= busBytes;
+	pCounter->timeUs	+= (uint64_t)(esp_timer_get_time() - startTime);
+
+	if( ESP_ERR_TIMEOUT == result )
+	{
+		pCounter->timeouts++;
+	}
+	else if( ESP_OK != result )
+	{
+		pCounter->failures++;
+	}
+}
+#endif
+
+
+//**************************************************************************
+//	_oled_display_in_render_task (local)
+//--------------------------------------------------------------------------
+//	Returns 'true' if the function is called by the render task of the
+//	display.
+//
+bool _oled_display_in_render_task( oled_display_handle_t *pHandle )
+{
+#if OLED_DISPLAY_ASYNC
+	return( (NULL != pHandle->pAsync) && (xTaskGetCurrentTaskHandle() == pHandle->pAsync->task) );
+#else
+	(void)pHandle;
+
+	return( false );
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_post (local)
+//--------------------------------------------------------------------------
+//	With asynchronous output put the render command into the queue and
+//	return 'true'. The data (max. OLED_ASYNC_TEXT_SIZE bytes) is copied
+//	into the command.
+//	Returns 'false' if the caller has to do the output itself.
+//
+bool _oled_display_post( oled_display_handle_t *pHandle, uint8_t type, uint8_t parameter1, uint8_t parameter2, const void *pData, uint8_t length )
+{
+#if OLED_DISPLAY_ASYNC
+	oled_render_cmd_t	cmd;
+
+	if( !_oled_display_is_async( pHandle ) )
+	{
+		return( false );
+	}
+
+	cmd.type			= type;
+	cmd.length			= length;
+	cmd.parameter[ 0 ]	= parameter1;
+	cmd.parameter[ 1 ]	= parameter2;
+
+	if( 0 < length )
+	{
+		memcpy( cmd.text, pData, length );
+	}
+
+	xQueueSend( pHandle->pAsync->queue, &cmd, portMAX_DELAY );
+
+	return( true );
+#else
+	(void)pHandle;
+	(void)type;
+	(void)parameter1;
+	(void)parameter2;
+	(void)pData;
+	(void)length;
+
+	return( false );
+#endif
+}
+
+
+#if OLED_DISPLAY_ASYNC
+//**************************************************************************
+//	_oled_display_text_chunk (local)
+//--------------------------------------------------------------------------
+//	The number of bytes of the text that go into one render command:
+//	at most 'size', a UTF-8 sequence is not split.
+//
+uint8_t _oled_display_text_chunk( const char *strText, size_t length, uint8_t size )
+{
+	uint8_t	usChunk = size;
+
+	if( size >= length )
+	{
+		return( (uint8_t)length );
+	}
+
+	while( ((size - UTF8_MAX_BYTES) < usChunk) && (0x80 == (strText[ usChunk ] & 0xC0)) )
+	{
+		usChunk--;
+	}
+
+	return( usChunk );
+}
+#endif
+
+
+//**************************************************************************
+//	_oled_display_post_text (local)
+//--------------------------------------------------------------------------
+//	With asynchronous output put the text into the queue, split into
+//	commands of OLED_ASYNC_TEXT_SIZE characters, and return 'true'.
+//	With bNewLine a new line character follows the text.
+//	Returns 'false' if the caller has to do the output itself.
+//
+bool _oled_display_post_text( oled_display_handle_t *pHandle, const char *strText, bool bNewLine )
+{
+#if OLED_DISPLAY_ASYNC
+	size_t	length;
+
+	if( !_oled_display_is_async( pHandle ) )
+	{
+		return( false );
+	}
+
+	oled_display_lock( pHandle );
+
+	length = strlen( strText );
+
+	while( 0 < length )
+	{
+		uint8_t	usChunk = _oled_display_text_chunk( strText, length, OLED_ASYNC_TEXT_SIZE );
+
+		_oled_display_post( pHandle, RCMD_PRINT, 0, 0, strText, usChunk );
+
+		strText	+= usChunk;
+		length	-= usChunk;
+	}
+
+	if( bNewLine )
+	{
+		_oled_display_post( pHandle, RCMD_PRINT, 0, 0, "\n", 1 );
+	}
+
+	oled_display_unlock( pHandle );
+
+	return( true );
+#else
+	(void)pHandle;
+	(void)strText;
+	(void)bNewLine;
+
+	return( false );
+#endif
+}
+
+
+//**************************************************************************
+//	_oled_display_post_font_text (local)
+//--------------------------------------------------------------------------
+//	Same as _oled_display_post_text() for oled_display_print_scaled():
+//	the command holds the pointer to the font and the scale followed by
+//	the characters, the pixel column of every piece is calculated here.
+//
+bool _oled_display_post_font_text( oled_display_handle_t *pHandle, const oled_font_t *pFont, uint8_t scale, uint8_t textLine, uint8_t x, const char *strText )
+{
+#if OLED_DISPLAY_ASYNC
+	uint8_t		arusData[ OLED_ASYNC_TEXT_SIZE ];
+	char		strPiece[ OLED_ASYNC_TEXT_SIZE ];
+	size_t		length;
+	uint16_t	uiWidth;
+	uint8_t		usChunk;
+
+	if( !_oled_display_is_async( pHandle ) )
+	{
+		return( false );
+	}
+
+	oled_display_lock( pHandle );
+
+	length = strlen( strText );
+
+	memcpy( arusData, &pFont, sizeof( pFont ) );
+	arusData[ sizeof( pFont ) ] = scale;
+
+	while( (0 < length) && (DISPLAY_WIDTH( pHandle ) > x) )
+	{
+		usChunk = _oled_display_text_chunk( strText, length, OLED_ASYNC_TEXT_SIZE - sizeof( pFont ) - 1 );
+
+		memcpy( &arusData[ sizeof( pFont ) + 1 ], strText, usChunk );
+		_oled_display_post( pHandle, RCMD_PRINT_FONT, textLine, x, arusData, sizeof( pFont ) + 1 + usChunk );
+
+		memcpy( strPiece, strText, usChunk );
+		strPiece[ usChunk ] = 0x00;
+
+		uiWidth	 = scale * oled_font_text_width( pFont, strPiece );
+		x		 = (DISPLAY_WIDTH( pHandle ) - x < uiWidth) ? DISPLAY_WIDTH( pHandle ) : (x + uiWidth);
+		strText	+= usChunk;
+		length	-= usChunk;
+	}
+
+	oled_display_unlock( pHandle );
+
+	return( true );
+#else
+	(void)pHandle;
+	(void)pFont;
+	(void)scale;
+	(void)textLine;
+	(void)x;
+	(void)strText;
+
+	return( false );
+#endif
+}
+
+
+#if OLED_DISPLAY_ASYNC
+//**************************************************************************
+//	_oled_display_is_async (local)
+//--------------------------------------------------------------------------
+//	Returns 'true' if the output of the caller has to be queued,
+//	i.e. asynchronous output is running and the caller is not the
+//	render task itself.
+//
+bool _oled_display_is_async( oled_display_handle_t *pHandle )
+{
+	return( (NULL != pHandle->pAsync) && (xTaskGetCurrentTaskHandle() != pHandle->pAsync->task) );
+}
+
+
+//**************************************************************************
+//	_oled_display_post_fence (local)
+//--------------------------------------------------------------------------
+//	Put a fence (or the stop command) into the queue. The render task
+//	will notify the waiter (if not NULL) when it reaches the fence.
+//	Returns the number of the fence, 0 if the queue stayed full.
+//
+uint32_t _oled_display_post_fence( oled_display_handle_t *pHandle, uint8_t type, TaskHandle_t waiter, TickType_t ticksToWait )
+{
+	oled_async_t		*pAsync = pHandle->pAsync;
+	oled_render_cmd_t	 cmd;
+
+	oled_display_lock( pHandle );
+
+	pAsync->fenceIssued++;
+
+	if( 0 == pAsync->fenceIssued )
+	{
+		pAsync->fenceIssued++;
+	}
+
+	cmd.type	= type;
+	cmd.length	= 0;
+	cmd.fence	= pAsync->fenceIssued;
+	cmd.waiter	= waiter;
+
+	if( pdTRUE != xQueueSend( pAsync->queue, &cmd, ticksToWait ) )
+	{
+		cmd.fence = 0;
+	}
+
+	oled_display_unlock( pHandle );
+
+	return( cmd.fence );
+}
+
+
+//**************************************************************************
+//	_oled_display_render_task (local)
+//--------------------------------------------------------------------------
+//	The render task takes the commands out of the queue and does the
+//	output. It runs until it is deleted by oled_display_stop_async().
+//
+void _oled_display_render_task( void *pParameter )
+{
+	oled_display_handle_t	*pHandle = (oled_display_handle_t *)pParameter;
+	oled_render_cmd_t		 cmd;
+
+	for( ;; )
+	{
+		if( pdTRUE == xQueueReceive( pHandle->pAsync->queue, &cmd, portMAX_DELAY ) )
+		{
+			_oled_display_execute( pHandle, &cmd );
+		}
+	}
+}
+
+
+//**************************************************************************
+//	_oled_display_execute (local)
+//--------------------------------------------------------------------------
+//	Do the output for one render command. Called by the render task,
+//	so the functions of the display will send directly.
+//
+void _oled_display_execute( oled_display_handle_t *pHandle, const oled_render_cmd_t *pCmd )
+{
+	oled_async_t		*pAsync = pHandle->pAsync;
+	const oled_font_t	*pFont;
+	char				 strText[ OLED_ASYNC_TEXT_SIZE + 1 ];
+	int16_t				 arCoord[ DRAW_COORDS ];
+
+	switch( pCmd->type )
+	{
+		case RCMD_PRINT:
+			memcpy( strText, pCmd->text, pCmd->length );
+			strText[ pCmd->length ] = 0x00;
+			oled_display_print( pHandle, strText );
+			break;
+
+		case RCMD_PRINT_FONT:
+			memcpy( &pFont, pCmd->text, sizeof( pFont ) );
+			memcpy( strText, &pCmd->text[ sizeof( pFont ) + 1 ], pCmd->length - sizeof( pFont ) - 1 );
+			strText[ pCmd->length - sizeof( pFont ) - 1 ] = 0x00;
+			oled_display_print_scaled( pHandle, pFont, pCmd->text[ sizeof( pFont ) ], pCmd->parameter[ 0 ], pCmd->parameter[ 1 ], strText );
+			break;
+
+		case RCMD_DRAW:
+			memcpy( arCoord, pCmd->text, sizeof( arCoord ) );
+			_oled_display_draw( pHandle, pCmd->parameter[ 0 ], arCoord, (pixel_op_t)pCmd->parameter[ 1 ] );
+			break;
+
+		case RCMD_CLEAR:
+			oled_display_clear( pHandle );
+			break;
+
+		case RCMD_CLEAR_LINE:
+			oled_display_clear_line( pHandle, pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_CLEAR_ACTUAL_LINE:
+			oled_display_clear_actual_line( pHandle );
+			break;
+
+		case RCMD_SET_CURSOR:
+			oled_display_set_cursor( pHandle, pCmd->parameter[ 0 ], pCmd->parameter[ 1 ] );
+			break;
+
+		case RCMD_SET_INVERSE:
+			oled_display_set_inverse( pHandle, 0 != pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_FLIP:
+			oled_display_flip( pHandle, 0 != pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_SET_INVERSE_FONT:
+			oled_display_set_inverse_font( pHandle, 0 != pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_SET_PRINT_MODE:
+			oled_display_set_print_mode( pHandle, (print_mode_t)pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_SET_GLYPH_VARIANT:
+			oled_display_set_glyph_variant( pHandle, (glyph_variant_t)pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_SET_COLUMN_OFFSET:
+			oled_display_set_display_column_offset( pHandle, pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_START_MARQUEE:
+			oled_display_start_marquee(	pHandle, pCmd->parameter[ 0 ], pCmd->parameter[ 1 ],
+										(marquee_direction_t)pCmd->text[ 0 ], (scroll_interval_t)pCmd->text[ 1 ] );
+			break;
+
+		case RCMD_STOP_MARQUEE:
+			oled_display_stop_marquee( pHandle );
+			break;
+
+		case RCMD_SET_SMOOTH_SCROLL:
+			oled_display_set_smooth_scroll( pHandle, pCmd->parameter[ 0 ] );
+			break;
+
+		case RCMD_SET_SCROLL_REGION:
+			oled_display_set_scroll_region( pHandle, pCmd->parameter[ 0 ], pCmd->parameter[ 1 ] );
+			break;
+
+		case RCMD_SET_FRAME_BUFFER:
+			oled_display_set_frame_buffer( pHandle, pCmd->pFrameBuffer );
+			break;
+
+		case RCMD_FLUSH:
+			oled_display_flush( pHandle );
+			break;
+
+		case RCMD_FENCE:
+		case RCMD_STOP:
+			//--------------------------------------------------------------
+			//	the callback is done before the fence counts as reached,
+			//	so a waiter that returns sees its effects
+			//
+			if( (RCMD_FENCE == pCmd->type) && (NULL != pAsync->pDoneCallback) )
+			{
+				pAsync->pDoneCallback( pHandle, pCmd->fence, pAsync->pUser );
+			}
+
+			pAsync->fenceDone = pCmd->fence;
+
+			if( NULL != pCmd->waiter )
+			{
+				xTaskNotifyGiveIndexed( pCmd->waiter, OLED_NOTIFY_INDEX );
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+#endif
+
+
+#if OLED_I2C_LEGACY
+//**************************************************************************
+//	_oled_i2c_probe (local)
+//--------------------------------------------------------------------------
+//	Legacy I²C transport: send only the address byte and report if the
+//	device has acknowledged it.
+//
+esp_err_t _oled_i2c_probe( void *pContext, uint8_t address )
+{
+	oled_display_handle_t *pHandle = (oled_display_handle_t *)pContext;
+
+	return( i2c_master_write_to_device( pHandle->port, address, pHandle->positionCommandBuffer, 0, I2C_TIMEOUT_TICKS ) );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_write (local)
+//--------------------------------------------------------------------------
+//	Legacy I²C transport: send the buffer as one transaction.
+//
+esp_err_t _oled_i2c_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	oled_display_handle_t *pHandle = (oled_display_handle_t *)pContext;
+
+	return( i2c_master_write_to_device( pHandle->port, address, pBuffer, length, I2C_TIMEOUT_TICKS ) );
+}
+
+
+//**************************************************************************
+//	_oled_i2c_write_data (local)
+//--------------------------------------------------------------------------
+//	Legacy I²C transport: send PREFIX_DATA followed by the display data
+//	as one transaction.
+//	The command link is build in the buffer of the handle, so there is
+//	no heap allocation. The data itself is not copied into the link.
+//
+esp_err_t _oled_i2c_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length )
+{
+	oled_display_handle_t	*pHandle = (oled_display_handle_t *)pContext;
+	i2c_cmd_handle_t		 cmd;
+	esp_err_t				 result;
+
+	cmd = i2c_cmd_link_create_static( pHandle->i2cLinkBuffer, sizeof( pHandle->i2cLinkBuffer ) );
+
+	if( NULL == cmd )
+	{
+		return( ESP_ERR_NO_MEM );
+	}
+
+	i2c_master_start( cmd );
+	i2c_master_write_byte( cmd, (address << 1) | I2C_MASTER_WRITE, true );
+	i2c_master_write_byte( cmd, PREFIX_DATA, true );
+	i2c_master_write( cmd, pData, length, true );
+	i2c_master_stop( cmd );
+	result = i2c_master_cmd_begin( pHandle->port, cmd, I2C_TIMEOUT_TICKS );
+	i2c_cmd_link_delete_static( cmd );
+
+	return( result );
+}
+#endif
@@ -0,0 +1,373 @@
+//##########################################################################
+//#
+//#		SimpleOledSpi.c
+//#
+//#-------------------------------------------------------------------------
+//#
+//#	SPI transport for the SimpleOledLib (see SimpleOledSpi.h).
+//#
+//#	The library builds its command buffers for the I²C bus: every
+//#	command byte (or a run of them) has a prefix (control) byte that
+//#	tells the controller if commands or display data follow. On the SPI
+//#	bus this information is given by the D/C pin, so the transport
+//#	removes the prefix bytes and sends the bytes with the D/C pin set
+//#	accordingly.
+//#
+//#-------------------------------------------------------------------------
+//#
+//#		MIT License
+//#
+//#		Copyright (c) 2023	Michael Pfeil
+//#							Am Kuckhof 8
+//#							D - 52146 Würselen
+//#							GERMANY
+//#
+//##########################################################################
+
+
+//==========================================================================
+//
+//		I N C L U D E S
+//
+//==========================================================================
+
+#include <string.h>
+
+#include "SimpleOledSpi.h"
+
+
+//==========================================================================
+//
+//		D E F I N I T I O N S
+//
+//==========================================================================
+
+#define SPI_TIMEOUT_TICKS				(50 / portTICK_PERIOD_MS)
+
+//----	bits of the I²C prefix (control) byte  -------------------------
+#define PREFIX_BIT_CONTINUATION			0x80
+#define PREFIX_BIT_DATA					0x40
+
+//----	level of the D/C pin  ------------------------------------------
+#define DC_LEVEL_COMMAND				0
+#define DC_LEVEL_DATA					1
+
+//----	SPI mode 0 (CPOL 0, CPHA 0) for all controllers  ----------------
+#define SPI_MODE_OLED					0
+
+
+//==========================================================================
+//
+//		L O C A L   F U N C T I O N   D E C L A R A T I O N
+//
+//==========================================================================
+
+void _oled_spi_pre_transfer( spi_transaction_t *pTrans );
+esp_err_t _oled_spi_append( oled_spi_t *pSpi, uint8_t dcLevel, const uint8_t *pData, size_t length );
+esp_err_t _oled_spi_queue( oled_spi_t *pSpi );
+esp_err_t _oled_spi_reclaim( oled_spi_t *pSpi );
+
+esp_err_t _oled_spi_probe( void *pContext, uint8_t address );
+esp_err_t _oled_spi_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length );
+esp_err_t _oled_spi_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length );
+
+
+//==========================================================================
+//
+//		T R A N S P O R T S
+//
+//==========================================================================
+
+const oled_transport_t	g_oledSpiTransport =
+	{
+		.probe		= _oled_spi_probe,
+		.write		= _oled_spi_write,
+		.write_data	= _oled_spi_write_data
+	};
+
+
+//==========================================================================
+//
+//		F U N C T I O N S
+//
+//==========================================================================
+
+
+//**************************************************************************
+//	oled_spi_init
+//--------------------------------------------------------------------------
+//	Add the display as a device to the SPI bus of the given host.
+//	The bus itself must be initialized before (spi_bus_initialize with
+//	DMA) and the reset pin of the display (if any) must be released.
+//	With clockHz 0 the display is clocked with OLED_SPI_CLOCK_DEFAULT.
+//
+esp_err_t oled_spi_init( oled_spi_t *pSpi, spi_host_device_t host, gpio_num_t csPin, gpio_num_t dcPin, int clockHz )
+{
+	spi_device_interface_config_t	config;
+	esp_err_t						result;
+
+	memset( pSpi, 0, sizeof( oled_spi_t ) );
+
+	pSpi->dcPin = dcPin;
+
+	for( uint8_t idx = 0 ; OLED_SPI_QUEUE_DEPTH > idx ; idx++ )
+	{
+		pSpi->arTrans[ idx ].pSpi				= pSpi;
+		pSpi->arTrans[ idx ].trans.tx_buffer	= pSpi->arBuffer[ idx ];
+		pSpi->arTrans[ idx ].trans.user			= &pSpi->arTrans[ idx ];
+	}
+
+	gpio_reset_pin( dcPin );
+	gpio_set_direction( dcPin, GPIO_MODE_OUTPUT );
+	gpio_set_level( dcPin, DC_LEVEL_COMMAND );
+
+	memset( &config, 0, sizeof( config ) );
+
+	config.mode				= SPI_MODE_OLED;
+	config.clock_speed_hz	= (0 < clockHz) ? clockHz : OLED_SPI_CLOCK_DEFAULT;
+	config.spics_io_num		= csPin;
+	config.queue_size		= OLED_SPI_QUEUE_DEPTH;
+	config.pre_cb			= _oled_spi_pre_transfer;
+
+	result = spi_bus_add_device( host, &config, &pSpi->device );
+
+	if( ESP_OK != result )
+	{
+		pSpi->device = NULL;
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	oled_spi_wait
+//--------------------------------------------------------------------------
+//	Wait until all queued transfers are done, e.g. before the display is
+//	switched off or the bus is used by another driver.
+//
+esp_err_t oled_spi_wait( oled_spi_t *pSpi )
+{
+	esp_err_t	result = ESP_OK;
+
+	while( (ESP_OK == result) && (0 < pSpi->queued) )
+	{
+		result = _oled_spi_reclaim( pSpi );
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	oled_display_init_spi
+//--------------------------------------------------------------------------
+//	Same as oled_display_init_panel() for a display on the SPI bus
+//	(pSpi must be initialized with oled_spi_init).
+//	There is no acknowledge on the SPI bus, so the display is always
+//	taken as connected if the device was added to the bus.
+//
+uint8_t oled_display_init_spi(	oled_display_handle_t	*pHandle,
+								oled_spi_t				*pSpi,
+								chip_type_t				 chipType,
+								const oled_geometry_t	*pGeometry		)
+{
+	return( oled_display_init_panel( pHandle, &g_oledSpiTransport, pSpi, chipType, DISPLAY_ADDRESS_DEFAULT, pGeometry ) );
+}
+
+
+//**************************************************************************
+//	_oled_spi_pre_transfer (local)
+//--------------------------------------------------------------------------
+//	Called by the driver (interrupt) right before a transfer starts:
+//	set the D/C pin for the bytes of this transfer.
+//
+IRAM_ATTR void _oled_spi_pre_transfer( spi_transaction_t *pTrans )
+{
+	oled_spi_trans_t	*pSpiTrans = (oled_spi_trans_t *)pTrans->user;
+
+	gpio_set_level( pSpiTrans->pSpi->dcPin, pSpiTrans->dcLevel );
+}
+
+
+//**************************************************************************
+//	_oled_spi_append (local)
+//--------------------------------------------------------------------------
+//	Copy the bytes into the buffer of the next transfer. The transfer is
+//	queued if it is full or if the bytes need the other D/C level.
+//
+esp_err_t _oled_spi_append( oled_spi_t *pSpi, uint8_t dcLevel, const uint8_t *pData, size_t length )
+{
+	esp_err_t	result = ESP_OK;
+	size_t		copy;
+
+	while( (ESP_OK == result) && (0 < length) )
+	{
+		if(		(OLED_SPI_CHUNK_SIZE <= pSpi->fill)
+			||	((0 < pSpi->fill) && (dcLevel != pSpi->fillLevel)) )
+		{
+			result = _oled_spi_queue( pSpi );
+		}
+		else if( (0 == pSpi->fill) && (OLED_SPI_QUEUE_DEPTH <= pSpi->queued) )
+		{
+			//--------------------------------------------------------------
+			//	the buffer of the next slot still belongs to the oldest
+			//	transfer
+			//
+			result = _oled_spi_reclaim( pSpi );
+		}
+		else
+		{
+			copy = OLED_SPI_CHUNK_SIZE - pSpi->fill;
+
+			if( copy > length )
+			{
+				copy = length;
+			}
+
+			memcpy( &pSpi->arBuffer[ pSpi->next ][ pSpi->fill ], pData, copy );
+
+			pSpi->fill		+= copy;
+			pSpi->fillLevel	 = dcLevel;
+			pData			+= copy;
+			length			-= copy;
+		}
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	_oled_spi_queue (local)
+//--------------------------------------------------------------------------
+//	Hand over the filled buffer of the next slot to the driver.
+//
+esp_err_t _oled_spi_queue( oled_spi_t *pSpi )
+{
+	oled_spi_trans_t	*pSpiTrans	= &pSpi->arTrans[ pSpi->next ];
+	esp_err_t			 result		= ESP_OK;
+
+	if( 0 < pSpi->fill )
+	{
+		pSpiTrans->dcLevel		= pSpi->fillLevel;
+		pSpiTrans->trans.length	= pSpi->fill * 8;
+
+		result = spi_device_queue_trans( pSpi->device, &pSpiTrans->trans, SPI_TIMEOUT_TICKS );
+
+		if( ESP_OK == result )
+		{
+			pSpi->queued++;
+			pSpi->next = (pSpi->next + 1) % OLED_SPI_QUEUE_DEPTH;
+		}
+
+		pSpi->fill = 0;
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	_oled_spi_reclaim (local)
+//--------------------------------------------------------------------------
+//	Wait for the oldest queued transfer, its buffer is free again.
+//	The transfers of one device are done in the order of the queue.
+//
+esp_err_t _oled_spi_reclaim( oled_spi_t *pSpi )
+{
+	spi_transaction_t	*pTrans;
+	esp_err_t			 result;
+
+	result = spi_device_get_trans_result( pSpi->device, &pTrans, SPI_TIMEOUT_TICKS );
+
+	if( ESP_OK == result )
+	{
+		pSpi->queued--;
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	_oled_spi_probe (local)
+//--------------------------------------------------------------------------
+//	SPI transport: there is no acknowledge, only check that the device
+//	is on the bus.
+//
+esp_err_t _oled_spi_probe( void *pContext, uint8_t address )
+{
+	oled_spi_t	*pSpi = (oled_spi_t *)pContext;
+
+	(void)address;
+
+	return( (NULL != pSpi->device) ? ESP_OK : ESP_ERR_INVALID_ARG );
+}
+
+
+//**************************************************************************
+//	_oled_spi_write (local)
+//--------------------------------------------------------------------------
+//	SPI transport: decode the prefix bytes of the buffer and send the
+//	bytes behind them with the D/C level of their prefix.
+//	A prefix with the continuation bit is followed by one byte, without
+//	it all remaining bytes of the buffer belong to it.
+//
+esp_err_t _oled_spi_write( void *pContext, uint8_t address, const uint8_t *pBuffer, size_t length )
+{
+	oled_spi_t	*pSpi	= (oled_spi_t *)pContext;
+	esp_err_t	 result	= ESP_OK;
+	size_t		 idx	= 0;
+	size_t		 run;
+	uint8_t		 prefix;
+
+	(void)address;
+
+	while( (ESP_OK == result) && (length > idx) )
+	{
+		prefix	= pBuffer[ idx++ ];
+		run		= length - idx;
+
+		if( (prefix & PREFIX_BIT_CONTINUATION) && (1 < run) )
+		{
+			run = 1;
+		}
+
+		result	 = _oled_spi_append(	pSpi,
+										(prefix & PREFIX_BIT_DATA) ? DC_LEVEL_DATA : DC_LEVEL_COMMAND,
+										&pBuffer[ idx ],
+										run														);
+		idx		+= run;
+	}
+
+	if( ESP_OK == result )
+	{
+		result = _oled_spi_queue( pSpi );
+	}
+
+	return( result );
+}
+
+
+//**************************************************************************
+//	_oled_spi_write_data (local)
+//--------------------------------------------------------------------------
+//	SPI transport: send the display data with the D/C pin high.
+//
+esp_err_t _oled_spi_write_data( void *pContext, uint8_t address, const uint8_t *pData, size_t length )
+{
+	oled_spi_t	*pSpi	= (oled_spi_t *)pContext;
+	esp_err_t	 result;
+
+	(void)address;
+
+	result = _oled_spi_append( pSpi, DC_LEVEL_DATA, pData, length );
+
+	if( ESP_OK == result )
+	{
+		result = _oled_spi_queue( pSpi );
+	}
+
+	return( result );
+}